@@ -19,6 +19,7 @@
 #include <htgs/api/VoidData.hpp>
 #include <htgs/core/rules/AnyRuleManagerInOnly.hpp>
 #include <htgs/core/rules/RuleManager.hpp>
+#include <htgs/core/graph/profile/TaskManagerProfile.hpp>
 
 namespace htgs {
 
@@ -212,7 +213,7 @@ class Bookkeeper : public ITask<T, VoidData> {
       std::string ruleManStr = ruleMan->getConnector()->getDotId();
 //      ruleManStr.erase(0, 1);
       if ((flags & DOTGEN_FLAG_SHOW_CONNECTORS) != 0 || (flags & DOTGEN_FLAG_SHOW_CONNECTOR_VERBOSE) != 0) {
-        oss << idStr << " -> " << ruleManStr << "[label=\"" << ruleMan->getName(flags) << "\"];" << std::endl;
+        oss << idStr << " -> " << ruleManStr << "[label=\"" << ruleMan->getName(flags) << genDotRuleProfile(ruleMan, flags) << "\"];" << std::endl;
       }
     }
 //    std::string inOutLabel = (((flags & DOTGEN_FLAG_SHOW_IN_OUT_TYPES) != 0) ? ("\\nin: " + this->inTypeName()) : "");
@@ -230,7 +231,7 @@ class Bookkeeper : public ITask<T, VoidData> {
       auto connectorPair = inputConnectorDotMap.find(ruleMan->getConnector());
       if (connectorPair != inputConnectorDotMap.end())
       {
-        oss << this->getDotId() << " -> " << connectorPair->second->getConsumerDotIds() << "[label=\"" << ruleMan->getName(dotFlags) << "\"];" << std::endl;
+        oss << this->getDotId() << " -> " << connectorPair->second->getConsumerDotIds() << "[label=\"" << ruleMan->getName(dotFlags) << genDotRuleProfile(ruleMan, dotFlags) << "\"];" << std::endl;
       }
     }
 
@@ -246,7 +247,7 @@ class Bookkeeper : public ITask<T, VoidData> {
       for (AnyRuleManagerInOnly<T> *ruleMan : *ruleManagers) {
         if (connector == ruleMan->getConnector())
         {
-          oss << this->getDotId() << " -> " << connector->getDotId() << "[label=\"" << ruleMan->getName(flags) << "\"];" << std::endl;
+          oss << this->getDotId() << " -> " << connector->getDotId() << "[label=\"" << ruleMan->getName(flags) << genDotRuleProfile(ruleMan, flags) << "\"];" << std::endl;
         }
     }
     }
@@ -254,6 +255,20 @@ class Bookkeeper : public ITask<T, VoidData> {
     return oss.str();
   }
 
+  /**
+   * Adds the profile of each rule manager to the profile of the task manager that executes this bookkeeper.
+   * @param taskManagerProfiles the profiles of all task managers
+   * @note This function should only be called by the HTGS API
+   */
+  void gatherProfileData(std::map<AnyTaskManager *, TaskManagerProfile *> *taskManagerProfiles) override {
+    auto profile = taskManagerProfiles->find(this->getOwnerTaskManager());
+    if (profile == taskManagerProfiles->end())
+      return;
+
+    for (AnyRuleManagerInOnly<T> *ruleMan : *ruleManagers)
+      profile->second->addRuleProfile(ruleMan->getName(), ruleMan->getProfile());
+  }
+
   std::list<AnyRuleManagerInOnly<T> *> *getRuleManagers() {
     return ruleManagers;
   }
@@ -273,6 +288,13 @@ class Bookkeeper : public ITask<T, VoidData> {
 
 
  private:
+  //! @cond Doxygen_Suppress
+  std::string genDotRuleProfile(AnyRuleManagerInOnly<T> *ruleMan, int flags) {
+    std::string profile = ruleMan->getProfile().genDot(flags);
+    return profile.empty() ? "" : "\\n" + profile;
+  }
+  //! @endcond
+
   std::list<AnyRuleManagerInOnly<T> *> *ruleManagers; //!< The list of ruleManagers (one per consumer)
   std::string ruleManagerInfo; //!< A string representation of all rule managers
 };
@@ -0,0 +1,345 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file CheckpointManager.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the CheckpointManager, which saves and restores the state of a long-running task graph.
+ */
+#ifndef HTGS_CHECKPOINTMANAGER_HPP
+#define HTGS_CHECKPOINTMANAGER_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+#include <htgs/api/ICheckpointable.hpp>
+#include <htgs/api/ICheckpointCodec.hpp>
+#include <htgs/core/graph/AnyTaskGraphConf.hpp>
+#include <htgs/core/task/CheckpointGate.hpp>
+
+namespace htgs {
+
+/**
+ * @class CheckpointManager CheckpointManager.hpp <htgs/api/CheckpointManager.hpp>
+ * @brief Saves and restores the state of a task graph, so that a long-running batch graph can resume after a restart
+ * without recomputing completed work.
+ *
+ * @details
+ * A checkpoint contains:
+ * 1. The completed markers, which are keys added with markCompleted to identify work that is done, such as outputs
+ * that have been written or inputs that have been submitted to the graph.
+ * 2. The state of each ICheckpointable, such as the StateContainers of an IRule (see StateContainer::writeState).
+ * 3. The data that is pending in the connectors of the task graph, serialized with an ICheckpointCodec.
+ *
+ * To create a checkpoint, the threads of the TaskGraphRuntime are paused by a CheckpointGate prior to consuming data.
+ * Once no task is executing, the checkpoint is written to a temporary file, which replaces the checkpoint file, and
+ * the threads are resumed.
+ *
+ * When resuming, restore is called prior to executing the runtime, which loads the checkpointables, the completed
+ * markers, and adds the pending data back into the connectors. The input that is submitted to the graph should then
+ * skip the keys that are completed.
+ *
+ * Example usage:
+ * @code
+ * htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData> *taskGraph = ...;
+ * htgs::CheckpointManager checkpointManager(taskGraph, "matmul.ckpt", std::make_shared<MatrixCodec>());
+ * checkpointManager.addCheckpointable(accumulateRule);
+ *
+ * htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(taskGraph);
+ * runtime->setCheckpointGate(checkpointManager.getCheckpointGate());
+ *
+ * checkpointManager.restore();
+ * runtime->executeRuntime();
+ *
+ * for (size_t i = 0; i < numRequests; i++) {
+ *   std::string key = "request" + std::to_string(i);
+ *   if (checkpointManager.isCompleted(key))
+ *     continue;
+ *
+ *   taskGraph->produceData(requests[i]);
+ *   checkpointManager.markCompleted(key);
+ *
+ *   if (i % 100 == 0)
+ *     checkpointManager.checkpoint();
+ * }
+ * @endcode
+ *
+ * @note Memory managers are not paused and data that holds MemoryData cannot be restored. The threads of sub-graphs
+ * within ExecutionPipelines and TGTasks are not paused, so data within those sub-graphs is not saved.
+ * @note checkpoint should be called from the thread that produces data for the task graph. Data that is consumed from
+ * the output of the task graph while checkpointing may be in the checkpoint, so consumers of the output should use
+ * completed markers to skip data that has already been processed.
+ */
+class CheckpointManager {
+ public:
+
+  /**
+   * Constructs a checkpoint manager for a task graph
+   * @param graph the task graph to checkpoint
+   * @param fileName the file that stores the checkpoint
+   * @param codec the codec used to serialize the data pending in the connectors of the graph
+   */
+  CheckpointManager(AnyTaskGraphConf *graph, std::string fileName, std::shared_ptr<ICheckpointCodec> codec) {
+    this->graph = graph;
+    this->fileName = fileName;
+    this->codec = codec;
+    this->gate = std::make_shared<CheckpointGate>();
+  }
+
+  /**
+   * Gets the checkpoint gate, which must be set on the TaskGraphRuntime prior to executing it.
+   * @return the checkpoint gate
+   */
+  std::shared_ptr<CheckpointGate> getCheckpointGate() const { return this->gate; }
+
+  /**
+   * Adds state that is saved in each checkpoint. The checkpointable is not owned by the checkpoint manager.
+   * @param checkpointable the checkpointable state
+   */
+  void addCheckpointable(ICheckpointable *checkpointable) {
+    this->checkpointables.push_back(checkpointable);
+  }
+
+  /**
+   * Marks work as completed, which is saved in each checkpoint
+   * @param key the key that identifies the work
+   */
+  void markCompleted(const std::string &key) {
+    std::unique_lock<std::mutex> lock(this->completedMutex);
+    this->completed.insert(key);
+  }
+
+  /**
+   * Gets whether work has been marked as completed in this run or in a restored checkpoint
+   * @param key the key that identifies the work
+   * @return whether the work is completed
+   */
+  bool isCompleted(const std::string &key) {
+    std::unique_lock<std::mutex> lock(this->completedMutex);
+    return this->completed.find(key) != this->completed.end();
+  }
+
+  /**
+   * Gets the number of keys that are marked completed
+   * @return the number of completed keys
+   */
+  size_t getNumCompleted() {
+    std::unique_lock<std::mutex> lock(this->completedMutex);
+    return this->completed.size();
+  }
+
+  /**
+   * Gets whether the checkpoint file exists
+   * @return whether there is a checkpoint to restore
+   */
+  bool hasCheckpoint() const {
+    std::ifstream is(this->fileName, std::ios::binary);
+    return is.good();
+  }
+
+  /**
+   * Checkpoints the task graph. The threads of the task graph are paused while the checkpoint is written.
+   * @param timeout the maximum time to wait for the threads of the task graph to pause
+   * @return whether the checkpoint was written; false if the threads did not pause in time
+   */
+  bool checkpoint(std::chrono::milliseconds timeout = std::chrono::milliseconds(10000)) {
+    if (!this->gate->pause(timeout))
+      return false;
+
+    std::string tmpFileName = this->fileName + ".tmp";
+    bool success;
+    {
+      std::unique_lock<std::mutex> lock(this->completedMutex);
+      std::ofstream os(tmpFileName, std::ios::binary | std::ios::trunc);
+
+      os.write(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+      writeSize(os, CHECKPOINT_VERSION);
+
+      writeSize(os, this->completed.size());
+      for (const std::string &key : this->completed)
+        writeString(os, key);
+
+      writeSize(os, this->checkpointables.size());
+      for (ICheckpointable *checkpointable : this->checkpointables) {
+        std::ostringstream blob;
+        checkpointable->saveCheckpoint(blob);
+        writeString(os, checkpointable->getCheckpointId());
+        writeString(os, blob.str());
+      }
+
+      auto connectors = getConnectors();
+      writeSize(os, connectors.size());
+      for (auto &keyConnector : connectors) {
+        std::list<std::shared_ptr<IData>> pending;
+        for (auto data : keyConnector.second->snapshotAnyData())
+          if (data != nullptr)
+            pending.push_back(data);
+
+        writeString(os, keyConnector.first);
+        writeSize(os, pending.size());
+        for (auto data : pending) {
+          std::ostringstream blob;
+          this->codec->writeData(blob, data);
+          writeString(os, blob.str());
+        }
+      }
+
+      os.close();
+      success = !os.fail() && std::rename(tmpFileName.c_str(), this->fileName.c_str()) == 0;
+    }
+
+    this->gate->resume();
+
+    if (!success)
+      std::cerr << "Failed to write checkpoint " << this->fileName << std::endl;
+
+    return success;
+  }
+
+  /**
+   * Restores the task graph from the checkpoint file. Must be called prior to executing the TaskGraphRuntime.
+   * Checkpoints are matched to the connectors of the graph based on the order in which tasks were added to the graph,
+   * so the graph must be built in the same way as when the checkpoint was created.
+   * @return whether a checkpoint was restored; false if there is no checkpoint file
+   */
+  bool restore() {
+    std::ifstream is(this->fileName, std::ios::binary);
+    if (!is.good())
+      return false;
+
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    is.read(magic, sizeof(magic));
+    if (!is || std::string(magic, sizeof(magic)) != std::string(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC))
+        || readSize(is) != CHECKPOINT_VERSION)
+      throw std::runtime_error("Invalid checkpoint file: " + this->fileName);
+
+    {
+      std::unique_lock<std::mutex> lock(this->completedMutex);
+      uint64_t numCompleted = readSize(is);
+      for (uint64_t i = 0; i < numCompleted; i++)
+        this->completed.insert(readString(is));
+    }
+
+    std::map<std::string, ICheckpointable *> checkpointableMap;
+    for (ICheckpointable *checkpointable : this->checkpointables)
+      checkpointableMap.insert(std::make_pair(checkpointable->getCheckpointId(), checkpointable));
+
+    uint64_t numCheckpointables = readSize(is);
+    for (uint64_t i = 0; i < numCheckpointables; i++) {
+      std::string id = readString(is);
+      std::istringstream blob(readString(is));
+      auto it = checkpointableMap.find(id);
+      if (it != checkpointableMap.end())
+        it->second->loadCheckpoint(blob);
+      else
+        std::cerr << "Checkpoint state '" << id << "' has no checkpointable, skipping" << std::endl;
+    }
+
+    auto connectors = getConnectors();
+    uint64_t numConnectors = readSize(is);
+    for (uint64_t i = 0; i < numConnectors; i++) {
+      std::string key = readString(is);
+      uint64_t numData = readSize(is);
+      auto it = connectors.find(key);
+      if (it == connectors.end())
+        std::cerr << "Checkpoint connector '" << key << "' does not exist in the graph, skipping " << numData
+                  << " data" << std::endl;
+
+      for (uint64_t d = 0; d < numData; d++) {
+        std::istringstream blob(readString(is));
+        if (it != connectors.end())
+          it->second->produceAnyData(this->codec->readData(blob));
+      }
+    }
+
+    if (!is)
+      throw std::runtime_error("Truncated checkpoint file: " + this->fileName);
+
+    return true;
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static constexpr const char CHECKPOINT_MAGIC[8] = {'H', 'T', 'G', 'S', 'C', 'K', 'P', 'T'};
+  static constexpr uint64_t CHECKPOINT_VERSION = 1;
+
+  static void writeSize(std::ostream &os, uint64_t size) {
+    os.write((const char *) &size, sizeof(size));
+  }
+
+  static uint64_t readSize(std::istream &is) {
+    uint64_t size = 0;
+    is.read((char *) &size, sizeof(size));
+    return size;
+  }
+
+  static void writeString(std::ostream &os, const std::string &str) {
+    writeSize(os, str.size());
+    os.write(str.data(), str.size());
+  }
+
+  static std::string readString(std::istream &is) {
+    uint64_t size = readSize(is);
+    if (!is)
+      return "";
+    std::string str(size, '\0');
+    is.read(&str[0], size);
+    return str;
+  }
+  //! @endcond
+
+  /**
+   * Gets the connectors of the task graph with keys that are the same between runs that build the same graph.
+   * The keys are based on the order in which tasks were added to the graph. Connectors of tasks that cannot be paused,
+   * such as memory managers, are skipped.
+   * @return the map of keys to connectors
+   */
+  std::map<std::string, std::shared_ptr<AnyConnector>> getConnectors() {
+    std::map<std::string, std::shared_ptr<AnyConnector>> connectors;
+    std::set<AnyConnector *> visited;
+    std::map<std::string, size_t> occurrences;
+
+    for (AnyTaskManager *taskManager : *this->graph->getTaskManagers()) {
+      auto connector = taskManager->getInputConnector();
+      if (connector == nullptr || !taskManager->getTaskFunction()->canPauseForCheckpoint()
+          || !visited.insert(connector.get()).second)
+        continue;
+
+      std::string key = taskManager->getAddress() + "/" + taskManager->getName() + "/"
+          + std::to_string(taskManager->getPipelineId());
+      key += "#" + std::to_string(occurrences[key]++);
+      connectors.insert(std::make_pair(key, connector));
+    }
+
+    auto outputConnector = this->graph->getOutputConnector();
+    if (outputConnector != nullptr && visited.insert(outputConnector.get()).second)
+      connectors.insert(std::make_pair("graph-output", outputConnector));
+
+    return connectors;
+  }
+
+  AnyTaskGraphConf *graph; //!< The task graph that is checkpointed
+  std::string fileName; //!< The file that stores the checkpoint
+  std::shared_ptr<ICheckpointCodec> codec; //!< The codec for data pending in connectors
+  std::shared_ptr<CheckpointGate> gate; //!< The gate used to pause the threads of the task graph
+  std::list<ICheckpointable *> checkpointables; //!< The state that is saved in each checkpoint
+  std::set<std::string> completed; //!< The keys of completed work
+  std::mutex completedMutex; //!< The mutex for the completed keys
+};
+
+//! @cond Doxygen_Suppress
+constexpr const char CheckpointManager::CHECKPOINT_MAGIC[8];
+constexpr uint64_t CheckpointManager::CHECKPOINT_VERSION;
+//! @endcond
+}
+
+#endif //HTGS_CHECKPOINTMANAGER_HPP
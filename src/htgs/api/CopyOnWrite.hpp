@@ -0,0 +1,301 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file CopyOnWrite.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements copy-on-write payloads, which allow data that fans out to multiple tasks to be shared
+ * until a task modifies it.
+ */
+#ifndef HTGS_COPYONWRITE_HPP
+#define HTGS_COPYONWRITE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include <htgs/debug/debug_message.hpp>
+
+namespace htgs {
+
+/**
+ * @class CowPtr CopyOnWrite.hpp <htgs/api/CopyOnWrite.hpp>
+ * @brief Holds a copy-on-write value that is shared by all copies of the CowPtr until one of the copies is written.
+ *
+ * @details
+ * When an IData is sent through a Bookkeeper to multiple ITasks, all of the tasks receive the same IData. Instead of
+ * each task defensively copying the payload, the payload is stored in a CowPtr. A task that modifies the payload copies
+ * the CowPtr from the IData, which is cheap, and calls write, which copies the value only if it is still shared.
+ * Tasks that only read the payload never copy it.
+ *
+ * A CowPtr instance must not be written by multiple threads; each thread writes its own copy of the CowPtr.
+ *
+ * Example usage:
+ * @code
+ * class ImageData : public htgs::IData {
+ *  public:
+ *   ImageData(htgs::CowPtr<Image> image) : image(image) {}
+ *   htgs::CowPtr<Image> getImage() const { return image; }
+ *  private:
+ *   htgs::CowPtr<Image> image;
+ * };
+ *
+ * void FilterTask::executeTask(std::shared_ptr<ImageData> data) {
+ *   htgs::CowPtr<Image> image = data->getImage();
+ *   applyFilter(image.write());  // Copies the image only if another task still holds it
+ *   addResult(new ImageData(image));
+ * }
+ * @endcode
+ *
+ * @tparam T the type of value, must be copy constructible
+ */
+template<class T>
+class CowPtr {
+ public:
+  /**
+   * Constructs a CowPtr that takes ownership of a value
+   * @param value the value
+   */
+  explicit CowPtr(T *value) : value(value) {}
+
+  /**
+   * Constructs a CowPtr that shares a value
+   * @param value the value
+   */
+  explicit CowPtr(std::shared_ptr<T> value) : value(value) {}
+
+  /**
+   * Gets the value for reading
+   * @return the value
+   */
+  const T &read() const { return *value; }
+
+  /**
+   * Gets the value for reading
+   * @return the value
+   */
+  const T &operator*() const { return *value; }
+
+  /**
+   * Gets the value for reading
+   * @return the value
+   */
+  const T *operator->() const { return value.get(); }
+
+  /**
+   * Gets the value for writing. If the value is shared with another CowPtr, then the value is copied and
+   * this CowPtr holds the copy.
+   * @return the value that is only held by this CowPtr
+   */
+  T &write() {
+    HTGS_ASSERT(value != nullptr, "Writing a CowPtr that does not hold a value");
+
+    if (value.use_count() > 1)
+      value = std::make_shared<T>(*value);
+    else
+      // Other copies release the value after reading it, synchronize with those reads before writing
+      std::atomic_thread_fence(std::memory_order_acquire);
+
+    return *value;
+  }
+
+  /**
+   * Gets whether the value is shared with another CowPtr
+   * @return whether the value is shared
+   */
+  bool isShared() const { return value.use_count() > 1; }
+
+ private:
+  std::shared_ptr<T> value; //!< The value that is shared until written
+};
+
+/**
+ * @class CowBuffer CopyOnWrite.hpp <htgs/api/CopyOnWrite.hpp>
+ * @brief Holds a copy-on-write array that is split into pages, which are shared by all copies of the CowBuffer.
+ *
+ * @details
+ * Writing to an element copies only the page that holds the element, so a task that modifies a small part of
+ * a large buffer does not copy the entire buffer. The default page size is 4 KB.
+ *
+ * A CowBuffer can also view external memory, such as the memory of a MemoryData, without copying it. Pages are
+ * copied into private memory when they are first written, so the external memory is never modified. The external
+ * memory must not be released to its MemoryManager while any CowBuffer still reads it.
+ *
+ * Like the CowPtr, a CowBuffer instance must not be written by multiple threads; each thread writes its own copy.
+ *
+ * Example usage:
+ * @code
+ * void ScaleRowTask::executeTask(std::shared_ptr<MatrixData> data) {
+ *   htgs::CowBuffer<double> matrix = data->getMatrix();
+ *   double *row = matrix.writePage(matrix.getPage(data->getRow() * width));  // Copies one page
+ *   ...
+ *   addResult(new MatrixData(matrix));
+ * }
+ * @endcode
+ *
+ * @tparam T the type of elements, must be trivially copyable
+ */
+template<class T>
+class CowBuffer {
+ public:
+  /**
+   * Gets the default number of elements per page, so that a page is 4 KB
+   * @return the default number of elements per page
+   */
+  static size_t getDefaultPageSize() { return std::max<size_t>(1, 4096 / sizeof(T)); }
+
+  /**
+   * Constructs a CowBuffer with all elements initialized to a value
+   * @param size the number of elements
+   * @param value the initial value for all elements
+   * @param pageSize the number of elements per page
+   */
+  CowBuffer(size_t size, T value = T(), size_t pageSize = getDefaultPageSize()) : numElements(size), pageSize(pageSize) {
+    HTGS_ASSERT(pageSize > 0, "CowBuffer page size must be greater than 0");
+    for (size_t page = 0; page < getNumPages(); page++) {
+      pages.push_back(allocPage());
+      external.push_back(false);
+      std::fill_n(pages[page].get(), getPageLength(page), value);
+    }
+  }
+
+  /**
+   * Constructs a CowBuffer that views external memory, which is not copied until a page is written.
+   * @param memory the external memory
+   * @param size the number of elements
+   * @param owner the owner of the external memory (such as the MemoryData), which is kept alive while pages
+   * reference the memory; can be nullptr
+   * @param pageSize the number of elements per page
+   */
+  CowBuffer(const T *memory, size_t size, std::shared_ptr<void> owner, size_t pageSize = getDefaultPageSize())
+      : numElements(size), pageSize(pageSize) {
+    HTGS_ASSERT(pageSize > 0, "CowBuffer page size must be greater than 0");
+    for (size_t page = 0; page < getNumPages(); page++) {
+      pages.push_back(std::shared_ptr<T>(owner, const_cast<T *>(memory + page * pageSize)));
+      external.push_back(true);
+    }
+  }
+
+  /**
+   * Gets the number of elements
+   * @return the number of elements
+   */
+  size_t size() const { return numElements; }
+
+  /**
+   * Gets the number of elements per page
+   * @return the number of elements per page
+   */
+  size_t getPageSize() const { return pageSize; }
+
+  /**
+   * Gets the number of pages
+   * @return the number of pages
+   */
+  size_t getNumPages() const { return (numElements + pageSize - 1) / pageSize; }
+
+  /**
+   * Gets the page that holds an element
+   * @param index the index of the element
+   * @return the page index
+   */
+  size_t getPage(size_t index) const { return index / pageSize; }
+
+  /**
+   * Gets the number of elements in a page, which is less than the page size for the last page
+   * @param page the page index
+   * @return the number of elements in the page
+   */
+  size_t getPageLength(size_t page) const { return std::min(pageSize, numElements - page * pageSize); }
+
+  /**
+   * Gets an element for reading
+   * @param index the index of the element
+   * @return the element
+   */
+  const T &operator[](size_t index) const { return pages[index / pageSize].get()[index % pageSize]; }
+
+  /**
+   * Gets a page for reading
+   * @param page the page index
+   * @return the elements of the page
+   */
+  const T *readPage(size_t page) const { return pages[page].get(); }
+
+  /**
+   * Gets a page for writing. If the page is shared with another CowBuffer or views external memory, then the
+   * page is copied and this CowBuffer holds the copy.
+   * @param page the page index
+   * @return the elements of the page that are only held by this CowBuffer
+   */
+  T *writePage(size_t page) {
+    if (isPageShared(page)) {
+      std::shared_ptr<T> copy = allocPage();
+      std::copy_n(pages[page].get(), getPageLength(page), copy.get());
+      pages[page] = copy;
+      external[page] = false;
+    } else {
+      // Other copies release the page after reading it, synchronize with those reads before writing
+      std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    return pages[page].get();
+  }
+
+  /**
+   * Sets an element, copying its page if the page is shared
+   * @param index the index of the element
+   * @param value the value
+   */
+  void set(size_t index, const T &value) {
+    writePage(index / pageSize)[index % pageSize] = value;
+  }
+
+  /**
+   * Copies all elements into contiguous memory
+   * @param dest the destination, which must hold size() elements
+   */
+  void copyTo(T *dest) const {
+    for (size_t page = 0; page < getNumPages(); page++)
+      std::copy_n(pages[page].get(), getPageLength(page), dest + page * pageSize);
+  }
+
+  /**
+   * Gets the number of pages that are shared with another CowBuffer or view external memory
+   * @return the number of shared pages
+   */
+  size_t getNumSharedPages() const {
+    size_t count = 0;
+    for (size_t page = 0; page < getNumPages(); page++)
+      if (isPageShared(page))
+        count++;
+    return count;
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  std::shared_ptr<T> allocPage() const {
+    return std::shared_ptr<T>(new T[pageSize], std::default_delete<T[]>());
+  }
+  //! @endcond
+
+  /**
+   * Gets whether a page must be copied before it is written
+   * @param page the page index
+   * @return whether the page is shared with another CowBuffer or views external memory
+   */
+  bool isPageShared(size_t page) const { return external[page] || pages[page].use_count() > 1; }
+
+  size_t numElements; //!< The number of elements
+  size_t pageSize; //!< The number of elements per page
+  std::vector<std::shared_ptr<T>> pages; //!< The pages, which are shared until written
+  std::vector<bool> external; //!< Whether each page views external memory
+};
+}
+
+#endif //HTGS_COPYONWRITE_HPP
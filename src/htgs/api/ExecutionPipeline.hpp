@@ -18,6 +18,8 @@
 #define HTGS_EXECUTIONPIPELINE_H
 
 #include <cstring>
+#include <thread>
+#include <algorithm>
 
 #include <htgs/core/rules/ExecutionPipelineBroadcastRule.hpp>
 #include <htgs/api/ITask.hpp>
@@ -114,6 +116,9 @@ class ExecutionPipeline : public ITask<T, U> {
     this->graphs = new std::vector<TaskGraphConf<T, U> *>();
     this->waitForInit = waitForInit;
     this->name = name;
+    this->numDistributors = 1;
+    this->distributionBatchSize = 32;
+    this->outputLanes = true;
   }
 
   /**
@@ -133,6 +138,9 @@ class ExecutionPipeline : public ITask<T, U> {
     this->graphs = new std::vector<TaskGraphConf<T, U> *>();
     this->waitForInit = waitForInit;
     this->name = name;
+    this->numDistributors = 1;
+    this->distributionBatchSize = 32;
+    this->outputLanes = true;
   }
 
   /**
@@ -156,6 +164,9 @@ class ExecutionPipeline : public ITask<T, U> {
     delete inputBk;
     inputBk = nullptr;
 
+    for (Bookkeeper<T> *distributorBk : distributorBks)
+      delete distributorBk;
+
     delete graphs;
     graphs = nullptr;
 
@@ -189,6 +200,98 @@ class ExecutionPipeline : public ITask<T, U> {
     this->inputRules->push_back(rule);
   }
 
+  /**
+   * Sets the number of threads that distribute input data to the pipelines. By default, the execution pipeline's
+   * thread applies the input rules for every pipeline. With multiple distributors, the pipelines are sharded among the
+   * distributors, and each distributor thread applies the input rules for its pipelines. The execution pipeline's
+   * thread then only forwards batches of input data to each distributor.
+   *
+   * Each pipeline receives its data in the same order as with a single distributor. An input rule that is shared
+   * by all pipelines is locked by every distributor that applies it, so decomposition rules that are safe to apply
+   * concurrently should disable locks (see IRule::IRule(bool)).
+   * @param numDistributors the number of distributor threads, which is limited to the number of pipelines
+   * @note Must be called prior to executing the task graph
+   */
+  void setNumDistributors(size_t numDistributors) {
+    this->numDistributors = numDistributors == 0 ? 1 : numDistributors;
+  }
+
+  /**
+   * Gets the number of threads that distribute input data to the pipelines
+   * @return the number of distributor threads
+   */
+  size_t getNumDistributors() const {
+    return std::min(this->numDistributors, this->numPipelinesExec);
+  }
+
+  /**
+   * Sets the number of pipelines, which is the number of times the graph is duplicated
+   * @param numPipelines the number of pipelines
+   * @note Must be called prior to executing the task graph
+   */
+  void setNumPipelines(size_t numPipelines) {
+    this->numPipelinesExec = numPipelines == 0 ? 1 : numPipelines;
+  }
+
+  /**
+   * Gets the number of pipelines, which is saved in a TuningProfile
+   * @return the tuning parameters
+   */
+  std::map<std::string, size_t> getTuningParameters() override {
+    return {{"pipelines", this->numPipelinesExec}};
+  }
+
+  /**
+   * Sets the number of pipelines from a TuningProfile
+   * @param name the name of the parameter
+   * @param value the number of pipelines
+   */
+  void setTuningParameter(std::string name, size_t value) override {
+    if (name == "pipelines")
+      setNumPipelines(value);
+  }
+
+  /**
+   * Sets the maximum number of input data that is forwarded to the distributors at once, when using multiple
+   * distributors (see setNumDistributors)
+   * @param batchSize the maximum batch size
+   * @note Data is forwarded one at a time while the execution pipeline is attached to a checkpoint gate or its output
+   * is demand driven
+   */
+  void setDistributionBatchSize(size_t batchSize) {
+    this->distributionBatchSize = batchSize == 0 ? 1 : batchSize;
+  }
+
+  /**
+   * Gets the maximum number of input data that is forwarded to the distributors at once
+   * @return the maximum batch size
+   */
+  size_t getDistributionBatchSize() const {
+    return this->distributionBatchSize;
+  }
+
+  /**
+   * Sets whether each pipeline produces its output into its own lane of the execution pipeline's output connector
+   * (see Connector::createLane), which is enabled by default. The consumers of the execution pipeline take data from
+   * whichever lane has data, so the pipelines do not contend on a single queue. Data from one pipeline is consumed in
+   * the order it was produced, but data from different pipelines may be interleaved in any order.
+   *
+   * Lanes are not used if the output connector must keep a single queue, such as when it orders data by priority.
+   * @param outputLanes whether to use a lane per pipeline
+   * @note Must be called prior to executing the task graph
+   */
+  void setOutputLanes(bool outputLanes) {
+    this->outputLanes = outputLanes;
+  }
+
+  /**
+   * Gets whether each pipeline produces its output into its own lane of the execution pipeline's output connector
+   * @return whether to use a lane per pipeline
+   */
+  bool isUsingOutputLanes() const {
+    return this->outputLanes;
+  }
+
   /**
    * Initializes the execution pipeline and duplicates the task graph based on the number of pipelines. If wait for initialization
    * is set to true, then this function will only return once all threads from all sub-graphs have been spawned and
@@ -212,10 +315,25 @@ class ExecutionPipeline : public ITask<T, U> {
     std::shared_ptr<Connector<U>>
         outputConnector = std::static_pointer_cast<Connector<U>>(this->getOwnerTaskManager()->getOutputConnector());
 
+    size_t numShards = this->getNumDistributors();
+    if (numShards > 1) {
+      for (size_t i = 0; i < numShards; i++) {
+        this->distributorBks.push_back(new Bookkeeper<T>());
+        this->distributorConnectors.push_back(std::shared_ptr<Connector<T>>(new Connector<T>()));
+        this->distributorConnectors[i]->incrementInputTaskCount();
+      }
+    }
+
     for (size_t i = 0; i < numPipelinesExec; i++) {
       HTGS_DEBUG("Adding pipeline " << i);
+      std::shared_ptr<Connector<U>> pipelineOutput;
+      if (this->outputLanes && outputConnector != nullptr)
+        pipelineOutput = outputConnector->createLane();
+      if (pipelineOutput == nullptr)
+        pipelineOutput = outputConnector;
+
       TaskGraphConf<T, U>
-          *graphCopy = this->graph->copy(i, this->numPipelinesExec, nullptr, outputConnector, this->getAddress());
+          *graphCopy = this->graph->copy(i, this->numPipelinesExec, nullptr, pipelineOutput, this->getAddress());
       // TODO: Remove or Add #ifdef this->getTaskGraphCommunicator());
 
 
@@ -230,7 +348,10 @@ class ExecutionPipeline : public ITask<T, U> {
         ruleManager->setOutputConnector(graphCopy->getInputConnector());
         ruleManager->initialize(i, this->numPipelinesExec, this->getAddress());
 
-        this->inputBk->addRuleManager(ruleManager);
+        if (numShards > 1)
+          this->distributorBks[i % numShards]->addRuleManager(ruleManager);
+        else
+          this->inputBk->addRuleManager(ruleManager);
       }
 
       graphs->push_back(graphCopy);
@@ -239,10 +360,16 @@ class ExecutionPipeline : public ITask<T, U> {
 
     for (TaskGraphConf<T, U> *g : *graphs) {
       TaskGraphRuntime *runtime = new TaskGraphRuntime(g);
+      runtime->setFairShareGroup(this->getOwnerTaskManager()->getFairShareGroup());
+      runtime->setResourceRegistry(this->getOwnerTaskManager()->getResourceRegistry());
+      runtime->setTimerWheel(this->getOwnerTaskManager()->getTimerWheel());
       runtime->executeRuntime();
       this->runtimes->push_back(runtime);
     }
 
+    for (size_t i = 0; i < this->distributorBks.size(); i++)
+      this->distributorThreads.push_back(new std::thread(&ExecutionPipeline<T, U>::runDistributor, this, i));
+
     if (waitForInit) {
       for (TaskGraphConf <T, U> *g : *graphs) {
         g->waitForInitialization();
@@ -258,6 +385,21 @@ class ExecutionPipeline : public ITask<T, U> {
     HTGS_DEBUG("Shutting down " << this->getName());
     this->inputBk->shutdown();
 
+    // Distributors finish forwarding their data prior to closing the inputs of their pipelines
+    for (auto connector : this->distributorConnectors) {
+      connector->producerFinished();
+      connector->wakeupConsumer();
+    }
+
+    for (size_t i = 0; i < this->distributorThreads.size(); i++) {
+      if (this->distributorThreads[i]->joinable())
+        this->distributorThreads[i]->join();
+      delete this->distributorThreads[i];
+
+      this->distributorBks[i]->shutdown();
+    }
+    this->distributorThreads.clear();
+
     // Spawn thread for each runtime to properly wait without blocking.
     std::vector<std::thread *> shutdownThreads;
 
@@ -301,9 +443,21 @@ class ExecutionPipeline : public ITask<T, U> {
    * @note This function should only be called by the HTGS API
    */
   void executeTask(std::shared_ptr<T> data) {
-    if (data != nullptr) {
+    if (data == nullptr)
+      return;
+
+    if (this->distributorConnectors.empty()) {
       this->inputBk->executeTask(data);
+      return;
     }
+
+    // Forward the data along with any other data that is waiting, so that each distributor is locked once per batch.
+    // The TaskManager consumes the other data, so deadlines, checkpoints and pull demand apply to each data.
+    std::list<std::shared_ptr<T>> batch = this->getOwnerTaskManager()->consumeAvailableData(this->distributionBatchSize - 1);
+    batch.push_front(data);
+
+    for (auto connector : this->distributorConnectors)
+      connector->produceData(&batch);
   }
 
   /**
@@ -321,9 +475,14 @@ class ExecutionPipeline : public ITask<T, U> {
    * @note This function should only be called by the HTGS API
    */
   ITask<T, U> *copy() {
-    return new ExecutionPipeline<T, U>(this->numPipelinesExec,
-                                       this->graph->copy(this->getPipelineId(), this->getNumPipelines()),
-                                       this->inputRules, this->name, this->waitForInit);
+    ExecutionPipeline<T, U> *execPipeline =
+        new ExecutionPipeline<T, U>(this->numPipelinesExec,
+                                    this->graph->copy(this->getPipelineId(), this->getNumPipelines()),
+                                    this->inputRules, this->name, this->waitForInit);
+    execPipeline->setNumDistributors(this->numDistributors);
+    execPipeline->setDistributionBatchSize(this->distributionBatchSize);
+    execPipeline->setOutputLanes(this->outputLanes);
+    return execPipeline;
   }
 
   /**
@@ -333,6 +492,35 @@ class ExecutionPipeline : public ITask<T, U> {
   void debug() {
     HTGS_DEBUG(this->getName() << " " << numPipelinesExec << " pipelines; details:");
     inputBk->debug();
+    for (Bookkeeper<T> *distributorBk : distributorBks)
+      distributorBk->debug();
+  }
+
+  /**
+   * The execution pipeline's output is produced by the threads of its sub-graphs, so its connectors use blocking
+   * queues.
+   * @return false
+   */
+  bool canUseSpscQueue() override {
+    return false;
+  }
+
+  /**
+   * The execution pipeline's output is produced by the threads of its sub-graphs, so it forwards its input as it
+   * arrives.
+   * @return false
+   */
+  bool canPullData() override {
+    return false;
+  }
+
+  /**
+   * Each pipeline produces the execution pipeline's output, so the output connector is split into a lane per pipeline
+   * if output lanes are enabled (see setOutputLanes).
+   * @return whether the output connector uses lanes
+   */
+  bool usesOutputLanes() override {
+    return this->outputLanes;
   }
 
   virtual void gatherProfileData(std::map<AnyTaskManager *, TaskManagerProfile *> *taskManagerProfiles) override {
@@ -650,6 +838,23 @@ class ExecutionPipeline : public ITask<T, U> {
 
  private:
 
+  /**
+   * Applies the input rules of the pipelines that belong to a distributor to each data forwarded to the distributor,
+   * until the execution pipeline shuts down.
+   * @param distributorId the distributor id
+   */
+  void runDistributor(size_t distributorId) {
+    std::shared_ptr<Connector<T>> connector = this->distributorConnectors[distributorId];
+    Bookkeeper<T> *distributorBk = this->distributorBks[distributorId];
+
+    while (!connector->isInputTerminated()) {
+      for (std::shared_ptr<T> data : connector->consumeAvailableData(this->distributionBatchSize, true)) {
+        if (data != nullptr)
+          distributorBk->executeTask(data);
+      }
+    }
+  }
+
   /**
    * Moves the output connector outside of the execution pipeline graphs to cleanup how the graph looks during graph visualization.
    * @param graph the graph
@@ -696,6 +901,12 @@ class ExecutionPipeline : public ITask<T, U> {
   std::vector<TaskGraphConf<T, U> *> *graphs; //!< The list of duplicate TaskGraphs
   bool waitForInit; //!< Flag whether to wait for initialization of sub-graphs to complete or not
   std::string name; //!< The name given to the execution pipeline task
+  size_t numDistributors; //!< The number of threads that distribute input data to the pipelines
+  size_t distributionBatchSize; //!< The maximum number of input data forwarded to the distributors at once
+  std::vector<Bookkeeper<T> *> distributorBks; //!< The bookkeepers holding the input rules of each distributor's pipelines
+  std::vector<std::shared_ptr<Connector<T>>> distributorConnectors; //!< The connectors that forward input data to each distributor
+  std::vector<std::thread *> distributorThreads; //!< The threads that run the distributors
+  bool outputLanes; //!< Whether each pipeline produces its output into its own lane of the output connector
 };
 }
 
@@ -0,0 +1,337 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file FairShareScheduler.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the FairShareScheduler, which distributes a core budget among multiple task graphs in a process.
+ */
+#ifndef HTGS_FAIRSHARESCHEDULER_HPP
+#define HTGS_FAIRSHARESCHEDULER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <htgs/debug/debug_message.hpp>
+
+namespace htgs {
+
+class FairShareScheduler;
+
+/**
+ * @class FairShareGroup FairShareScheduler.hpp <htgs/api/FairShareScheduler.hpp>
+ * @brief Represents a task graph that is registered with a FairShareScheduler.
+ *
+ * @details
+ * All TaskManagerThreads of the task graph, including the threads of its sub-graphs (ExecutionPipeline and TGTask),
+ * share the same group. A thread acquires a slot from the group prior to executing its task and releases the slot
+ * afterwards. Threads are parked while the group has used its share of the core budget.
+ *
+ * A FairShareGroup is created by FairShareScheduler::registerGraph, and unregisters itself from the scheduler
+ * when it is destroyed.
+ */
+class FairShareGroup {
+ public:
+  /**
+   * Constructs a fair share group
+   * @param scheduler the scheduler that the group is registered with
+   * @param name the name of the group
+   * @param weight the weight of the group
+   */
+  FairShareGroup(FairShareScheduler *scheduler, std::string name, double weight) :
+      scheduler(scheduler), name(name), weight(weight), numRunning(0), numWaiting(0), cpuTime(0) {}
+
+  /**
+   * Destructor, unregisters the group from the scheduler
+   */
+  ~FairShareGroup();
+
+  /**
+   * Acquires a slot from the scheduler, parking the calling thread until the group is within its fair share.
+   * @return the time when the slot was acquired
+   */
+  std::chrono::steady_clock::time_point acquire();
+
+  /**
+   * Releases a slot back to the scheduler and accumulates the time that the slot was held.
+   * @param start the time when the slot was acquired
+   */
+  void release(std::chrono::steady_clock::time_point start);
+
+  /**
+   * Gets the fraction of the total CPU time of all groups that was used by this group.
+   * @return the CPU share between 0 and 1
+   */
+  double getCpuShare();
+
+  /**
+   * Gets the fraction of the core budget that this group is entitled to based on its weight.
+   * @return the entitled share between 0 and 1
+   */
+  double getEntitledShare();
+
+  /**
+   * Gets the name of the group
+   * @return the name
+   */
+  std::string getName() const { return name; }
+
+  /**
+   * Gets the weight of the group
+   * @return the weight
+   */
+  double getWeight() const { return weight; }
+
+  /**
+   * Gets the CPU time used by the group
+   * @return the CPU time in microseconds
+   */
+  unsigned long long int getCpuTime() const { return cpuTime; }
+
+ private:
+  friend class FairShareScheduler;
+
+  FairShareScheduler *scheduler; //!< The scheduler the group is registered with
+  std::string name; //!< The name of the group
+  double weight; //!< The weight of the group
+  size_t numRunning; //!< The number of threads holding a slot (guarded by the scheduler mutex)
+  size_t numWaiting; //!< The number of threads parked waiting for a slot (guarded by the scheduler mutex)
+  unsigned long long int cpuTime; //!< The total time slots were held in microseconds (guarded by the scheduler mutex)
+};
+
+/**
+ * @class FairShareScheduler FairShareScheduler.hpp <htgs/api/FairShareScheduler.hpp>
+ * @brief Enforces weighted fair shares of a core budget among task graphs that run concurrently in one process.
+ *
+ * @details
+ * Each TaskGraphRuntime that is registered with the scheduler (TaskGraphRuntime::registerFairShare) is given
+ * a FairShareGroup with a weight. At most coreBudget threads execute tasks at the same time across all registered
+ * graphs. A graph with pending work is entitled to coreBudget * weight / (sum of weights for graphs with pending work)
+ * slots, and always at least one. When other graphs are idle, a graph may use the unused slots; once a graph below its
+ * share has a parked thread, no further slots are given to graphs above their share.
+ *
+ * Slots are held while a task executes (ITask::executeTask and ITask::executeTaskFinal). Threads that are waiting for
+ * input data or for memory from a memory edge do not hold a slot.
+ *
+ * Example Usage:
+ * @code
+ * htgs::FairShareScheduler &scheduler = htgs::FairShareScheduler::getProcessScheduler();
+ *
+ * htgs::TaskGraphRuntime *bigJob = new htgs::TaskGraphRuntime(bigGraph);
+ * bigJob->registerFairShare(scheduler, "bigJob", 1.0);
+ *
+ * htgs::TaskGraphRuntime *smallJob = new htgs::TaskGraphRuntime(smallGraph);
+ * smallJob->registerFairShare(scheduler, "smallJob", 1.0);
+ *
+ * bigJob->executeRuntime();
+ * smallJob->executeRuntime();
+ * ...
+ * scheduler.printShares();
+ * @endcode
+ *
+ * @note The scheduler must outlive all of the TaskGraphRuntimes that are registered with it.
+ */
+class FairShareScheduler {
+ public:
+  /**
+   * Constructs a fair share scheduler
+   * @param coreBudget the maximum number of threads that execute tasks at the same time
+   */
+  FairShareScheduler(size_t coreBudget) {
+    HTGS_ASSERT(coreBudget > 0, "The core budget for a FairShareScheduler must be greater than 0");
+    this->coreBudget = coreBudget;
+    this->totalRunning = 0;
+    this->totalCpuTime = 0;
+  }
+
+  /**
+   * Destructor
+   */
+  ~FairShareScheduler() {}
+
+  /**
+   * Gets the process-wide scheduler, which has a core budget equal to the number of hardware threads.
+   * @return the process-wide scheduler
+   */
+  static FairShareScheduler &getProcessScheduler() {
+    static FairShareScheduler processScheduler(std::max(1u, std::thread::hardware_concurrency()));
+    return processScheduler;
+  }
+
+  /**
+   * Registers a graph with the scheduler
+   * @param name the name of the graph
+   * @param weight the weight of the graph, must be greater than 0
+   * @return the group that is shared by all threads of the graph
+   */
+  std::shared_ptr<FairShareGroup> registerGraph(std::string name, double weight) {
+    HTGS_ASSERT(weight > 0.0, "The weight for graph '" << name << "' must be greater than 0");
+    std::shared_ptr<FairShareGroup> group = std::make_shared<FairShareGroup>(this, name, weight);
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->groups.insert(group.get());
+    return group;
+  }
+
+  /**
+   * Gets the core budget
+   * @return the maximum number of threads that execute tasks at the same time
+   */
+  size_t getCoreBudget() const { return coreBudget; }
+
+  /**
+   * Gets the number of threads that are currently executing tasks
+   * @return the number of threads holding a slot
+   */
+  size_t getNumRunning() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return totalRunning;
+  }
+
+  /**
+   * Gets the fraction of the total CPU time of all groups that was used by a group.
+   * @param group the group
+   * @return the CPU share between 0 and 1
+   */
+  double getCpuShare(const FairShareGroup *group) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return totalCpuTime == 0 ? 0.0 : (double) group->cpuTime / (double) totalCpuTime;
+  }
+
+  /**
+   * Gets the fraction of the core budget that a group is entitled to among all registered groups.
+   * @param group the group
+   * @return the entitled share between 0 and 1
+   */
+  double getEntitledShare(const FairShareGroup *group) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    double totalWeight = 0.0;
+    for (FairShareGroup *g : groups)
+      totalWeight += g->weight;
+
+    return totalWeight == 0.0 ? 0.0 : group->weight / totalWeight;
+  }
+
+  /**
+   * Prints the entitled share and CPU share for each registered group.
+   * @param os the output stream
+   */
+  void printShares(std::ostream &os = std::cout) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    double totalWeight = 0.0;
+    for (FairShareGroup *g : groups)
+      totalWeight += g->weight;
+
+    os << "Fair share scheduler: core budget " << coreBudget << std::endl;
+    for (FairShareGroup *g : groups) {
+      os << std::setw(20) << g->name
+         << " weight: " << g->weight
+         << " entitled share: " << std::setprecision(3) << (g->weight / totalWeight) * 100.0 << "%"
+         << " CPU share: " << (totalCpuTime == 0 ? 0.0 : (double) g->cpuTime / (double) totalCpuTime) * 100.0 << "%"
+         << " CPU time: " << g->cpuTime << " us" << std::endl;
+    }
+  }
+
+ private:
+  friend class FairShareGroup;
+
+  //! @cond Doxygen_Suppress
+  std::chrono::steady_clock::time_point acquire(FairShareGroup *group) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    group->numWaiting++;
+    this->condition.wait(lock, [&] { return this->canRun(group); });
+    group->numWaiting--;
+    group->numRunning++;
+    this->totalRunning++;
+    return std::chrono::steady_clock::now();
+  }
+
+  void release(FairShareGroup *group, std::chrono::steady_clock::time_point start) {
+    unsigned long long int elapsed = (unsigned long long int)
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      group->numRunning--;
+      this->totalRunning--;
+      group->cpuTime += elapsed;
+      this->totalCpuTime += elapsed;
+    }
+    this->condition.notify_all();
+  }
+
+  void unregisterGroup(FairShareGroup *group) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->groups.erase(group);
+  }
+
+  // Must hold the mutex
+  double computeShare(const FairShareGroup *group) {
+    double activeWeight = 0.0;
+    for (FairShareGroup *g : groups) {
+      if (g->numRunning + g->numWaiting > 0)
+        activeWeight += g->weight;
+    }
+
+    return std::max(1.0, (double) coreBudget * group->weight / activeWeight);
+  }
+
+  // Must hold the mutex
+  bool canRun(FairShareGroup *group) {
+    if (totalRunning >= coreBudget)
+      return false;
+
+    if ((double) group->numRunning < computeShare(group))
+      return true;
+
+    // Over its share, so only borrow a slot if no other group below its share is waiting
+    for (FairShareGroup *g : groups) {
+      if (g != group && g->numWaiting > 0 && (double) g->numRunning < computeShare(g))
+        return false;
+    }
+
+    return true;
+  }
+  //! @endcond
+
+  size_t coreBudget; //!< The maximum number of threads that execute tasks at the same time
+  size_t totalRunning; //!< The number of threads holding a slot
+  unsigned long long int totalCpuTime; //!< The total time slots were held among all groups in microseconds
+  std::set<FairShareGroup *> groups; //!< The registered groups
+  std::mutex mutex; //!< The mutex to ensure thread safety
+  std::condition_variable condition; //!< The condition variable used for parking and unparking threads
+};
+
+inline FairShareGroup::~FairShareGroup() {
+  scheduler->unregisterGroup(this);
+}
+
+inline std::chrono::steady_clock::time_point FairShareGroup::acquire() {
+  return scheduler->acquire(this);
+}
+
+inline void FairShareGroup::release(std::chrono::steady_clock::time_point start) {
+  scheduler->release(this, start);
+}
+
+inline double FairShareGroup::getCpuShare() {
+  return scheduler->getCpuShare(this);
+}
+
+inline double FairShareGroup::getEntitledShare() {
+  return scheduler->getEntitledShare(this);
+}
+}
+
+#endif //HTGS_FAIRSHARESCHEDULER_HPP
@@ -0,0 +1,56 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ICheckpointCodec.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Defines the ICheckpointCodec interface for serializing data that is pending in connectors.
+ */
+#ifndef HTGS_ICHECKPOINTCODEC_HPP
+#define HTGS_ICHECKPOINTCODEC_HPP
+
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <htgs/api/IData.hpp>
+
+namespace htgs {
+/**
+ * @class ICheckpointCodec ICheckpointCodec.hpp <htgs/api/ICheckpointCodec.hpp>
+ * @brief Interface to serialize and deserialize the data that is pending in the connectors of a task graph
+ * when it is checkpointed by a CheckpointManager.
+ *
+ * @details
+ * The codec is used for all connectors in the task graph, so data types must be identified by the codec, for example
+ * by writing a type tag before the data.
+ *
+ * @note Data that holds MemoryData cannot be restored, as the memory managers are recreated when resuming.
+ */
+class ICheckpointCodec {
+ public:
+  /**
+   * Destructor
+   */
+  virtual ~ICheckpointCodec() {}
+
+  /**
+   * Serializes data to a stream
+   * @param os the output stream
+   * @param data the data to serialize
+   */
+  virtual void writeData(std::ostream &os, std::shared_ptr<IData> data) = 0;
+
+  /**
+   * Deserializes data from a stream that was written by writeData
+   * @param is the input stream
+   * @return the data
+   */
+  virtual std::shared_ptr<IData> readData(std::istream &is) = 0;
+};
+}
+
+#endif //HTGS_ICHECKPOINTCODEC_HPP
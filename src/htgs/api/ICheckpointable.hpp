@@ -0,0 +1,76 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ICheckpointable.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Defines the ICheckpointable interface for saving and loading state with a CheckpointManager.
+ */
+#ifndef HTGS_ICHECKPOINTABLE_HPP
+#define HTGS_ICHECKPOINTABLE_HPP
+
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace htgs {
+/**
+ * @class ICheckpointable ICheckpointable.hpp <htgs/api/ICheckpointable.hpp>
+ * @brief Interface for state that is saved and restored by a CheckpointManager, such as the StateContainers of an IRule.
+ *
+ * @details
+ * saveCheckpoint is called while the task graph is paused, so no rule or task is executing. loadCheckpoint is called
+ * prior to executing the task graph when resuming from a checkpoint.
+ *
+ * Example implementation:
+ * @code
+ * class MatMulAccumRule : public htgs::IRule<MatrixBlockData, MatrixBlockData>, public htgs::ICheckpointable {
+ *  public:
+ *   ...
+ *   std::string getCheckpointId() override { return "MatMulAccumRule"; }
+ *
+ *   void saveCheckpoint(std::ostream &os) override {
+ *     accumulated->writeState(os, [](std::ostream &out, const bool &value) { out.put(value); });
+ *   }
+ *
+ *   void loadCheckpoint(std::istream &is) override {
+ *     accumulated->readState(is, [](std::istream &in) { return (bool) in.get(); });
+ *   }
+ *
+ *  private:
+ *   htgs::StateContainer<bool> *accumulated;
+ * };
+ * @endcode
+ */
+class ICheckpointable {
+ public:
+  /**
+   * Destructor
+   */
+  virtual ~ICheckpointable() {}
+
+  /**
+   * Gets the identifier for the state, which must be unique within a checkpoint and the same between runs.
+   * @return the checkpoint identifier
+   */
+  virtual std::string getCheckpointId() = 0;
+
+  /**
+   * Saves the state to a stream
+   * @param os the output stream
+   */
+  virtual void saveCheckpoint(std::ostream &os) = 0;
+
+  /**
+   * Loads the state from a stream that was written by saveCheckpoint
+   * @param is the input stream
+   */
+  virtual void loadCheckpoint(std::istream &is) = 0;
+};
+}
+
+#endif //HTGS_ICHECKPOINTABLE_HPP
@@ -0,0 +1,114 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file IDeadlineData.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the IDeadlineData class, which is IData that must be processed before a deadline.
+ */
+#ifndef HTGS_IDEADLINEDATA_HPP
+#define HTGS_IDEADLINEDATA_HPP
+
+#include <chrono>
+#include <htgs/api/IData.hpp>
+
+namespace htgs {
+/**
+ * @class IDeadlineData IDeadlineData.hpp <htgs/api/IDeadlineData.hpp>
+ * @brief IData that carries a deadline for when it must be processed.
+ *
+ * @details
+ * IDeadlineData is ordered earliest deadline first (EDF) when consumed from a connector that uses
+ * QueueDiscipline::Priority. Such connectors are created using TaskGraphConf::addDeadlineEdge, which
+ * also enables expiry for the consumer task. Data that has passed its deadline when it is consumed
+ * is not sent to the consumer's executeTask; instead it is dropped or diverted to a fallback task,
+ * and the consumer's deadline miss count is incremented.
+ *
+ * Example implementation:
+ * @code
+ * class FrameData : public htgs::IDeadlineData {
+ *  public:
+ *   // Frame must be processed within 16 ms
+ *   FrameData(int frameId) : IDeadlineData(std::chrono::milliseconds(16)), frameId(frameId) {}
+ *  private:
+ *   int frameId;
+ * };
+ * @endcode
+ */
+class IDeadlineData : public IData {
+ public:
+  typedef std::chrono::steady_clock clock; //!< The clock used for deadlines
+
+  /**
+   * Constructs IDeadlineData with an absolute deadline
+   * @param deadline the point in time when the data expires
+   */
+  IDeadlineData(clock::time_point deadline) {
+    this->deadline = deadline;
+  }
+
+  /**
+   * Constructs IDeadlineData with a deadline relative to now
+   * @param timeToLive the duration from now until the data expires
+   */
+  IDeadlineData(clock::duration timeToLive) {
+    this->deadline = clock::now() + timeToLive;
+  }
+
+  /**
+   * Destructor
+   */
+  virtual ~IDeadlineData() override {}
+
+  /**
+   * Gets the deadline for this data
+   * @return the deadline
+   */
+  clock::time_point getDeadline() const {
+    return deadline;
+  }
+
+  /**
+   * Sets the deadline for this data
+   * @param deadline the new deadline
+   */
+  void setDeadline(clock::time_point deadline) {
+    this->deadline = deadline;
+  }
+
+  /**
+   * Gets whether the deadline for this data has passed
+   * @return whether the data has expired
+   * @retval TRUE if the deadline has passed
+   * @retval FALSE if the deadline has not passed
+   */
+  bool isExpired() const {
+    return clock::now() > deadline;
+  }
+
+  /**
+   * Compares by deadline, so that the data with the earliest deadline is processed first.
+   * Data with deadlines are ahead of data without deadlines.
+   * @param p2 the other compared IData
+   * @return The ordering of two IData
+   * @retval TRUE p2 is ahead of this
+   * @retval FALSE this is ahead of p2
+   */
+  virtual bool compare(const std::shared_ptr<IData> p2) const override {
+    const IDeadlineData *other = dynamic_cast<const IDeadlineData *>(p2.get());
+    if (other == nullptr)
+      return false;
+
+    return this->deadline > other->deadline;
+  }
+
+ private:
+  clock::time_point deadline; //!< The point in time when the data expires
+};
+}
+
+#endif //HTGS_IDEADLINEDATA_HPP
@@ -0,0 +1,179 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ILineageData.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the ILineageData class, which is IData that records the task graph inputs it was computed from.
+ */
+#ifndef HTGS_ILINEAGEDATA_HPP
+#define HTGS_ILINEAGEDATA_HPP
+
+#include <mutex>
+#include <set>
+#include <string>
+#include <htgs/api/IData.hpp>
+
+namespace htgs {
+/**
+ * @class ILineageData ILineageData.hpp <htgs/api/ILineageData.hpp>
+ * @brief IData that carries a key and the set of task graph input keys that it depends on (its lineage).
+ *
+ * @details
+ * Lineage is propagated automatically when both the input and output types of an ITask or IRule derive from
+ * ILineageData: each result that is added while processing a data inherits the lineage of that data.
+ * Data that is emitted from state (such as an IRule that joins multiple data) should merge the lineage of the
+ * data it was computed from using addLineage. Edges whose data does not derive from ILineageData do not carry lineage.
+ *
+ * Data that has a key but has not recorded any lineage is a task graph input, so its lineage is its own key. The
+ * lineage of a data may be read and merged by multiple threads, so it is guarded by a mutex.
+ *
+ * Lineage is used by the IncrementalCache to re-execute only the outputs that are affected when a subset of the
+ * task graph's inputs change.
+ *
+ * Example implementation:
+ * @code
+ * class TileData : public htgs::ILineageData {
+ *  public:
+ *   TileData(int row, int col) : ILineageData(std::to_string(row) + "," + std::to_string(col)), row(row), col(col) {}
+ *  private:
+ *   int row;
+ *   int col;
+ * };
+ *
+ * // Inside of an IRule that joins two tiles
+ * auto result = std::make_shared<JoinedData>(stored, data);
+ * result->addLineage(*stored);
+ * this->addResult(result);
+ * @endcode
+ */
+class ILineageData : public IData {
+ public:
+  /**
+   * Constructs ILineageData without a key
+   */
+  ILineageData() {}
+
+  /**
+   * Constructs ILineageData with a key
+   * @param lineageKey the key that identifies the data, which must be the same between runs of a task graph
+   */
+  ILineageData(std::string lineageKey) : lineageKey(lineageKey) {}
+
+  /**
+   * Constructs ILineageData with a key and integer ordering
+   * @param lineageKey the key that identifies the data, which must be the same between runs of a task graph
+   * @param order the order in which a task will process the data (lowest value is processed first)
+   */
+  ILineageData(std::string lineageKey, size_t order) : IData(order), lineageKey(lineageKey) {}
+
+  /**
+   * Copy constructor, which copies the key and lineage
+   * @param other the data to copy
+   */
+  ILineageData(const ILineageData &other) : IData(other), lineageKey(other.lineageKey), lineage(other.getLineage()) {}
+
+  /**
+   * Copy assignment, which copies the key and lineage
+   * @param other the data to copy
+   * @return this data
+   */
+  ILineageData &operator=(const ILineageData &other) {
+    if (&other != this) {
+      std::set<std::string> otherLineage = other.getLineage();
+      IData::operator=(other);
+      std::unique_lock<std::mutex> lock(this->lineageMutex);
+      this->lineageKey = other.lineageKey;
+      this->lineage = otherLineage;
+    }
+    return *this;
+  }
+
+  /**
+   * Destructor
+   */
+  virtual ~ILineageData() override {}
+
+  /**
+   * Gets the key that identifies this data
+   * @return the key, or an empty string if the data has no key
+   */
+  const std::string &getLineageKey() const {
+    return lineageKey;
+  }
+
+  /**
+   * Gets the keys of the task graph inputs that this data depends on.
+   * If no lineage has been recorded, then the data is a task graph input and depends on its own key.
+   * @return a copy of the lineage
+   */
+  std::set<std::string> getLineage() const {
+    std::unique_lock<std::mutex> lock(this->lineageMutex);
+    if (lineage.empty() && !lineageKey.empty())
+      return std::set<std::string>{lineageKey};
+    return lineage;
+  }
+
+  /**
+   * Adds a task graph input key to the lineage of this data
+   * @param inputKey the key of the input
+   */
+  void addLineage(const std::string &inputKey) {
+    std::unique_lock<std::mutex> lock(this->lineageMutex);
+    lineage.insert(inputKey);
+  }
+
+  /**
+   * Merges the lineage of another data into the lineage of this data
+   * @param other the data that this data was computed from
+   */
+  void addLineage(const ILineageData &other) {
+    if (&other == this)
+      return;
+
+    // Copy first, so that the two mutexes are never held together
+    std::set<std::string> otherLineage = other.getLineage();
+    std::unique_lock<std::mutex> lock(this->lineageMutex);
+    lineage.insert(otherLineage.begin(), otherLineage.end());
+  }
+
+  /**
+   * Gets whether this data depends on any of the task graph inputs
+   * @param inputKeys the keys of the inputs
+   * @return whether this data depends on any of the inputs
+   * @retval TRUE if one of the inputs is in the lineage of this data
+   * @retval FALSE if none of the inputs are in the lineage of this data
+   */
+  bool dependsOn(const std::set<std::string> &inputKeys) const {
+    std::set<std::string> dataLineage = this->getLineage();
+    for (const std::string &key : inputKeys)
+      if (dataLineage.find(key) != dataLineage.end())
+        return true;
+    return false;
+  }
+
+ private:
+  std::string lineageKey; //!< The key that identifies the data
+  std::set<std::string> lineage; //!< The keys of the task graph inputs that the data depends on
+  mutable std::mutex lineageMutex; //!< The mutex that guards the lineage
+};
+
+//! @cond Doxygen_Suppress
+/**
+ * Propagates lineage from the data that is being processed to a result. Selected at compile time, so
+ * data that does not derive from ILineageData uses the overload that does nothing.
+ */
+inline void propagateLineage(const ILineageData *data, ILineageData *result) {
+  if (data != nullptr && result != nullptr)
+    result->addLineage(*data);
+}
+
+inline void propagateLineage(const void *, const void *) {}
+//! @endcond
+}
+
+#endif //HTGS_ILINEAGEDATA_HPP
@@ -94,6 +94,13 @@ class IMemoryAllocator : public AnyMemoryAllocator {
    * @param memory the memory to be freed
    */
   virtual void memFree(T *&memory) = 0;
+
+  /**
+   * Virtual function that is called when memory is recycled by a static MemoryManager, prior to the memory being
+   * handed out again. Can be used to restore the memory to its initial state without freeing and allocating it.
+   * @param memory the memory being recycled
+   */
+  virtual void memReset(T *memory) {}
 };
 }
 
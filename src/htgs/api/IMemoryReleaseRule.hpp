@@ -14,6 +14,8 @@
 #ifndef HTGS_MEMORYRELEASERULE_HPP
 #define HTGS_MEMORYRELEASERULE_HPP
 
+#include <string>
+
 namespace htgs {
 /**
  * @class IMemoryReleaseRule IMemoryReleaseRule.hpp <htgs/api/IMemoryReleaseRule.hpp>
@@ -90,6 +92,13 @@ class IMemoryReleaseRule {
    * @retval FALSE if memory is not ready to be released
    */
   virtual bool canReleaseMemory() = 0;
+
+  /**
+   * Virtual function that describes the state of the rule, which is included in memory ownership reports (see
+   * MemoryOwnershipTracker). For example, a rule that counts releases can return the number of releases remaining.
+   * @return the state of the rule, or an empty string if the rule does not describe its state
+   */
+  virtual std::string getState() { return ""; }
 };
 }
 
@@ -0,0 +1,121 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file IObjectAllocator.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Describes how a MemoryManager constructs, resets, and destroys the objects in an object pool
+ */
+#ifndef HTGS_IOBJECTALLOCATOR_HPP
+#define HTGS_IOBJECTALLOCATOR_HPP
+
+#include <htgs/api/IMemoryAllocator.hpp>
+
+namespace htgs {
+/**
+ * @class IObjectAllocator IObjectAllocator.hpp <htgs/api/IObjectAllocator.hpp>
+ * @brief Abstract class that describes how the objects of an object pool are constructed, reset, and destroyed
+ *
+ * @details
+ * This class is used in conjunction with TaskGraphConf::addObjectPoolEdge to pool objects that are expensive to
+ * construct, such as FFT plans, compression contexts, or structures holding large buffers. Each object in the pool is
+ * constructed once when the pool is created, and is reset once its IMemoryReleaseRule indicates it can be recycled.
+ * Objects are destroyed when the pool is destroyed.
+ *
+ * Objects are acquired with ITask::getMemory and released with MemoryData::releaseMemory, as with any other memory.
+ * MemoryData::get returns a pointer to the object.
+ *
+ * Example implementation:
+ * @code
+ * class FFTPlanAllocator : public htgs::IObjectAllocator<FFTPlan>
+ * {
+ *   FFTPlanAllocator(size_t fftSize) : fftSize(fftSize) {}
+ *
+ *   FFTPlan *create() override {
+ *     return new FFTPlan(fftSize);
+ *   }
+ *
+ *   void reset(FFTPlan *plan) override {
+ *     plan->clearBuffers();
+ *   }
+ *
+ *   size_t fftSize;
+ * };
+ * @endcode
+ *
+ * Example usage:
+ * @code
+ * taskGraph->addObjectPoolEdge("fftPlans", fftTask, new FFTPlanAllocator(fftSize), numPlans);
+ *
+ * // Within FFTTask::executeTask
+ * htgs::m_data_t<FFTPlan> plan = this->getMemory<FFTPlan>("fftPlans", new ReleaseCountRule(1));
+ * plan->get()->execute(data->getTile());
+ * @endcode
+ * @tparam T the type of object
+ */
+template<class T>
+class IObjectAllocator : public IMemoryAllocator<T> {
+ public:
+  /**
+   * Creates an object allocator
+   */
+  IObjectAllocator() : IMemoryAllocator<T>(1) {}
+
+  /**
+   * Destructor
+   */
+  virtual ~IObjectAllocator() {}
+
+  /**
+   * Pure virtual function that constructs an object for the pool.
+   * @return the object
+   */
+  virtual T *create() = 0;
+
+  /**
+   * Virtual function that restores an object to its initial state when it is recycled by the pool.
+   * @param object the object being recycled
+   */
+  virtual void reset(T *object) {}
+
+  /**
+   * Virtual function that destroys an object when the pool is destroyed.
+   * @param object the object to destroy
+   */
+  virtual void destroy(T *object) { delete object; }
+
+  /**
+   * Constructs an object for the pool, objects are not arrays so the size is ignored.
+   * @param size the number of elements requested
+   * @return the object
+   */
+  T *memAlloc(size_t size) override { return this->create(); }
+
+  /**
+   * Constructs an object for the pool.
+   * @return the object
+   */
+  T *memAlloc() override { return this->create(); }
+
+  /**
+   * Destroys an object of the pool.
+   * @param memory the object
+   */
+  void memFree(T *&memory) override {
+    this->destroy(memory);
+    memory = nullptr;
+  }
+
+  /**
+   * Resets an object that is recycled by the pool.
+   * @param memory the object
+   */
+  void memReset(T *memory) override { this->reset(memory); }
+};
+}
+
+#endif //HTGS_IOBJECTALLOCATOR_HPP
@@ -18,6 +18,9 @@
 #include <functional>
 #include <list>
 #include <mutex>
+#include <stdexcept>
+#include <string>
+#include <cstdint>
 #include <htgs/core/rules/AnyIRule.hpp>
 
 #include <htgs/api/IData.hpp>
@@ -395,6 +398,45 @@ class StateContainer {
     return data[index] != emptyData;
   }
 
+  /**
+   * Writes the state container to a stream, which can be used to checkpoint an IRule (see ICheckpointable).
+   * Only the entries that have data are written using the writeValue function.
+   * @param os the output stream
+   * @param writeValue the function that writes a value to the stream
+   */
+  void writeState(std::ostream &os, const std::function<void(std::ostream &, const T &)> &writeValue) const {
+    uint64_t dims[2] = {height, width};
+    os.write((const char *) dims, sizeof(dims));
+    for (size_t i = 0; i < width * height; i++) {
+      bool hasData = this->has(i);
+      os.put(hasData ? 1 : 0);
+      if (hasData)
+        writeValue(os, data[i]);
+    }
+  }
+
+  /**
+   * Reads the state container from a stream that was written by writeState.
+   * Entries that do not have data are set to 'emptyData'.
+   * @param is the input stream
+   * @param readValue the function that reads a value from the stream
+   */
+  void readState(std::istream &is, const std::function<T(std::istream &)> &readValue) {
+    uint64_t dims[2] = {0, 0};
+    is.read((char *) dims, sizeof(dims));
+    if (dims[0] != height || dims[1] != width)
+      throw std::runtime_error("StateContainer dimensions (" + std::to_string(dims[0]) + ", " + std::to_string(dims[1])
+                                   + ") in the checkpoint do not match (" + std::to_string(height) + ", "
+                                   + std::to_string(width) + ")");
+
+    for (size_t i = 0; i < width * height; i++) {
+      if (is.get() == 1)
+        data[i] = readValue(is);
+      else
+        data[i] = emptyData;
+    }
+  }
+
   /**
    * Prints the state of the state container.
    * Iterates over all elements and prints a 1 if data is not equal to the empty data,
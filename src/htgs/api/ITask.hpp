@@ -14,6 +14,7 @@
 #ifndef HTGS_ITASK_HPP
 #define HTGS_ITASK_HPP
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <vector>
@@ -22,6 +23,8 @@
 #include <list>
 #include <assert.h>
 #include <sstream>
+#include <type_traits>
+#include <stdexcept>
 #include <htgs/core/graph/Connector.hpp>
 #include <htgs/core/task/TaskManager.hpp>
 
@@ -209,6 +212,27 @@ class ITask : public AnyITask {
  */
   virtual void executeTask(std::shared_ptr<T> data) = 0;
 
+  /**
+   * Virtual function that is called prior to executeTask for each data that is queued next for this ITask.
+   * Can be used to issue software prefetches, madvise, or asynchronous reads for the next data,
+   * overlapping fetching data with computing on the current data.
+   *
+   * Prefetch is called at most once for each data, across all threads of this ITask. With a single thread, the data
+   * is prefetched before it is executed. Data that is consumed before it was queued behind other data within the
+   * prefetch depth, such as the first data of an empty queue, is not prefetched.
+   * @param next the data that is queued next
+   * @note Only called if getPrefetchDepth() > 0
+   * @note The data may be processed by another thread of this ITask
+   */
+  virtual void prefetch(std::shared_ptr<T> next) {}
+
+  /**
+   * Virtual function that gets the number of queued data to look ahead at when calling prefetch.
+   * By default lookahead is disabled.
+   * @return the number of queued data passed to prefetch prior to each executeTask
+   */
+  virtual size_t getPrefetchDepth() { return 0; }
+
   /**
    * @copydoc AnyITask::canTerminate
    */
@@ -420,6 +444,59 @@ class ITask : public AnyITask {
     return getMemory<V>(name, releaseRule, MMType::Dynamic, numElems);
   }
 
+  /**
+   * Retrieves a batch of memory from a memory edge.
+   * All count elements are acquired at once, so the task never holds a partial set of memory while waiting
+   * for the rest, which avoids deadlocks between threads acquiring multiple elements from the same memory edge.
+   *
+   * Example usage:
+   * @code
+   * std::vector<htgs::m_data_t<double>> tiles = this->getMemoryBatch<double>("tiles", numChannels,
+   *     [](){ return new ReleaseCountRule(1); });
+   * @endcode
+   *
+   * @param name the name of the memory edge
+   * @param count the number of elements of memory to acquire
+   * @param releaseRuleFactory creates the release rule associated with each newly acquired memory
+   * @return the MemoryData
+   * @tparam V the MemoryData type
+   * @note The name specified must have been attached to this ITask as a memGetter using
+   * the TaskGraph::addMemoryManagerEdge routine, which can be verified using hasMemGetter()
+   *
+   * @note This function will block until count elements of memory are available, the memory pool size must be
+   * at least count, otherwise std::runtime_error is thrown.
+   * @note Memory edge must be defined as MMType::Static
+   */
+  template<class V>
+  std::vector<m_data_t<V>> getMemoryBatch(std::string name, size_t count,
+                                          const std::function<IMemoryReleaseRule *()> &releaseRuleFactory) {
+    return getMemoryBatch<V>(name, count, releaseRuleFactory, MMType::Static, 0);
+  }
+
+  /**
+   * Retrieves a batch of memory from a memory edge.
+   * All count elements are acquired at once, so the task never holds a partial set of memory while waiting
+   * for the rest, which avoids deadlocks between threads acquiring multiple elements from the same memory edge.
+   * @param name the name of the memory edge
+   * @param count the number of elements of memory to acquire
+   * @param releaseRuleFactory creates the release rule associated with each newly acquired memory
+   * @param numElems the number of elements to allocate for each memory (uses internal allocator defined from the memory edge)
+   * @return the MemoryData
+   * @tparam V the MemoryData type
+   * @note The name specified must have been attached to this ITask as a memGetter using
+   * the TaskGraph::addMemoryManagerEdge routine, which can be verified using hasMemGetter()
+   *
+   * @note This function will block until count elements of memory are available, the memory pool size must be
+   * at least count, otherwise std::runtime_error is thrown.
+   * @note Memory edge must be defined as MMType::Dynamic
+   */
+  template<class V>
+  std::vector<m_data_t<V>> getDynamicMemoryBatch(std::string name, size_t count,
+                                                 const std::function<IMemoryReleaseRule *()> &releaseRuleFactory,
+                                                 size_t numElems) {
+    return getMemoryBatch<V>(name, count, releaseRuleFactory, MMType::Dynamic, numElems);
+  }
+
   /**
    * Releases memory onto a memory edge, which is transferred by the graph communicator
    * @param memory the memory to be released
@@ -528,6 +605,108 @@ class ITask : public AnyITask {
     return this->ownerTask;
   }
 
+  /**
+   * Schedules a one-shot timer. When the timer expires, executeTimer is called by one of the threads of this task.
+   * Timers are driven by the timer wheel of the TaskGraphRuntime (see TaskGraphRuntime::setTimerWheel), or by
+   * the process-wide timer wheel. The task must have an input connector.
+   * @param delay the delay until the timer expires
+   * @return the timer id, which is passed to executeTimer
+   */
+  uint64_t scheduleTimer(std::chrono::microseconds delay) {
+    return this->getOwnerTaskManager()->scheduleTimer(delay, std::chrono::microseconds(0));
+  }
+
+  /**
+   * Schedules a periodic timer. Each time the timer expires, executeTimer is called by one of the threads of this
+   * task. Periodic timers are cancelled when the task terminates.
+   * @param period the period of the timer
+   * @return the timer id, which is passed to executeTimer
+   */
+  uint64_t schedulePeriodicTimer(std::chrono::microseconds period) {
+    return this->getOwnerTaskManager()->scheduleTimer(period, period);
+  }
+
+  /**
+   * Cancels a timer that was scheduled by this task
+   * @param timerId the timer id
+   * @return whether the timer was cancelled
+   */
+  bool cancelTimer(uint64_t timerId) {
+    return this->getOwnerTaskManager()->cancelTimer(timerId);
+  }
+
+  /**
+   * Waits until the consumer of this task's output requests data when the task graph uses demand-driven (pull)
+   * execution (see TaskGraphConf::enablePullExecution). Tasks that generate data, such as start tasks, should call
+   * this before producing each result, and stop generating once it returns false.
+   * Returns immediately when the task's output is not demand-driven.
+   *
+   * Example usage:
+   * @code
+   * void executeTask(std::shared_ptr<htgs::VoidData> data) {
+   *   for (int i = 0; i < numCandidates; i++) {
+   *     if (!this->waitForDemand())
+   *       break;
+   *     addResult(new CandidateData(i));
+   *   }
+   * }
+   * @endcode
+   * @return whether the task should produce another result
+   * @retval TRUE if a result was requested, or the task's output is not demand-driven
+   * @retval FALSE if no more results will be requested
+   * @note The task's fair share slot and resource slots are released while waiting, as with getMemory
+   */
+  bool waitForDemand() {
+    return this->getOwnerTaskManager()->waitForDemand();
+  }
+
+  /**
+   * Allocates transient memory from the scratch arena of the thread executing this task. The memory remains valid until
+   * executeTask (or executeTaskFinal or executeTimer) returns, at which point the arena is reset and the memory is
+   * reused for the next data. Memory must not be freed, and must be promoted with promoteScratch if it is sent
+   * downstream.
+   *
+   * Allocating from the arena avoids calling the global allocator for each data, which all task threads contend on.
+   * @code
+   * void executeTask(std::shared_ptr<MatrixData> data) {
+   *   double *workspace = this->scratchAlloc<double>(data->getWidth() * data->getHeight());
+   *   ...
+   *   addResult(new MatrixData(this->promoteScratch(result, numElems), ...));
+   * }
+   * @endcode
+   * @param count the number of elements
+   * @return the uninitialized memory
+   * @tparam V the element type, which must be trivially destructible as destructors are not called
+   */
+  template<class V>
+  V *scratchAlloc(size_t count) {
+    static_assert(std::is_trivially_destructible<V>::value, "Scratch memory must be trivially destructible");
+    return static_cast<V *>(this->getOwnerTaskManager()->getScratchArena()->allocate(sizeof(V) * count, alignof(V)));
+  }
+
+  /**
+   * Copies scratch memory into memory that is owned by the caller, so that it can outlive the current data and be sent
+   * downstream. The returned memory is allocated with new[] and must be freed with delete[].
+   * @param scratch the scratch memory allocated with scratchAlloc
+   * @param count the number of elements to copy
+   * @return the owned copy
+   * @tparam V the element type
+   */
+  template<class V>
+  V *promoteScratch(const V *scratch, size_t count) {
+    V *owned = new V[count];
+    std::copy(scratch, scratch + count, owned);
+    return owned;
+  }
+
+  /**
+   * Gets the number of bytes held by the scratch arena of the thread executing this task
+   * @return the scratch arena capacity in bytes
+   */
+  size_t getScratchCapacity() {
+    return this->getOwnerTaskManager()->getScratchArena()->getCapacity();
+  }
+
   /**
    * Gathers profile data.
    * @param taskManagerProfiles the mapping between the task manager and the profile data for the task manager.
@@ -557,7 +736,14 @@ class ITask : public AnyITask {
 #ifdef PROFILE
     auto start = std::chrono::high_resolution_clock::now();
 #endif
+    // Memory is released by other tasks, so do not hold a fair share slot or resource slots while waiting
+    this->getOwnerTaskManager()->releaseFairShare();
+    this->getOwnerTaskManager()->releaseResources();
+    HTGS_FLIGHT_RECORD(this->getOwnerTaskManager()->getFlightRecorderId(), FlightEventType::MemoryWaitStart, 1);
     m_data_t<V> memory = connector->consumeData();
+    HTGS_FLIGHT_RECORD(this->getOwnerTaskManager()->getFlightRecorderId(), FlightEventType::MemoryWaitEnd, 1);
+    this->getOwnerTaskManager()->acquireResources();
+    this->getOwnerTaskManager()->acquireFairShare();
 
 #ifdef USE_NVTX
     this->getOwnerTaskManager()->getProfiler()->endRangeWaitingForMem(rangeId);
@@ -575,6 +761,8 @@ class ITask : public AnyITask {
 
 
     memory->setMemoryReleaseRule(releaseRule);
+    memory->recordAcquired(this->getName(), this->getPipelineId(), this->getOwnerTaskManager()->getThreadId(),
+                           this->getOwnerTaskManager()->getFlightRecorderId());
 
     if (memory->getType() != type) {
       std::cerr
@@ -589,6 +777,74 @@ class ITask : public AnyITask {
     return memory;
   }
 
+  template<class V>
+  std::vector<m_data_t<V>> getMemoryBatch(std::string name, size_t count,
+                                          const std::function<IMemoryReleaseRule *()> &releaseRuleFactory,
+                                          MMType type, size_t nElem) {
+    HTGS_ASSERT(this->getMemoryEdges()->find(name) != this->getMemoryEdges()->end(), "Task '" << this->getName() << "' cannot getMemoryBatch as it does not have the memory edge '" << name << "'"  );
+
+    auto conn = getMemoryEdges()->find(name)->second;
+    auto connector = std::dynamic_pointer_cast<Connector<MemoryData<V>>>(conn);
+
+    // The batch is only taken once count elements are queued, so it would wait forever for more than the edge holds
+    if (connector->getCapacity() > 0 && count > connector->getCapacity())
+      throw std::runtime_error(
+          "Error getMemoryBatch: task '" + this->getName() + "' requested " + std::to_string(count)
+              + " elements from memory edge '" + name + "' which only has " + std::to_string(connector->getCapacity()));
+
+#ifdef WS_PROFILE
+    sendWSProfileUpdate(StatusCode::WAITING_FOR_MEM);
+#endif
+
+#ifdef USE_NVTX
+    nvtxRangeId_t rangeId = this->getOwnerTaskManager()->getProfiler()->startRangeWaitingForMemory();
+#endif
+
+#ifdef PROFILE
+    auto start = std::chrono::high_resolution_clock::now();
+#endif
+    this->getOwnerTaskManager()->releaseFairShare();
+    this->getOwnerTaskManager()->releaseResources();
+    HTGS_FLIGHT_RECORD(this->getOwnerTaskManager()->getFlightRecorderId(), FlightEventType::MemoryWaitStart, count);
+    std::list<m_data_t<V>> memoryList = connector->consumeDataBatch(count);
+    HTGS_FLIGHT_RECORD(this->getOwnerTaskManager()->getFlightRecorderId(), FlightEventType::MemoryWaitEnd, count);
+    this->getOwnerTaskManager()->acquireResources();
+    this->getOwnerTaskManager()->acquireFairShare();
+
+#ifdef USE_NVTX
+    this->getOwnerTaskManager()->getProfiler()->endRangeWaitingForMem(rangeId);
+#endif
+
+#ifdef PROFILE
+    auto finish = std::chrono::high_resolution_clock::now();
+    this->incMemoryWaitTime(std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count());
+#endif
+
+#ifdef WS_PROFILE
+    sendWSProfileUpdate(StatusCode::EXECUTE);
+#endif
+
+    std::vector<m_data_t<V>> memoryBatch(memoryList.begin(), memoryList.end());
+
+    for (m_data_t<V> memory : memoryBatch) {
+      memory->setMemoryReleaseRule(releaseRuleFactory());
+      memory->recordAcquired(this->getName(), this->getPipelineId(), this->getOwnerTaskManager()->getThreadId(),
+                             this->getOwnerTaskManager()->getFlightRecorderId());
+
+      if (memory->getType() != type) {
+        std::cerr
+            << "Error: Incorrect usage of getMemoryBatch. Dynamic memory managers use 'getDynamicMemoryBatch', Static memory managers use 'getMemoryBatch' for task '"
+            << this->getName() << "' on memory edge " << name << std::endl;
+        exit(-1);
+      }
+
+      if (type == MMType::Dynamic)
+        memory->memAlloc(nElem);
+    }
+
+    return memoryBatch;
+  }
+
   //! @endcond
 
   TaskManager<T, U> *ownerTask; //!< The owner task for this ITask
@@ -0,0 +1,251 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file IncrementalCache.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the IncrementalCache class, which re-executes a task graph only for the inputs that changed.
+ */
+#ifndef HTGS_INCREMENTALCACHE_HPP
+#define HTGS_INCREMENTALCACHE_HPP
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <htgs/api/ILineageData.hpp>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+namespace htgs {
+/**
+ * @class IncrementalCache IncrementalCache.hpp <htgs/api/IncrementalCache.hpp>
+ * @brief Caches the outputs of a task graph along with their lineage, so that later runs only re-execute the outputs
+ * that are affected by changed inputs.
+ *
+ * @details
+ * The inputs and outputs of the task graph must derive from ILineageData and have keys that are the same between
+ * runs. Each execution is given every current input and the keys of the inputs that changed (including added and
+ * removed inputs) since the previous execution. An output is affected if its lineage contains a changed input.
+ * Affected outputs are removed from the cache, and the inputs they were computed from are produced into the task graph
+ * along with the changed inputs. All other outputs are reused from the cache.
+ *
+ * The task graph must only emit an output once all of the inputs in its lineage have been received, which is the
+ * common case for IRules that join data. Outputs that are recomputed as a side effect, but were not affected, only
+ * replace the cached output if they were recomputed from all of the inputs in their recorded lineage.
+ * Outputs without a key are returned but never cached.
+ *
+ * Example usage:
+ * @code
+ * htgs::IncrementalCache<TileData, ResultData> cache;
+ *
+ * // First execution computes every output
+ * std::list<std::shared_ptr<ResultData>> results = cache.execute(createTaskGraph(), tiles);
+ *
+ * // Update two tiles and only re-execute the outputs that depend on them
+ * updateTiles(tiles, changedKeys);
+ * results = cache.execute(createTaskGraph(), tiles, changedKeys);
+ * @endcode
+ *
+ * @tparam T the input data type for the task graph, T must derive from ILineageData.
+ * @tparam U the output data type for the task graph, U must derive from ILineageData.
+ */
+template<class T, class U>
+class IncrementalCache {
+  static_assert(std::is_base_of<ILineageData, T>::value, "T must derive from ILineageData");
+  static_assert(std::is_base_of<ILineageData, U>::value, "U must derive from ILineageData");
+
+ public:
+  /**
+   * Constructs an empty IncrementalCache
+   */
+  IncrementalCache() {
+    this->hasExecuted = false;
+    this->numReused = 0;
+    this->numRecomputed = 0;
+    this->numReplaced = 0;
+    this->numInputsProduced = 0;
+  }
+
+  /**
+   * Executes the task graph with every input and replaces the contents of the cache with the outputs.
+   * @param taskGraph the task graph, which is executed and deleted by this function
+   * @param inputs the inputs to the task graph
+   * @return the outputs of the task graph
+   */
+  std::list<std::shared_ptr<U>> execute(TaskGraphConf<T, U> *taskGraph, const std::list<std::shared_ptr<T>> &inputs) {
+    this->clear();
+
+    std::list<std::shared_ptr<U>> uncached = this->run(taskGraph, inputs);
+    this->hasExecuted = true;
+    return this->collectOutputs(uncached);
+  }
+
+  /**
+   * Executes the task graph only for the outputs that are affected by the changed inputs, and reuses the cached
+   * outputs for the rest. If the cache has not been executed yet, then every input is executed.
+   * @param taskGraph the task graph, which is executed and deleted by this function
+   * @param inputs every current input to the task graph
+   * @param changedInputs the keys of the inputs that changed, were added, or were removed since the previous execution
+   * @return the outputs of the task graph, including the reused outputs
+   */
+  std::list<std::shared_ptr<U>> execute(TaskGraphConf<T, U> *taskGraph, const std::list<std::shared_ptr<T>> &inputs,
+                                        const std::set<std::string> &changedInputs) {
+    if (!this->hasExecuted)
+      return this->execute(taskGraph, inputs);
+
+    std::set<std::string> recomputeKeys = this->getInputsToRecompute(changedInputs);
+
+    for (const std::string &key : this->getAffectedOutputs(changedInputs))
+      this->cache.erase(key);
+
+    std::list<std::shared_ptr<T>> recomputeInputs;
+    for (auto &input : inputs)
+      if (recomputeKeys.find(input->getLineageKey()) != recomputeKeys.end())
+        recomputeInputs.push_back(input);
+
+    size_t numCached = this->cache.size();
+    std::list<std::shared_ptr<U>> uncached = this->run(taskGraph, recomputeInputs);
+    this->numReused = numCached - this->numReplaced;
+
+    return this->collectOutputs(uncached);
+  }
+
+  /**
+   * Gets the keys of the cached outputs that depend on any of the changed inputs
+   * @param changedInputs the keys of the inputs that changed
+   * @return the keys of the affected outputs
+   */
+  std::set<std::string> getAffectedOutputs(const std::set<std::string> &changedInputs) const {
+    std::set<std::string> affected;
+    for (auto &entry : this->cache)
+      if (entry.second->dependsOn(changedInputs))
+        affected.insert(entry.first);
+    return affected;
+  }
+
+  /**
+   * Gets the keys of the inputs that must be produced into the task graph to recompute the outputs that are
+   * affected by the changed inputs. This includes the changed inputs themselves.
+   * @param changedInputs the keys of the inputs that changed
+   * @return the keys of the inputs to recompute
+   */
+  std::set<std::string> getInputsToRecompute(const std::set<std::string> &changedInputs) const {
+    std::set<std::string> inputKeys(changedInputs);
+    for (auto &entry : this->cache)
+      if (entry.second->dependsOn(changedInputs)) {
+        std::set<std::string> lineage = entry.second->getLineage();
+        inputKeys.insert(lineage.begin(), lineage.end());
+      }
+    return inputKeys;
+  }
+
+  /**
+   * Gets the cached outputs, ordered by key
+   * @return the cached outputs
+   */
+  std::list<std::shared_ptr<U>> getCachedOutputs() const {
+    std::list<std::shared_ptr<U>> outputs;
+    for (auto &entry : this->cache)
+      outputs.push_back(entry.second);
+    return outputs;
+  }
+
+  /**
+   * Removes every output from the cache, so that the next execution computes every output
+   */
+  void clear() {
+    this->cache.clear();
+    this->hasExecuted = false;
+    this->numReused = 0;
+    this->numRecomputed = 0;
+    this->numReplaced = 0;
+    this->numInputsProduced = 0;
+  }
+
+  /**
+   * Gets the number of outputs that were reused from the cache by the last execution
+   * @return the number of reused outputs
+   */
+  size_t getNumReused() const { return numReused; }
+
+  /**
+   * Gets the number of outputs that were computed by the last execution
+   * @return the number of computed outputs
+   */
+  size_t getNumRecomputed() const { return numRecomputed; }
+
+  /**
+   * Gets the number of inputs that were produced into the task graph by the last execution
+   * @return the number of inputs produced
+   */
+  size_t getNumInputsProduced() const { return numInputsProduced; }
+
+ private:
+  //! @cond Doxygen_Suppress
+  std::list<std::shared_ptr<U>> run(TaskGraphConf<T, U> *taskGraph, const std::list<std::shared_ptr<T>> &inputs) {
+    std::list<std::shared_ptr<U>> uncached;
+    this->numRecomputed = 0;
+    this->numReplaced = 0;
+    this->numInputsProduced = inputs.size();
+
+    TaskGraphRuntime *runtime = new TaskGraphRuntime(taskGraph);
+    runtime->executeRuntime();
+
+    // Inputs have no recorded lineage, so their lineage is their own key and they are produced unchanged
+    for (auto &input : inputs)
+      taskGraph->produceData(input);
+    taskGraph->finishedProducingData();
+
+    while (!taskGraph->isOutputTerminated()) {
+      std::shared_ptr<U> output = taskGraph->consumeData();
+      if (output == nullptr)
+        continue;
+
+      this->numRecomputed++;
+      if (output->getLineageKey().empty()) {
+        uncached.push_back(output);
+        continue;
+      }
+
+      auto cached = this->cache.find(output->getLineageKey());
+      if (cached == this->cache.end()) {
+        this->cache.insert(std::make_pair(output->getLineageKey(), output));
+      } else if (covers(output->getLineage(), cached->second->getLineage())) {
+        cached->second = output;
+        this->numReplaced++;
+      }
+    }
+
+    runtime->waitForRuntime();
+    delete runtime;
+
+    return uncached;
+  }
+
+  std::list<std::shared_ptr<U>> collectOutputs(std::list<std::shared_ptr<U>> &uncached) const {
+    std::list<std::shared_ptr<U>> outputs = this->getCachedOutputs();
+    outputs.splice(outputs.end(), uncached);
+    return outputs;
+  }
+
+  static bool covers(const std::set<std::string> &lineage, const std::set<std::string> &recordedLineage) {
+    return std::includes(lineage.begin(), lineage.end(), recordedLineage.begin(), recordedLineage.end());
+  }
+  //! @endcond
+
+  std::map<std::string, std::shared_ptr<U>> cache; //!< The cached outputs, keyed by output key
+  bool hasExecuted; //!< Whether the cache holds the outputs of an execution
+  size_t numReused; //!< The number of outputs reused by the last execution
+  size_t numRecomputed; //!< The number of outputs computed by the last execution
+  size_t numReplaced; //!< The number of cached outputs that were replaced by recomputed outputs in the last execution
+  size_t numInputsProduced; //!< The number of inputs produced into the task graph by the last execution
+};
+}
+
+#endif //HTGS_INCREMENTALCACHE_HPP
@@ -21,6 +21,8 @@
 #include <htgs/api/IMemoryReleaseRule.hpp>
 #include <htgs/api/IData.hpp>
 #include <htgs/core/graph/Connector.hpp>
+#include <htgs/core/memory/MemoryOwnershipTracker.hpp>
+#include <htgs/log/FlightRecorder.hpp>
 
 namespace htgs {
 /**
@@ -91,6 +93,8 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
     this->pipelineId = 0;
     this->memoryReleaseRule = nullptr;
     this->memory = nullptr;
+    this->ownershipTracker = nullptr;
+    this->flightRecorderId = 0;
   }
 
   /**
@@ -117,6 +121,7 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
    * The memory will be recycled based on the specified htgs::IMemoryReleaseRule.
    */
   void releaseMemory() {
+    HTGS_FLIGHT_RECORD(this->flightRecorderId, FlightEventType::MemoryRelease, 1);
     std::shared_ptr<MemoryData<T>> mPtr = std::enable_shared_from_this<MemoryData<T>>::shared_from_this();
     std::shared_ptr<Connector<MemoryData<T>>> mConn = memoryManagerConnector.lock();
     if (mConn != nullptr)
@@ -138,6 +143,49 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
    */
   size_t getPipelineId() const { return this->pipelineId; }
 
+  /**
+   * Sets the connector that this MemoryData is released to
+   * @param connector the connector for the MemoryManager that is managing the memory
+   *
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  void setMemoryManagerConnector(std::weak_ptr<Connector<MemoryData<T>>> connector) {
+    this->memoryManagerConnector = connector;
+  }
+
+  /**
+   * Sets the tracker that records who holds this memory
+   * @param tracker the tracker, or nullptr if ownership is not tracked
+   *
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  void setOwnershipTracker(std::shared_ptr<MemoryOwnershipTracker> tracker) { this->ownershipTracker = tracker; }
+
+  /**
+   * Gets the tracker that records who holds this memory
+   * @return the tracker, or nullptr if ownership is not tracked
+   */
+  std::shared_ptr<MemoryOwnershipTracker> getOwnershipTracker() const { return this->ownershipTracker; }
+
+  /**
+   * Records the task that acquired this memory, if ownership is tracked
+   * @param taskName the name of the task
+   * @param pipelineId the pipeline id of the task
+   * @param threadId the thread id of the task
+   * @param flightRecorderId the flight recorder name id of the task, which the release of the memory is recorded with
+   *
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  void recordAcquired(std::string taskName, size_t pipelineId, size_t threadId, uint32_t flightRecorderId) {
+    this->flightRecorderId = flightRecorderId;
+    if (this->ownershipTracker != nullptr)
+      this->ownershipTracker->acquired(this, taskName, pipelineId, threadId,
+                                       this->memoryReleaseRule ? this->memoryReleaseRule->getState() : "");
+  }
+
   /**
    * Gets the size of the memory that was allocated
    * @return the memory size
@@ -250,6 +298,17 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
     }
   }
 
+  /**
+   * Resets the memory that this MemoryData is managing, so that it can be recycled (see IMemoryAllocator::memReset)
+   *
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  void memReset() {
+    if (this->memory)
+      this->allocator->memReset(this->memory);
+  }
+
   /**
    * Gets the type of memory that is associated with the memory manager
    * @return the type of memory (either Dynamic or Static)
@@ -266,12 +325,14 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
    * @internal
    */
   MemoryData<T> *copy() {
-    return new MemoryData<T>(this->allocator,
-                             this->memoryManagerConnector,
+    MemoryData<T> *memoryCopy = new MemoryData<T>(this->allocator,
+                                                  this->memoryManagerConnector,
       // TODO: Delete or Add #ifdef
-//                             this->address,
-                             this->memoryManagerName,
-                             this->type);
+//                                                  this->address,
+                                                  this->memoryManagerName,
+                                                  this->type);
+    memoryCopy->setOwnershipTracker(this->ownershipTracker);
+    return memoryCopy;
   }
 
   /**
@@ -302,6 +363,8 @@ class MemoryData : public IData, public std::enable_shared_from_this<MemoryData<
   size_t size; //!< The size of the memory (in elements)
   IMemoryReleaseRule *memoryReleaseRule; //!< The memory release rule associated with the memory
   std::shared_ptr<IMemoryAllocator<T>> allocator; //!< The allocator associated with the memory
+  std::shared_ptr<MemoryOwnershipTracker> ownershipTracker; //!< The tracker that records who holds the memory (nullptr if not tracked)
+  uint32_t flightRecorderId; //!< The flight recorder name id of the task that acquired the memory
 };
 }
 
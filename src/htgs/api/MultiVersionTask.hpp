@@ -0,0 +1,340 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file MultiVersionTask.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the MultiVersionTask, which selects among multiple ISA specific implementations of an ITask at initialization.
+ */
+#ifndef HTGS_MULTIVERSIONTASK_HPP
+#define HTGS_MULTIVERSIONTASK_HPP
+
+#include <algorithm>
+#include <map>
+#include <chrono>
+#include <stdexcept>
+#include <htgs/api/ITask.hpp>
+#include <htgs/types/ISAType.hpp>
+
+namespace htgs {
+
+/**
+ * @class MultiVersionTask MultiVersionTask.hpp <htgs/api/MultiVersionTask.hpp>
+ * @brief Holds multiple implementations (variants) of an ITask that are compiled for different instruction sets,
+ * and selects the best variant for the CPU when the task is initialized.
+ * @details
+ * Each variant is registered with the ISAType that it requires. When a thread initializes the MultiVersionTask,
+ * the variants are checked from the most capable ISAType to the least capable. The first variant that is supported
+ * by the CPU (see isISASupported) and passes calibrate() is selected. If no variant can be selected, initialize throws
+ * a std::runtime_error, so a variant for ISAType::Scalar should always be added. All of the other virtual functions of
+ * the ITask are then forwarded to the selected variant, and the time the selected variant waits for memory is reported
+ * for the MultiVersionTask.
+ *
+ * The functions that are used while setting up the TaskGraphRuntime, such as canUseSpscQueue, canPullData and
+ * getResourceClasses, are queried before a variant is selected, so they combine the answers of all variants.
+ *
+ * The selected variant is shared with the owner TaskManager, so the variant can use addResult and getMemory
+ * as if it had been added to the TaskGraphConf directly. Memory edges must be attached to the MultiVersionTask.
+ *
+ * The selected ISAType is added to the dot profile output and printProfile.
+ *
+ * Example usage:
+ * @code
+ * htgs::MultiVersionTask<MatrixData, MatrixData> *mulTask = new htgs::MultiVersionTask<MatrixData, MatrixData>(numThreads, "MatMul");
+ * mulTask->addVariant(htgs::ISAType::Scalar, new MatMulTask());
+ * mulTask->addVariant(htgs::ISAType::AVX2, new MatMulAVX2Task());
+ * mulTask->addVariant(htgs::ISAType::AVX512, new MatMulAVX512Task());
+ *
+ * taskGraph->addEdge(readTask, mulTask);
+ * @endcode
+ *
+ * To validate a variant prior to selecting it, inherit from MultiVersionTask and override calibrate. The copy function
+ * must also be overridden, which can use copyVariants to copy the variants into the new instance.
+ *
+ * @tparam T the input data type for the MultiVersionTask, T must derive from IData.
+ * @tparam U the output data type for the MultiVersionTask, U must derive from IData.
+ */
+template<class T, class U>
+class MultiVersionTask : public ITask<T, U> {
+ public:
+
+  /**
+   * Creates a MultiVersionTask with no variants
+   * @param numThreads the number of threads for the task
+   * @param name the name of the task
+   */
+  MultiVersionTask(size_t numThreads, std::string name = "MultiVersionTask") :
+      ITask<T, U>(numThreads), name(name), selected(nullptr), selectedISA(ISAType::Scalar), calibrationTime(0),
+      variantMemoryWaitTime(0) {}
+
+  /**
+   * Destructor, deletes all variants
+   */
+  ~MultiVersionTask() override {
+    for (auto variant : variants) {
+      delete variant.second;
+    }
+    variants.clear();
+  }
+
+  /**
+   * Adds a variant to the MultiVersionTask
+   * @param isa the instruction set the variant requires
+   * @param variant the variant
+   * @note Only one variant can be added for each ISAType
+   */
+  void addVariant(ISAType isa, ITask<T, U> *variant) {
+    if (variants.find(isa) != variants.end())
+      throw std::runtime_error(
+          "Error MultiVersionTask: " + this->getName() + " already has a variant for ISA " + isaTypeName(isa));
+
+    variants.insert(std::pair<ISAType, ITask<T, U> *>(isa, variant));
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////
+  ////////////////////// VIRTUAL FUNCTIONS ///////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Virtual function that validates a variant prior to it being selected.
+   * Called after the variant has been initialized, so the variant may be used to run a quick test on known data.
+   * @param isa the instruction set of the variant
+   * @param variant the variant being validated
+   * @return whether the variant can be selected
+   * @retval TRUE if the variant is valid
+   * @retval FALSE if the variant should not be used, then the next most capable variant will be tried
+   */
+  virtual bool calibrate(ISAType isa, ITask<T, U> *variant) { return true; }
+
+  /**
+   * Selects the variant for the CPU and initializes it
+   * @throws std::runtime_error if no variant is supported by the CPU and passes calibrate
+   */
+  void initialize() override {
+    for (auto variant : variants) {
+      if (!isISASupported(variant.first))
+        continue;
+
+      ITask<T, U> *task = variant.second;
+      this->copyMemoryEdges(task);
+      task->initialize(this->getPipelineId(), this->getNumPipelines(), this->getOwnerTaskManager());
+
+      auto start = std::chrono::high_resolution_clock::now();
+      bool valid = calibrate(variant.first, task);
+      auto finish = std::chrono::high_resolution_clock::now();
+      this->calibrationTime += std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+
+      if (valid) {
+        selected = task;
+        selectedISA = variant.first;
+        break;
+      }
+
+      task->shutdown();
+    }
+
+    if (selected == nullptr)
+      throw std::runtime_error("Error MultiVersionTask: " + this->getName()
+                                   + " does not have a variant that is supported by this CPU and passes calibration");
+
+    HTGS_DEBUG(this->getName() << " selected variant " << isaTypeName(selectedISA));
+  }
+
+  void executeTask(std::shared_ptr<T> data) override {
+    selected->executeTask(data);
+    updateMemoryWaitTime();
+  }
+
+  void executeTimer(uint64_t timerId) override {
+    if (selected != nullptr) {
+      selected->executeTimer(timerId);
+      updateMemoryWaitTime();
+    }
+  }
+
+  void prefetch(std::shared_ptr<T> next) override {
+    selected->prefetch(next);
+  }
+
+  size_t getPrefetchDepth() override {
+    return selected == nullptr ? 0 : selected->getPrefetchDepth();
+  }
+
+  bool canTerminate(std::shared_ptr<AnyConnector> inputConnector) override {
+    if (selected == nullptr)
+      return ITask<T, U>::canTerminate(inputConnector);
+    return selected->canTerminate(inputConnector);
+  }
+
+  void shutdown() override {
+    if (selected != nullptr)
+      selected->shutdown();
+  }
+
+  void executeTaskFinal() override {
+    if (selected != nullptr) {
+      selected->executeTaskFinal();
+      updateMemoryWaitTime();
+    }
+  }
+
+  bool canPauseForCheckpoint() override {
+    for (auto variant : variants) {
+      if (!variant.second->canPauseForCheckpoint())
+        return false;
+    }
+    return true;
+  }
+
+  bool canUseSpscQueue() override {
+    for (auto variant : variants) {
+      if (!variant.second->canUseSpscQueue())
+        return false;
+    }
+    return true;
+  }
+
+  bool canPullData() override {
+    for (auto variant : variants) {
+      if (!variant.second->canPullData())
+        return false;
+    }
+    return true;
+  }
+
+  std::vector<std::string> getResourceClasses() override {
+    std::vector<std::string> resourceClasses;
+    for (auto variant : variants) {
+      for (const std::string &resourceClass : variant.second->getResourceClasses()) {
+        if (std::find(resourceClasses.begin(), resourceClasses.end(), resourceClass) == resourceClasses.end())
+          resourceClasses.push_back(resourceClass);
+      }
+    }
+    return resourceClasses;
+  }
+
+  std::map<std::string, size_t> getTuningParameters() override {
+    if (selected != nullptr)
+      return selected->getTuningParameters();
+
+    std::map<std::string, size_t> parameters;
+    for (auto variant : variants) {
+      auto variantParameters = variant.second->getTuningParameters();
+      parameters.insert(variantParameters.begin(), variantParameters.end());
+    }
+    return parameters;
+  }
+
+  void setTuningParameter(std::string name, size_t value) override {
+    for (auto variant : variants) {
+      variant.second->setTuningParameter(name, value);
+    }
+  }
+
+  void gatherProfileData(std::map<AnyTaskManager *, TaskManagerProfile *> *taskManagerProfiles) override {
+    if (selected != nullptr)
+      selected->gatherProfileData(taskManagerProfiles);
+  }
+
+  void profile() override {
+    if (selected != nullptr)
+      selected->profile();
+  }
+
+  std::string profileStr() override {
+    return selected == nullptr ? "" : selected->profileStr();
+  }
+
+  void debug() override {
+    if (selected != nullptr)
+      selected->debug();
+  }
+
+  std::string getName() override {
+    return name;
+  }
+
+  std::string getDotCustomProfile() override {
+    if (selected == nullptr)
+      return "";
+
+    std::string variantProfile = selected->getDotCustomProfile();
+    return "ISA: " + isaTypeName(selectedISA)
+        + (calibrationTime == 0 ? "" : "\\nCalibration: " + std::to_string(calibrationTime) + " us")
+        + (variantProfile == "" ? "" : "\\n" + variantProfile);
+  }
+
+  void printProfile() override {
+    if (selected != nullptr) {
+      std::cout << this->getName() << " selected ISA: " << isaTypeName(selectedISA)
+                << " calibration time: " << calibrationTime << " us" << std::endl;
+      selected->printProfile();
+    }
+  }
+
+  MultiVersionTask<T, U> *copy() override {
+    MultiVersionTask<T, U> *task = new MultiVersionTask<T, U>(this->getNumThreads(), this->name);
+    copyVariants(task);
+    return task;
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////
+  //////////////////////// CLASS FUNCTIONS ///////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////
+
+  /**
+   * Copies all of the variants into another MultiVersionTask.
+   * @param task the MultiVersionTask to receive the copies
+   */
+  void copyVariants(MultiVersionTask<T, U> *task) {
+    for (auto variant : variants) {
+      task->addVariant(variant.first, variant.second->copy());
+    }
+  }
+
+  /**
+   * Gets the ISAType of the selected variant
+   * @return the selected ISAType
+   * @note Only valid after the task has been initialized
+   */
+  ISAType getSelectedISA() const { return selectedISA; }
+
+  /**
+   * Gets the selected variant
+   * @return the selected variant, or nullptr if the task has not been initialized
+   */
+  ITask<T, U> *getSelectedVariant() const { return selected; }
+
+  /**
+   * Gets the time spent calibrating variants
+   * @return the calibration time in microseconds
+   */
+  unsigned long long int getCalibrationTime() const { return calibrationTime; }
+
+ private:
+  /**
+   * Adds the time the selected variant has waited for memory since the last update to this task, so that the
+   * memory wait time is reported by the TaskManager of this task.
+   */
+  void updateMemoryWaitTime() {
+    unsigned long long int waitTime = selected->getMemoryWaitTime();
+    if (waitTime != variantMemoryWaitTime) {
+      this->incMemoryWaitTime(waitTime - variantMemoryWaitTime);
+      variantMemoryWaitTime = waitTime;
+    }
+  }
+
+  std::string name; //!< The name of the task
+  std::map<ISAType, ITask<T, U> *, std::greater<ISAType>> variants; //!< The variants, ordered from most to least capable ISA
+  ITask<T, U> *selected; //!< The selected variant
+  ISAType selectedISA; //!< The ISA of the selected variant
+  unsigned long long int calibrationTime; //!< The time spent calibrating variants (in microseconds)
+  unsigned long long int variantMemoryWaitTime; //!< The memory wait time of the selected variant that has been added to this task
+};
+}
+
+#endif //HTGS_MULTIVERSIONTASK_HPP
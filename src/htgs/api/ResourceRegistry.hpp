@@ -0,0 +1,289 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ResourceRegistry.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the ResourceRegistry, which limits how many tasks use a shared resource at the same time.
+ */
+#ifndef HTGS_RESOURCEREGISTRY_HPP
+#define HTGS_RESOURCEREGISTRY_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace htgs {
+
+/**
+ * @class ResourceClass ResourceRegistry.hpp <htgs/api/ResourceRegistry.hpp>
+ * @brief A shared resource, such as a disk or the memory bandwidth, that a limited number of task threads use at
+ * the same time.
+ *
+ * @details
+ * A thread acquires a slot from each resource class of its task (see AnyITask::getResourceClasses) prior to
+ * executing the task and releases the slots afterwards. Threads are parked while the limit of a class is reached.
+ * The time that threads were parked is accumulated for each class, so an oversubscribed resource can be found.
+ *
+ * A ResourceClass is created by ResourceRegistry::getResourceClass.
+ */
+class ResourceClass {
+ public:
+  /**
+   * Constructs a resource class
+   * @param name the name of the class
+   * @param limit the maximum number of threads that use the resource at the same time, or 0 for no limit
+   */
+  ResourceClass(std::string name, size_t limit) :
+      name(name), limit(limit), numRunning(0), maxRunning(0), numAcquired(0), numWaits(0), waitTime(0) {}
+
+  /**
+   * Acquires a slot, parking the calling thread until fewer than the limit of threads use the resource
+   */
+  void acquire() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (!canRun()) {
+      auto start = std::chrono::steady_clock::now();
+      this->condition.wait(lock, [&] { return this->canRun(); });
+      this->numWaits++;
+      this->waitTime += (unsigned long long int)
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    this->numRunning++;
+    this->numAcquired++;
+    this->maxRunning = std::max(this->maxRunning, this->numRunning);
+  }
+
+  /**
+   * Releases a slot
+   */
+  void release() {
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->numRunning--;
+    }
+    this->condition.notify_one();
+  }
+
+  /**
+   * Sets the maximum number of threads that use the resource at the same time. Parked threads are woken if the
+   * limit is raised.
+   * @param limit the limit, or 0 for no limit
+   */
+  void setLimit(size_t limit) {
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->limit = limit;
+    }
+    this->condition.notify_all();
+  }
+
+  /**
+   * Gets the maximum number of threads that use the resource at the same time
+   * @return the limit, or 0 if there is no limit
+   */
+  size_t getLimit() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->limit;
+  }
+
+  /**
+   * Gets the name of the class
+   * @return the name
+   */
+  std::string getName() const { return name; }
+
+  /**
+   * Gets the number of threads that are currently using the resource
+   * @return the number of threads holding a slot
+   */
+  size_t getNumRunning() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->numRunning;
+  }
+
+  /**
+   * Gets the largest number of threads that used the resource at the same time
+   * @return the peak number of threads holding a slot
+   */
+  size_t getMaxRunning() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->maxRunning;
+  }
+
+  /**
+   * Gets the number of times a slot was acquired
+   * @return the number of acquires
+   */
+  size_t getNumAcquired() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->numAcquired;
+  }
+
+  /**
+   * Gets the number of times a thread was parked because the limit was reached
+   * @return the number of waits
+   */
+  size_t getNumWaits() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->numWaits;
+  }
+
+  /**
+   * Gets the total time that threads were parked waiting for a slot
+   * @return the wait time in microseconds
+   */
+  unsigned long long int getWaitTime() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->waitTime;
+  }
+
+  /**
+   * Resets the profile of the class, keeping its limit
+   */
+  void resetProfile() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->maxRunning = this->numRunning;
+    this->numAcquired = 0;
+    this->numWaits = 0;
+    this->waitTime = 0;
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  // Must hold the mutex
+  bool canRun() const { return this->limit == 0 || this->numRunning < this->limit; }
+  //! @endcond
+
+  std::string name; //!< The name of the class
+  size_t limit; //!< The maximum number of threads that use the resource at the same time (0 for no limit)
+  size_t numRunning; //!< The number of threads holding a slot
+  size_t maxRunning; //!< The largest number of threads that held a slot at the same time
+  size_t numAcquired; //!< The number of times a slot was acquired
+  size_t numWaits; //!< The number of times a thread was parked waiting for a slot
+  unsigned long long int waitTime; //!< The total time threads were parked waiting for a slot in microseconds
+  std::mutex mutex; //!< The mutex to ensure thread safety
+  std::condition_variable condition; //!< The condition variable used for parking and unparking threads
+};
+
+/**
+ * @class ResourceRegistry ResourceRegistry.hpp <htgs/api/ResourceRegistry.hpp>
+ * @brief Holds the resource classes that are shared by the tasks of one or more task graphs, and their concurrency
+ * limits.
+ *
+ * @details
+ * Tasks declare the resources that they use by overriding AnyITask::getResourceClasses, for example a task streaming
+ * from a disk returns "disk" and a task copying large buffers returns "membw". The limit of each class is set with
+ * setLimit and applies across all tasks and task graphs using the registry, independently of the number of threads of
+ * each task. Classes without a limit are only profiled.
+ *
+ * Slots are held while a task executes (ITask::executeTask and ITask::executeTaskFinal). Threads that are waiting for
+ * input data or for memory from a memory edge do not hold a slot. A task with several classes acquires them in order
+ * of their names, so tasks sharing classes cannot deadlock.
+ *
+ * Each TaskGraphRuntime uses the process-wide registry unless another registry is set with
+ * TaskGraphRuntime::setResourceRegistry. The sub-graphs of an ExecutionPipeline or TGTask use the registry of their
+ * parent graph.
+ *
+ * Example Usage:
+ * @code
+ * class ReadTask : public htgs::ITask<Request, Block> {
+ *   ...
+ *   std::vector<std::string> getResourceClasses() override { return {"disk"}; }
+ * };
+ *
+ * htgs::ResourceRegistry::getProcessRegistry()->setLimit("disk", 2);
+ *
+ * htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(taskGraph);
+ * runtime->executeRuntime();
+ * ...
+ * runtime->waitForRuntime();
+ * htgs::ResourceRegistry::getProcessRegistry()->printProfile();
+ * @endcode
+ */
+class ResourceRegistry {
+ public:
+  /**
+   * Gets the process-wide registry
+   * @return the process-wide registry
+   */
+  static std::shared_ptr<ResourceRegistry> getProcessRegistry() {
+    static std::shared_ptr<ResourceRegistry> processRegistry = std::make_shared<ResourceRegistry>();
+    return processRegistry;
+  }
+
+  /**
+   * Gets a resource class, creating it without a limit if it does not exist
+   * @param name the name of the class
+   * @return the resource class
+   */
+  std::shared_ptr<ResourceClass> getResourceClass(std::string name) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    std::shared_ptr<ResourceClass> &resourceClass = this->classes[name];
+    if (resourceClass == nullptr)
+      resourceClass = std::make_shared<ResourceClass>(name, 0);
+    return resourceClass;
+  }
+
+  /**
+   * Gets the resource classes for a list of names, ordered by name and without duplicates, which is the order that
+   * the slots are acquired in
+   * @param names the names of the classes
+   * @return the resource classes
+   */
+  std::vector<std::shared_ptr<ResourceClass>> getResourceClasses(std::vector<std::string> names) {
+    std::sort(names.begin(), names.end());
+    names.erase(std::unique(names.begin(), names.end()), names.end());
+
+    std::vector<std::shared_ptr<ResourceClass>> resourceClasses;
+    for (auto &name : names)
+      resourceClasses.push_back(getResourceClass(name));
+    return resourceClasses;
+  }
+
+  /**
+   * Sets the maximum number of threads that use a resource at the same time
+   * @param name the name of the class
+   * @param limit the limit, or 0 for no limit
+   */
+  void setLimit(std::string name, size_t limit) {
+    getResourceClass(name)->setLimit(limit);
+  }
+
+  /**
+   * Prints the limit, peak concurrency and wait time for each resource class
+   * @param os the output stream
+   */
+  void printProfile(std::ostream &os = std::cout) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    os << "Resource classes:" << std::endl;
+    for (auto &entry : this->classes) {
+      ResourceClass *resourceClass = entry.second.get();
+      size_t limit = resourceClass->getLimit();
+      os << std::setw(20) << entry.first
+         << " limit: " << (limit == 0 ? std::string("none") : std::to_string(limit))
+         << " peak: " << resourceClass->getMaxRunning()
+         << " acquired: " << resourceClass->getNumAcquired()
+         << " waits: " << resourceClass->getNumWaits()
+         << " wait time: " << resourceClass->getWaitTime() << " us" << std::endl;
+    }
+  }
+
+ private:
+  std::map<std::string, std::shared_ptr<ResourceClass>> classes; //!< The resource classes by name
+  std::mutex mutex; //!< Protects the resource classes
+};
+}
+
+#endif //HTGS_RESOURCEREGISTRY_HPP
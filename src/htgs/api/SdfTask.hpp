@@ -0,0 +1,303 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file SdfTask.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the SdfTask, which executes a synchronous dataflow chain of tasks with a static schedule.
+ */
+#ifndef HTGS_SDFTASK_HPP
+#define HTGS_SDFTASK_HPP
+
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+#include <htgs/api/ITask.hpp>
+#include <htgs/core/task/SdfStage.hpp>
+
+namespace htgs {
+
+/**
+ * @class SdfTask SdfTask.hpp <htgs/api/SdfTask.hpp>
+ * @brief Executes a synchronous dataflow (SDF) chain of ITasks with a static periodic schedule.
+ * @details
+ * Each edge within the SdfTask declares the rate of the producer, which is the number of data the producer adds as
+ * results each time it executes on one data. Using the rates, the SdfTask computes the number of times each ITask
+ * executes for one input data (the repetition vector) and a looped schedule that fires each consumer immediately
+ * for each of its producer's results. For example, the rates A -(4)-> B -(2)-> C result in the schedule
+ * A (4 B (2 C)), where A executes once, B four times and C eight times per input data.
+ *
+ * Each thread of the SdfTask executes complete periods of the schedule on its own copies of the ITasks. Data is
+ * passed between the ITasks through buffers that are preallocated using the rates, so there are no connectors,
+ * blocking queues or condition variables within the chain. The SdfTask itself is added to a TaskGraphConf like any
+ * other ITask, so the rest of the graph executes dynamically.
+ *
+ * If an ITask produces a different number of data than declared, the data is still passed on in order, the buffer
+ * grows as needed, and the violation is counted (see getNumRateViolations).
+ *
+ * Example Usage:
+ * @code
+ * htgs::SdfTask<TileData, ResultData> *sdfTask = new htgs::SdfTask<TileData, ResultData>(numThreads, "TileChain");
+ *
+ * // DecomposeTask produces 4 sub-tiles per tile, ProcessTask produces 1 result per sub-tile
+ * sdfTask->addEdge(decomposeTask, processTask, 4);
+ * sdfTask->addEdge(processTask, reduceTask, 1);
+ *
+ * taskGraph->addEdge(readTask, sdfTask);
+ * taskGraph->addEdge(sdfTask, writeTask);
+ * @endcode
+ *
+ * @note The ITasks within an SdfTask must form a single chain. They cannot be attached to memory edges or rules,
+ * and their threads are given by the SdfTask rather than by each ITask. Edges that break the chain throw a
+ * std::runtime_error from addEdge, or when the schedule is first built (such as when the TaskGraphRuntime copies the
+ * SdfTask for its threads).
+ *
+ * @tparam T the input data type for the SdfTask, T must derive from IData and match the input type of the first ITask.
+ * @tparam U the output data type for the SdfTask, U must derive from IData and match the output type of the last ITask.
+ */
+template<class T, class U>
+class SdfTask : public ITask<T, U> {
+  static_assert(std::is_base_of<IData, T>::value, "T must derive from IData");
+  static_assert(std::is_base_of<IData, U>::value, "U must derive from IData");
+
+ public:
+  /**
+   * Constructs an SdfTask with no ITasks
+   * @param numThreads the number of threads that each execute complete periods of the schedule
+   * @param name the name of the SdfTask
+   */
+  SdfTask(size_t numThreads, std::string name = "SdfTask") : ITask<T, U>(numThreads), name(name),
+                                                             numRateViolations(0) {}
+
+  /**
+   * Destructor
+   */
+  ~SdfTask() override {
+    for (AnySdfStage *stage : stages)
+      delete stage;
+    stages.clear();
+  }
+
+  /**
+   * Adds an edge between two ITasks of the chain
+   * @tparam V the input type for the producer task
+   * @tparam W the output/input types for the producer/consumer tasks
+   * @tparam X the output type for the consumer task
+   * @param producer the task that is producing data
+   * @param consumer the task that consumes the data from the producer task
+   * @param rate the number of data the producer adds as results each time it executes on one data
+   * @throws std::runtime_error if the rate is 0, or if the producer already has a consumer or the consumer already
+   * has a producer
+   */
+  template<class V, class W, class X>
+  void addEdge(ITask<V, W> *producer, ITask<W, X> *consumer, size_t rate) {
+    if (rate == 0)
+      throw std::runtime_error("Error SdfTask: " + name + " edge from " + producer->getName() + " to "
+                                   + consumer->getName() + " must have a rate greater than 0");
+    if (successors.find(producer) != successors.end())
+      throw std::runtime_error("Error SdfTask: " + name + " task " + producer->getName()
+                                   + " already has a consumer, an SdfTask only supports chains");
+    if (consumers.find(consumer) != consumers.end())
+      throw std::runtime_error("Error SdfTask: " + name + " task " + consumer->getName()
+                                   + " already has a producer, an SdfTask only supports chains");
+
+    addStage(producer);
+    addStage(consumer);
+
+    successors.insert(std::make_pair(producer, std::make_pair(consumer, rate)));
+    consumers.insert(consumer);
+  }
+
+  void initialize() override {
+    buildSchedule();
+
+    for (size_t i = 0; i < prototypes.size(); i++) {
+      AnySdfStage *stage = prototypes[i]->copy(this->getPipelineId(), this->getNumPipelines(), this->getAddress());
+      stage->reserveOutputs(i < rates.size() ? rates[i] : 1);
+      stage->initialize();
+      stages.push_back(stage);
+    }
+  }
+
+  void executeTask(std::shared_ptr<T> data) override {
+    fire(0, data);
+  }
+
+  /**
+   * Executes each ITask's executeTaskFinal in chain order, passing its results through the rest of the chain
+   */
+  void executeTaskFinal() override {
+    for (size_t i = 0; i < stages.size(); i++) {
+      stages[i]->fireFinal();
+      forward(i, false);
+    }
+  }
+
+  void shutdown() override {
+    for (AnySdfStage *stage : stages)
+      stage->shutdown();
+  }
+
+  std::string getName() override {
+    return name;
+  }
+
+  SdfTask<T, U> *copy() override {
+    buildSchedule();
+    return new SdfTask<T, U>(this->getNumThreads(), name, prototypes, rates, repetitions);
+  }
+
+  std::string getDotCustomProfile() override {
+    std::string ret = "schedule: " + getScheduleString();
+#ifdef PROFILE
+    for (AnySdfStage *stage : stages)
+      ret += "\\n" + stage->getName() + ": " + std::to_string((double) stage->getComputeTime() / 1000000.0) + " s";
+#endif
+    if (numRateViolations > 0)
+      ret += "\\nrateViolations: " + std::to_string(numRateViolations);
+    return ret;
+  }
+
+  /**
+   * Gets the looped schedule for one input data, such as A (4 B (2 C))
+   * @return the schedule
+   */
+  std::string getScheduleString() {
+    buildSchedule();
+    if (prototypes.empty())
+      return "";
+
+    std::string schedule = prototypes.back()->getName();
+    for (size_t i = rates.size(); i > 0; i--)
+      schedule = prototypes[i - 1]->getName() + " (" + std::to_string(rates[i - 1]) + " " + schedule + ")";
+    return schedule;
+  }
+
+  /**
+   * Gets the number of times each ITask executes for one input data, in chain order
+   * @return the repetition vector
+   */
+  const std::vector<size_t> &getRepetitions() {
+    buildSchedule();
+    return repetitions;
+  }
+
+  /**
+   * Gets the number of ITasks in the chain
+   * @return the number of ITasks
+   */
+  size_t getNumStages() {
+    buildSchedule();
+    return prototypes.size();
+  }
+
+  /**
+   * Gets the number of executions, from this thread of the SdfTask, that produced a different number of data than
+   * the rate declared for the ITask
+   * @return the number of rate violations
+   */
+  size_t getNumRateViolations() const {
+    return numRateViolations;
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  SdfTask(size_t numThreads, std::string name, const std::vector<std::shared_ptr<AnySdfStage>> &prototypes,
+          const std::vector<size_t> &rates, const std::vector<size_t> &repetitions) :
+      ITask<T, U>(numThreads), name(name), prototypes(prototypes), rates(rates), repetitions(repetitions),
+      numRateViolations(0) {}
+
+  template<class V, class W>
+  void addStage(ITask<V, W> *task) {
+    if (stageMap.find(task) == stageMap.end())
+      stageMap.insert(std::make_pair(task, std::shared_ptr<AnySdfStage>(new SdfStage<V, W>(task, 0, 1, ""))));
+  }
+
+  // Throws std::runtime_error if the ITasks do not form a single chain with the input and output types of the SdfTask
+  void buildSchedule() {
+    if (!prototypes.empty() || stageMap.empty())
+      return;
+
+    AnyITask *head = nullptr;
+    for (auto &stage : stageMap) {
+      if (consumers.find(stage.first) == consumers.end()) {
+        if (head != nullptr)
+          throw std::runtime_error("Error SdfTask: " + name + " has more than one first task, it must be a single chain");
+        head = stage.first;
+      }
+    }
+
+    if (head == nullptr)
+      throw std::runtime_error("Error SdfTask: " + name + " has no first task, it must not contain cycles");
+
+    // Built locally, so a failed schedule is not kept
+    std::vector<std::shared_ptr<AnySdfStage>> chain;
+    std::vector<size_t> chainRates;
+    for (AnyITask *task = head; task != nullptr && chain.size() < stageMap.size();) {
+      chain.push_back(stageMap[task]);
+
+      auto successor = successors.find(task);
+      if (successor == successors.end())
+        break;
+
+      chainRates.push_back(successor->second.second);
+      task = successor->second.first;
+    }
+
+    if (chain.size() != stageMap.size() || chainRates.size() != chain.size() - 1)
+      throw std::runtime_error("Error SdfTask: " + name + " must be a single chain without cycles");
+    if (chain.front()->inTypeName() != this->inTypeName())
+      throw std::runtime_error("Error SdfTask: " + name + " first task " + chain.front()->getName()
+                                   + " must have the input type " + this->inTypeName());
+    if (chain.back()->outTypeName() != this->outTypeName())
+      throw std::runtime_error("Error SdfTask: " + name + " last task " + chain.back()->getName()
+                                   + " must have the output type " + this->outTypeName());
+
+    prototypes = chain;
+    rates = chainRates;
+    repetitions.push_back(1);
+    for (size_t rate : rates)
+      repetitions.push_back(repetitions.back() * rate);
+  }
+
+  void fire(size_t stageId, std::shared_ptr<IData> data) {
+    stages[stageId]->fire(data);
+    forward(stageId, true);
+  }
+
+  void forward(size_t stageId, bool checkRate) {
+    AnySdfStage *stage = stages[stageId];
+    size_t numOutputs = stage->getNumOutputs();
+
+    if (checkRate && stageId < rates.size() && numOutputs != rates[stageId])
+      numRateViolations++;
+
+    for (size_t i = 0; i < numOutputs; i++) {
+      if (stageId + 1 < stages.size())
+        fire(stageId + 1, stage->getOutput(i));
+      else
+        this->addResult(std::static_pointer_cast<U>(stage->getOutput(i)));
+    }
+
+    stage->clearOutputs();
+  }
+  //! @endcond
+
+  std::string name; //!< The name of the SdfTask
+  std::map<AnyITask *, std::shared_ptr<AnySdfStage>> stageMap; //!< The stage for each ITask added with addEdge
+  std::map<AnyITask *, std::pair<AnyITask *, size_t>> successors; //!< The consumer and rate for each producer
+  std::set<AnyITask *> consumers; //!< The ITasks that consume data from another ITask of the chain
+  std::vector<std::shared_ptr<AnySdfStage>> prototypes; //!< The stages in chain order, copied by each thread
+  std::vector<size_t> rates; //!< The rate of each edge in chain order
+  std::vector<size_t> repetitions; //!< The number of executions of each ITask for one input data
+  std::vector<AnySdfStage *> stages; //!< The stages executed by this thread
+  size_t numRateViolations; //!< The number of executions that did not produce the declared rate
+};
+}
+
+#endif //HTGS_SDFTASK_HPP
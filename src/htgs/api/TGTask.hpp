@@ -89,8 +89,11 @@ namespace htgs {
 
       if (this->getOwnerTaskManager()->getOutputConnector() != nullptr) {
 
-        // Increment output to account for the updated output connector
-        this->getOwnerTaskManager()->getOutputConnector()->incrementInputTaskCount();
+        // Increment output to account for the producers of the task graph, which now produce for the updated output
+        // connector (a task graph may have several producers, such as an execution pipeline and a bookkeeper rule)
+        size_t numGraphProducers = taskGraphConf->getOutputConnector()->getProducerCount();
+        for (size_t i = 0; i < numGraphProducers; i++)
+          this->getOwnerTaskManager()->getOutputConnector()->incrementInputTaskCount();
         taskGraphConf->setOutputConnector(this->getOwnerTaskManager()->getOutputConnector());
 
       }
@@ -108,6 +111,9 @@ namespace htgs {
 
       // Launch the graph
       runtime = new TaskGraphRuntime(taskGraphConf);
+      runtime->setFairShareGroup(this->getOwnerTaskManager()->getFairShareGroup());
+      runtime->setResourceRegistry(this->getOwnerTaskManager()->getResourceRegistry());
+      runtime->setTimerWheel(this->getOwnerTaskManager()->getTimerWheel());
       runtime->executeRuntime();
 
       if (waitForInitialization)
@@ -205,6 +211,22 @@ namespace htgs {
       return true;
     }
 
+    /**
+     * The TGTask's connectors are used by the threads of its sub-graph, so they use blocking queues.
+     * @return false
+     */
+    bool canUseSpscQueue() override {
+      return false;
+    }
+
+    /**
+     * The TGTask's connectors are used by the threads of its sub-graph, so it does not pull data.
+     * @return false
+     */
+    bool canPullData() override {
+      return false;
+    }
+
     virtual std::string genDotProducerEdgeToTask(std::map<std::shared_ptr<AnyConnector>, AnyITask *> &inputConnectorDotMap, int dotFlags) override
     {
       return "";
@@ -14,10 +14,12 @@
 #define HTGS_TASKGRAPHCONF_HPP
 
 #include <htgs/core/graph/edge/ProducerConsumerEdge.hpp>
+#include <htgs/core/graph/edge/DeadlineEdge.hpp>
 #include <htgs/core/graph/edge/GraphTaskProducerEdge.hpp>
 #include <htgs/core/graph/edge/RuleEdge.hpp>
 #include <htgs/core/graph/edge/GraphEdge.hpp>
 #include <htgs/core/graph/edge/MemoryEdge.hpp>
+#include <htgs/api/IObjectAllocator.hpp>
 #include <htgs/core/comm/TaskGraphCommunicator.hpp>
 #include <htgs/core/graph/profile/TaskGraphProfiler.hpp>
 
@@ -391,6 +393,66 @@ class TaskGraphConf : public AnyTaskGraphConf {
     this->addEdgeDescriptor(pce);
   }
 
+  /**
+   * Adds an edge to the graph, where one task produces data for a consumer task that consumes the data in the order
+   * given by a queue discipline. For example, QueueDiscipline::LIFO processes recently produced data first, which keeps
+   * it in cache and bounds the data in flight when tiles are expanded depth first.
+   * @tparam V the input type for the producer task
+   * @tparam W the output/input types for the producer/consumer tasks
+   * @tparam X the output type for the consumer task
+   * @param producer the task that is producing data
+   * @param consumer the task that consumes the data from the producer task
+   * @param discipline the order in which the consumer consumes data
+   * @param lifoBound the number of data that are consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO
+   * @note The discipline applies to the consumer's input connector, which is shared by all edges into the consumer.
+   * Connectors with a discipline other than QueueDiscipline::FIFO keep their blocking queue (see
+   * AnyConnector::enableSpscQueue). If the USE_PRIORITY_QUEUE directive is defined, the discipline has no effect.
+   */
+  template<class V, class W, class X>
+  void addEdge(ITask<V, W> *producer, ITask<W, X> *consumer, QueueDiscipline discipline,
+               size_t lifoBound = HTGS_DEFAULT_LIFO_BOUND) {
+    auto pce = new ProducerConsumerEdge<V, W, X>(producer, consumer, discipline, lifoBound);
+    pce->applyEdge(this);
+    this->addEdgeDescriptor(pce);
+  }
+
+  /**
+   * Adds a deadline edge to the graph, where the consumer task processes data from the producer task in
+   * earliest deadline first order. Data that derives from IDeadlineData and has passed its deadline when
+   * it is consumed is dropped, and is counted as a deadline miss for the consumer task.
+   * @tparam V the input type for the producer task
+   * @tparam W the output/input types for the producer/consumer tasks
+   * @tparam X the output type for the consumer task
+   * @param producer the task that is producing data
+   * @param consumer the task that consumes the data from the producer task
+   * @note Dropped data is released as soon as it goes out of scope, so data that holds MemoryData should use a fallback task to release its memory.
+   */
+  template<class V, class W, class X>
+  void addDeadlineEdge(ITask<V, W> *producer, ITask<W, X> *consumer) {
+    auto de = new DeadlineEdge<V, W, X, X>(producer, consumer, nullptr);
+    de->applyEdge(this);
+    this->addEdgeDescriptor(de);
+  }
+
+  /**
+   * Adds a deadline edge to the graph, where the consumer task processes data from the producer task in
+   * earliest deadline first order. Data that derives from IDeadlineData and has passed its deadline when
+   * it is consumed is diverted to the fallback task, and is counted as a deadline miss for the consumer task.
+   * @tparam V the input type for the producer task
+   * @tparam W the output/input types for the producer/consumer/fallback tasks
+   * @tparam X the output type for the consumer task
+   * @tparam Y the output type for the fallback task
+   * @param producer the task that is producing data
+   * @param consumer the task that consumes the data from the producer task
+   * @param fallback the task that consumes expired data
+   */
+  template<class V, class W, class X, class Y>
+  void addDeadlineEdge(ITask<V, W> *producer, ITask<W, X> *consumer, ITask<W, Y> *fallback) {
+    auto de = new DeadlineEdge<V, W, X, Y>(producer, consumer, fallback);
+    de->applyEdge(this);
+    this->addEdgeDescriptor(de);
+  }
+
   /**
    * Creates a rule edge that is managed by a bookkeeper
    * @tparam V the input type for the bookkeeper and rule
@@ -574,6 +636,115 @@ class TaskGraphConf : public AnyTaskGraphConf {
     this->addEdgeDescriptor(memEdge);
   }
 
+  /**
+   * Adds an object pool edge with the specified name to the TaskGraphConf. The edge is a static MemoryManager edge whose
+   * pool holds objectPoolSize fully constructed objects (see IObjectAllocator). Objects are reset when their memory
+   * release rule allows them to be recycled, so they are reused across data and by all copies of getMemoryTask.
+   * @param name the name of the memory edge, should be unique compared to all memory edges added to the TaskGraphConf and any TaskGraphConf within an ExecutionPipeline
+   * @param getMemoryTask the ITask that is getting objects
+   * @param allocator the allocator describing how objects are constructed, reset, and destroyed
+   * @param objectPoolSize the number of objects in the pool
+   * @tparam V the type of object
+   */
+  template<class V>
+  void addObjectPoolEdge(std::string name, AnyITask *getMemoryTask, IObjectAllocator<V> *allocator,
+                         size_t objectPoolSize) {
+    this->addMemoryManagerEdge<V>(name, getMemoryTask, allocator, objectPoolSize, MMType::Static);
+  }
+
+  /**
+   * Adds an object pool edge with the specified name to the TaskGraphConf (see addObjectPoolEdge).
+   * @param name the name of the memory edge, should be unique compared to all memory edges added to the TaskGraphConf and any TaskGraphConf within an ExecutionPipeline
+   * @param getMemoryTask the ITask that is getting objects
+   * @param allocator the allocator describing how objects are constructed, reset, and destroyed
+   * @param objectPoolSize the number of objects in the pool
+   * @tparam V the type of object
+   * @note Use this function if the allocator is shared among multiple graphs that you create.
+   */
+  template<class V>
+  void addObjectPoolEdge(std::string name, AnyITask *getMemoryTask, std::shared_ptr<IObjectAllocator<V>> allocator,
+                         size_t objectPoolSize) {
+    this->addMemoryManagerEdge<V>(name, getMemoryTask, allocator, objectPoolSize, MMType::Static);
+  }
+
+  /**
+   * Adds a MemoryManager edge with the specified name to the TaskGraphConf, which shares a pool of memory
+   * among all pipelines when the TaskGraphConf is copied by an ExecutionPipeline.
+   * Each pipeline reserves reservedPoolSize elements of memory. Once a pipeline has used all of its reserved memory,
+   * its MemoryManager borrows memory from the shared pool of sharedPoolSize elements. Borrowed memory is returned
+   * to the shared pool once it is released. Borrowing is polled, so a pipeline that has used all of its reserved memory
+   * waits up to lendTimeout microseconds for each element it borrows (see MemoryManager).
+   * @param name the name of the memory edge, should be unique compared to all memory edges added to the TaskGraphConf and any TaskGraphConf within an ExecutionPipeline
+   * @param getMemoryTask the ITask that is getting memory
+   * @param allocator the allocator describing how memory is allocated
+   * @param reservedPoolSize the size of the memory pool that is reserved for each pipeline
+   * @param sharedPoolSize the size of the memory pool that is shared among all pipelines
+   * @param type the type of memory manager
+   * @param lendTimeout the timeout time in microseconds between checks for lending memory from the shared pool
+   * @note The total memory allocated is reservedPoolSize * numPipelines + sharedPoolSize
+   * @note The reservedPoolSize should be large enough to satisfy the release rules of a single pipeline.
+   * @tparam V the type of memory; i.e., 'double'
+   */
+  template<class V, class IMemoryAllocatorType>
+  void addSharedMemoryManagerEdge(std::string name,
+                                  AnyITask *getMemoryTask,
+                                  std::shared_ptr<IMemoryAllocatorType> allocator,
+                                  size_t reservedPoolSize,
+                                  size_t sharedPoolSize,
+                                  MMType type,
+                                  size_t lendTimeout = 1000) {
+    static_assert(std::is_base_of<IMemoryAllocator<V>, IMemoryAllocatorType>::value,
+                  "Type mismatch for allocator, allocator must be a MemoryAllocator!");
+
+    std::shared_ptr<IMemoryAllocator<V>> memAllocator = std::static_pointer_cast<IMemoryAllocator<V>>(allocator);
+    std::shared_ptr<SharedMemoryPool<V>> sharedPool(new SharedMemoryPool<V>(sharedPoolSize));
+
+    MemoryManager<V> *memoryManager = new MemoryManager<V>(name, reservedPoolSize, sharedPool, memAllocator, type,
+                                                           lendTimeout);
+
+    MemoryEdge<V> *memEdge = new MemoryEdge<V>(name, getMemoryTask, memoryManager);
+    memEdge->applyEdge(this);
+    this->addEdgeDescriptor(memEdge);
+  }
+
+  /**
+   * Adds a MemoryManager edge with the specified name to the TaskGraphConf, which shares a pool of memory
+   * among all pipelines when the TaskGraphConf is copied by an ExecutionPipeline.
+   * Each pipeline reserves reservedPoolSize elements of memory. Once a pipeline has used all of its reserved memory,
+   * its MemoryManager borrows memory from the shared pool of sharedPoolSize elements. Borrowed memory is returned
+   * to the shared pool once it is released. Borrowing is polled, so a pipeline that has used all of its reserved memory
+   * waits up to lendTimeout microseconds for each element it borrows (see MemoryManager).
+   * @param name the name of the memory edge, should be unique compared to all memory edges added to the TaskGraphConf and any TaskGraphConf within an ExecutionPipeline
+   * @param getMemoryTask the ITask that is getting memory
+   * @param allocator the allocator describing how memory is allocated
+   * @param reservedPoolSize the size of the memory pool that is reserved for each pipeline
+   * @param sharedPoolSize the size of the memory pool that is shared among all pipelines
+   * @param type the type of memory manager
+   * @param lendTimeout the timeout time in microseconds between checks for lending memory from the shared pool
+   * @note The total memory allocated is reservedPoolSize * numPipelines + sharedPoolSize
+   * @note The reservedPoolSize should be large enough to satisfy the release rules of a single pipeline.
+   * @tparam V the type of memory; i.e., 'double'
+   */
+  template<class V>
+  void addSharedMemoryManagerEdge(std::string name,
+                                  AnyITask *getMemoryTask,
+                                  IMemoryAllocator<V> *allocator,
+                                  size_t reservedPoolSize,
+                                  size_t sharedPoolSize,
+                                  MMType type,
+                                  size_t lendTimeout = 1000) {
+
+    std::shared_ptr<IMemoryAllocator<V>> memAllocator = super::getMemoryAllocator(allocator);
+    std::shared_ptr<SharedMemoryPool<V>> sharedPool(new SharedMemoryPool<V>(sharedPoolSize));
+
+    MemoryManager<V> *memoryManager = new MemoryManager<V>(name, reservedPoolSize, sharedPool, memAllocator, type,
+                                                           lendTimeout);
+
+    MemoryEdge<V> *memEdge = new MemoryEdge<V>(name, getMemoryTask, memoryManager);
+    memEdge->applyEdge(this);
+    this->addEdgeDescriptor(memEdge);
+  }
+
 //  AnyTaskManager *getGraphConsumerTaskManager() override {
 //
 //    return this->graphConsumerEdge->getTaskManager(this);
@@ -835,6 +1006,61 @@ class TaskGraphConf : public AnyTaskGraphConf {
     return this->output->isInputTerminated();
   }
 
+  /**
+   * Switches the task graph to demand-driven (pull) execution, which must be done prior to executing the graph.
+   * Tasks then only produce data for the graph's output when it is requested with requestData, and each task pulls
+   * one data from its producers for each data that is requested from it. Tasks that generate data, such as start
+   * tasks, must call ITask::waitForDemand before producing each result.
+   *
+   * Once the consumer of the graph's output has all of the data that it needs, finishedRequestingData stops the
+   * producers early. Demand propagates upstream through task edges, and stops at rules and memory managers, which
+   * produce data as it arrives.
+   *
+   * Example usage:
+   * @code
+   * taskGraph->enablePullExecution();
+   * runtime->executeRuntime();
+   * taskGraph->finishedProducingData();
+   *
+   * // Only compute the top 10 results
+   * taskGraph->requestData(10);
+   * for (int i = 0; i < 10 && !taskGraph->isOutputTerminated(); i++)
+   *   results.push_back(taskGraph->consumeData());
+   * taskGraph->finishedRequestingData();
+   *
+   * // Drain any data that was in flight
+   * while (!taskGraph->isOutputTerminated())
+   *   taskGraph->consumeData();
+   * @endcode
+   */
+  void enablePullExecution() {
+    this->output->enableDemand();
+  }
+
+  /**
+   * Gets whether the task graph uses demand-driven (pull) execution
+   * @return whether the task graph uses pull execution
+   */
+  bool isPullExecution() {
+    return this->output->isDemandDriven();
+  }
+
+  /**
+   * Requests data from the output of the task graph when using pull execution (see enablePullExecution).
+   * @param count the number of data to request
+   */
+  void requestData(size_t count) {
+    this->output->requestData(count);
+  }
+
+  /**
+   * Indicates that the consumer of the task graph's output will not request any more data, so the tasks that are
+   * waiting for demand stop producing data when using pull execution (see enablePullExecution).
+   */
+  void finishedRequestingData() {
+    this->output->closeDemand();
+  }
+
   /**
    * Sets the output connector for the task graph configuration
    * @param connector the output connector
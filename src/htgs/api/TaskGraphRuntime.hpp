@@ -14,8 +14,13 @@
 #ifndef HTGS_TASKGRAPHRUNTIME_HPP
 #define HTGS_TASKGRAPHRUNTIME_HPP
 
+#include <map>
+#include <set>
 #include <thread>
 #include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/ResourceRegistry.hpp>
+#include <htgs/api/TaskPlacement.hpp>
+#include <htgs/api/TuningProfile.hpp>
 #include <htgs/core/task/AnyTaskManager.hpp>
 
 namespace htgs {
@@ -92,6 +97,12 @@ class TaskGraphRuntime {
   TaskGraphRuntime(AnyTaskGraphConf *graph) {
     this->graph = graph;
     this->executed = false;
+    this->fairShareGroup = nullptr;
+    this->resourceRegistry = ResourceRegistry::getProcessRegistry();
+    this->checkpointGate = nullptr;
+    this->timerWheel = nullptr;
+    this->taskPlacement = nullptr;
+    this->tuningProfile = nullptr;
 #if defined (USE_NVTX) && defined (USE_MINIMAL_NVTX)
     domainInitialize = nvtxDomainCreateA("Initialize");
     domainExecute = nvtxDomainCreateA("Execute");
@@ -160,7 +171,13 @@ class TaskGraphRuntime {
         t->join();
     }
 
+    if (this->taskPlacement != nullptr)
+      this->taskPlacement->recordTraffic(this->graph->getTaskManagers());
+
     this->graph->shutdown();
+
+    if (this->tuningProfile != nullptr && this->executed)
+      this->tuningProfile->record(this->graph->getTaskManagers(), this->graph->getGraphComputeTime());
   }
 
   /**
@@ -182,6 +199,135 @@ class TaskGraphRuntime {
     }
   }
 
+  /**
+   * Registers the Runtime with a fair share scheduler, which limits the number of threads of this Runtime that
+   * execute at the same time based on the weight relative to the other registered Runtimes.
+   * Must be called prior to executeRuntime.
+   * @param scheduler the scheduler to register with
+   * @param name the name for the Runtime used when reporting shares
+   * @param weight the weight of the Runtime, must be greater than 0
+   * @return the fair share group for the Runtime, which can be used to get the CPU share for the Runtime
+   */
+  std::shared_ptr<FairShareGroup> registerFairShare(FairShareScheduler &scheduler, std::string name, double weight) {
+    this->fairShareGroup = scheduler.registerGraph(name, weight);
+    return this->fairShareGroup;
+  }
+
+  /**
+   * Sets the fair share group for the Runtime, used to have sub-graphs share the group of the parent graph.
+   * Must be called prior to executeRuntime.
+   * @param fairShareGroup the fair share group, or nullptr to disable fair share scheduling
+   */
+  void setFairShareGroup(std::shared_ptr<FairShareGroup> fairShareGroup) {
+    this->fairShareGroup = fairShareGroup;
+  }
+
+  /**
+   * Gets the fair share group for the Runtime
+   * @return the fair share group, or nullptr if the Runtime is not registered with a fair share scheduler
+   */
+  std::shared_ptr<FairShareGroup> getFairShareGroup() const {
+    return this->fairShareGroup;
+  }
+
+  /**
+   * Sets the resource registry for the Runtime, which limits the number of threads that use each resource class at
+   * the same time (see AnyITask::getResourceClasses). Runtimes use the process-wide registry by default.
+   * Must be called prior to executeRuntime.
+   * @param resourceRegistry the resource registry, or nullptr to not limit resources
+   */
+  void setResourceRegistry(std::shared_ptr<ResourceRegistry> resourceRegistry) {
+    this->resourceRegistry = resourceRegistry;
+  }
+
+  /**
+   * Gets the resource registry for the Runtime
+   * @return the resource registry, or nullptr if resources are not limited
+   */
+  std::shared_ptr<ResourceRegistry> getResourceRegistry() const {
+    return this->resourceRegistry;
+  }
+
+  /**
+   * Sets the checkpoint gate for the Runtime, which is used by a CheckpointManager to pause the threads of the
+   * Runtime when checkpointing. Must be called prior to executeRuntime.
+   * @param checkpointGate the checkpoint gate, or nullptr to disable checkpointing
+   * @note The threads of sub-graphs within ExecutionPipelines and TGTasks are not paused, so data within those
+   * sub-graphs is not saved in a checkpoint.
+   */
+  void setCheckpointGate(std::shared_ptr<CheckpointGate> checkpointGate) {
+    this->checkpointGate = checkpointGate;
+  }
+
+  /**
+   * Sets the timer wheel for the Runtime. Polling tasks in the Runtime and its sub-graphs are driven by the timer wheel
+   * instead of polling their input connectors with a timeout, and task timers (ITask::scheduleTimer) use the wheel.
+   * Must be called prior to executeRuntime.
+   * @param timerWheel the timer wheel, or nullptr to poll with timeouts
+   * @note Polling tasks driven by a timer wheel execute with nullptr once per timeout period, even when data is
+   * arriving, rather than only after being idle for the timeout period.
+   */
+  void setTimerWheel(std::shared_ptr<TimerWheel> timerWheel) {
+    this->timerWheel = timerWheel;
+  }
+
+  /**
+   * Gets the timer wheel for the Runtime
+   * @return the timer wheel, or nullptr if polling tasks use timeouts
+   */
+  std::shared_ptr<TimerWheel> getTimerWheel() const {
+    return this->timerWheel;
+  }
+
+  /**
+   * Sets the task placement for the Runtime, which binds the threads of communicating tasks to CPUs that share caches.
+   * The traffic of the graph is recorded into the placement when the Runtime finishes, so reusing the placement for
+   * the next run places the tasks based on that traffic. Must be called prior to executeRuntime.
+   * @param taskPlacement the task placement, or nullptr to let the operating system place threads
+   */
+  void setTaskPlacement(std::shared_ptr<TaskPlacement> taskPlacement) {
+    this->taskPlacement = taskPlacement;
+  }
+
+  /**
+   * Gets the task placement for the Runtime
+   * @return the task placement, or nullptr if threads are not placed
+   */
+  std::shared_ptr<TaskPlacement> getTaskPlacement() const {
+    return this->taskPlacement;
+  }
+
+  /**
+   * Sets the tuning profile for the Runtime. If the profile has a record for the graph, the recorded thread counts,
+   * tuning parameters and placement are applied when the Runtime is executed. The configuration of the graph is
+   * recorded into the profile when the Runtime finishes. Must be called prior to executeRuntime.
+   * @param tuningProfile the tuning profile, or nullptr to run the graph as it was built
+   */
+  void setTuningProfile(std::shared_ptr<TuningProfile> tuningProfile) {
+    this->tuningProfile = tuningProfile;
+  }
+
+  /**
+   * Gets the tuning profile for the Runtime
+   * @return the tuning profile, or nullptr if the graph is not tuned
+   */
+  std::shared_ptr<TuningProfile> getTuningProfile() const {
+    return this->tuningProfile;
+  }
+
+  /**
+   * Records the traffic of the executing graph and recomputes its placement. Each thread moves to its new CPU prior
+   * to processing its next data.
+   * @note Has no effect if no task placement has been set or the Runtime has not been executed
+   */
+  void updatePlacement() {
+    if (this->taskPlacement == nullptr || !this->executed)
+      return;
+
+    this->taskPlacement->recordTraffic(this->graph->getTaskManagers());
+    this->taskPlacement->applyPlacement(this->graph->getTaskManagers());
+  }
+
   /**
    * Executes the Runtime
    */
@@ -189,11 +335,23 @@ class TaskGraphRuntime {
     if (executed)
       return;
 
+    // Apply the tuned thread counts and parameters before they are used to configure connectors and threads
+    TaskPlacement::Placement placement;
+    if (this->tuningProfile != nullptr)
+      this->tuningProfile->apply(this->graph->getTaskManagers(), placement);
+
     // Initialize graph and setup task graph taskGraphCommunicator
     this->graph->initialize();
 
+    enableSpscQueues();
+    propagateDemand();
+    enableOutputLanes();
+
     std::list<AnyTaskManager *> *vertices = this->graph->getTaskManagers();
     std::list<AnyTaskManager *> newVertices;
+
+    if (this->taskPlacement != nullptr)
+      placement = this->taskPlacement->computePlacement(vertices);
     HTGS_DEBUG_VERBOSE("Launching runtime for " << vertices->size() << " vertices");
 
 
@@ -239,6 +397,13 @@ class TaskGraphRuntime {
 #endif
 
         for (AnyTaskManager *taskItem : taskList) {
+          taskItem->setFairShareGroup(this->fairShareGroup);
+          taskItem->setResourceRegistry(this->resourceRegistry);
+          taskItem->setCheckpointGate(this->checkpointGate);
+          taskItem->setTimerWheel(this->timerWheel);
+          if (!placement.empty())
+            taskItem->setCpuAffinity(TaskPlacement::getCpu(placement, taskItem, threadId));
+
 #if defined (USE_NVTX) && defined (USE_MINIMAL_NVTX)
           NVTXProfiler *profiler = new NVTXProfiler(std::to_string(threadId) + ":" + taskItem->getName(), taskDomain, domainInitialize, domainExecute, domainWait, domainWaitForMem, domainReleaseMem, domainShutdown);
           taskItem->setProfiler(profiler);
@@ -278,10 +443,110 @@ class TaskGraphRuntime {
   }
 
  private:
+  /**
+   * Switches each connector between two single-threaded tasks to a single-producer single-consumer queue (see
+   * SpscQueue). A connector is switched when exactly one task thread produces for it and exactly one task thread
+   * consumes from it. Connectors that are fed by rules or memory managers, the graph's input and output connectors, and
+   * connectors of tasks that return false from AnyITask::canUseSpscQueue keep their blocking queues.
+   */
+  void enableSpscQueues() {
+    std::map<AnyConnector *, size_t> numProducerThreads;
+    std::map<AnyConnector *, size_t> numConsumerThreads;
+    std::map<AnyConnector *, std::shared_ptr<AnyConnector>> connectors;
+    std::set<AnyConnector *> excluded;
+
+    excluded.insert(this->graph->getInputConnector().get());
+    excluded.insert(this->graph->getOutputConnector().get());
+
+    for (AnyTaskManager *task : *this->graph->getTaskManagers()) {
+      bool canUseSpsc = task->getTaskFunction()->canUseSpscQueue();
+
+      std::shared_ptr<AnyConnector> input = task->getInputConnector();
+      if (input != nullptr) {
+        connectors[input.get()] = input;
+        numConsumerThreads[input.get()] += task->getNumThreads();
+        if (!canUseSpsc)
+          excluded.insert(input.get());
+      }
+
+      std::shared_ptr<AnyConnector> output = task->getOutputConnector();
+      if (output != nullptr) {
+        connectors[output.get()] = output;
+        numProducerThreads[output.get()] += task->getNumThreads();
+        if (!canUseSpsc)
+          excluded.insert(output.get());
+      }
+    }
+
+    for (auto connectorPair : connectors) {
+      AnyConnector *connector = connectorPair.first;
+      if (excluded.find(connector) != excluded.end() || numProducerThreads[connector] != 1
+          || numConsumerThreads[connector] != 1 || connector->getProducerCount() != 1)
+        continue;
+
+      if (connectorPair.second->enableSpscQueue()) {
+        HTGS_DEBUG_VERBOSE("Connector " << connector << " uses a single-producer single-consumer queue");
+      }
+    }
+  }
+
+  /**
+   * Propagates demand-driven (pull) execution upstream from the graph's output connector (see
+   * TaskGraphConf::enablePullExecution). The input connector of each task whose output connector is demand-driven
+   * becomes demand-driven, unless it is the graph's input connector or the task polls or returns false from
+   * AnyITask::canPullData. Propagation stops at rules and memory managers, which produce data as it arrives.
+   */
+  void propagateDemand() {
+    std::shared_ptr<AnyConnector> graphOutput = this->graph->getOutputConnector();
+    if (graphOutput == nullptr || !graphOutput->isDemandDriven())
+      return;
+
+    AnyConnector *graphInput = this->graph->getInputConnector().get();
+
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (AnyTaskManager *task : *this->graph->getTaskManagers()) {
+        std::shared_ptr<AnyConnector> input = task->getInputConnector();
+        std::shared_ptr<AnyConnector> output = task->getOutputConnector();
+
+        if (input == nullptr || output == nullptr || input.get() == graphInput || input->isDemandDriven()
+            || !output->isDemandDriven() || task->isPoll() || !task->getTaskFunction()->canPullData())
+          continue;
+
+        HTGS_DEBUG_VERBOSE("Connector " << input << " for " << task->getName() << " is demand-driven");
+        input->enableDemand();
+        changed = true;
+      }
+    }
+  }
+
+  /**
+   * Enables lanes on the output connectors of tasks that return true from AnyITask::usesOutputLanes, so that the
+   * threads producing their output do not contend on one queue. Connectors that cannot be split keep their queue.
+   */
+  void enableOutputLanes() {
+    for (AnyTaskManager *task : *this->graph->getTaskManagers()) {
+      std::shared_ptr<AnyConnector> output = task->getOutputConnector();
+      if (output == nullptr || !task->getTaskFunction()->usesOutputLanes())
+        continue;
+
+      if (output->enableLanes()) {
+        HTGS_DEBUG_VERBOSE("Connector " << output << " for " << task->getName() << " uses lanes");
+      }
+    }
+  }
+
   std::list<std::thread *> threads; //!< A list of all threads spawned for the Runtime
   AnyTaskGraphConf *graph; //!< The TaskGraph associated with the Runtime
   std::list<TaskManagerThread *> runtimeThreads; //!< The list of TaskManagers bound to each thread
   bool executed; //!< Whether the Runtime has been executed
+  std::shared_ptr<FairShareGroup> fairShareGroup; //!< The fair share group for the Runtime (nullptr if not registered)
+  std::shared_ptr<ResourceRegistry> resourceRegistry; //!< The registry that limits resource classes (nullptr if not limited)
+  std::shared_ptr<CheckpointGate> checkpointGate; //!< The checkpoint gate for the Runtime (nullptr if not checkpointed)
+  std::shared_ptr<TimerWheel> timerWheel; //!< The timer wheel that drives polling tasks (nullptr to poll with timeouts)
+  std::shared_ptr<TaskPlacement> taskPlacement; //!< The placement of threads onto CPUs (nullptr if not placed)
+  std::shared_ptr<TuningProfile> tuningProfile; //!< The saved tuning parameters for the graph (nullptr if not tuned)
 
 #ifdef USE_NVTX
   nvtxDomainHandle_t domainInitialize;
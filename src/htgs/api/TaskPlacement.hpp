@@ -0,0 +1,349 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file TaskPlacement.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Places the threads of communicating tasks on CPUs that share caches
+ */
+#ifndef HTGS_TASKPLACEMENT_HPP
+#define HTGS_TASKPLACEMENT_HPP
+
+#include <algorithm>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <htgs/core/task/AnyTaskManager.hpp>
+#include <htgs/core/task/CpuTopology.hpp>
+
+namespace htgs {
+/**
+ * @class TaskPlacement TaskPlacement.hpp <htgs/api/TaskPlacement.hpp>
+ * @brief Binds the threads of a TaskGraphRuntime to CPUs so that tasks that pass a lot of data to each other share
+ * caches.
+ *
+ * @details
+ * The placement weights each edge between two tasks by the number of data that were produced along it. The counts are
+ * read from the TaskManagers with recordTraffic, which the TaskGraphRuntime calls after it finishes. Before any
+ * traffic is recorded, every edge has the same weight.
+ *
+ * Tasks that are connected by heavy edges are grouped so that each group fits within one cache domain (CPUs sharing
+ * an L3 cache, see CpuTopology). The groups are spread across the cache domains. Within a domain the tasks are
+ * ordered so that a producer is next to its heaviest consumer, and their threads are given adjacent CPUs, which share
+ * an L2 cache when the domain has multi-threaded cores.
+ *
+ * The same TaskPlacement can be reused across runs of a graph, so each run is placed using the traffic from the
+ * previous run. TaskGraphRuntime::updatePlacement recomputes the placement of a running graph, for example between
+ * epochs of a long-running graph.
+ *
+ * Tasks are identified by name and pipeline id, so tasks in a graph should have unique names for the best placement.
+ * Only the tasks of the runtime's graph are placed, the sub-graphs of an ExecutionPipeline or TGTask are not.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<htgs::TaskPlacement> placement = std::make_shared<htgs::TaskPlacement>();
+ *
+ * for (int run = 0; run < numRuns; run++) {
+ *   htgs::TaskGraphConf<Data, Data> *taskGraph = createGraph();
+ *   htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(taskGraph);
+ *   runtime->setTaskPlacement(placement);
+ *   runtime->executeRuntime();
+ *   ...
+ *   runtime->waitForRuntime();
+ *   delete runtime;
+ * }
+ * @endcode
+ */
+class TaskPlacement {
+ public:
+  /**
+   * Type of a placement, which maps each task to the CPU for each of its threads
+   */
+  typedef std::map<std::string, std::vector<int>> Placement;
+
+  /**
+   * Creates a task placement for the topology of the machine
+   */
+  TaskPlacement() : topology(CpuTopology::detect()) {}
+
+  /**
+   * Creates a task placement for a specific topology
+   * @param topology the topology
+   */
+  TaskPlacement(CpuTopology topology) : topology(topology) {}
+
+  /**
+   * Gets the topology used for placing threads
+   * @return the topology
+   */
+  const CpuTopology &getTopology() const { return topology; }
+
+  /**
+   * Gets the key that identifies a task in the placement
+   * @param taskManager the task manager
+   * @return the key for the task
+   */
+  static std::string getKey(AnyTaskManager *taskManager) {
+    return taskManager->getName() + "/" + std::to_string(taskManager->getPipelineId());
+  }
+
+  /**
+   * Records the number of data that were produced along each edge of a graph, replacing the previously recorded
+   * traffic. Data produced into a connector are split evenly among the tasks consuming from it.
+   * @param taskManagers the task managers of the graph, including the copies for each thread
+   */
+  void recordTraffic(std::list<AnyTaskManager *> *taskManagers) {
+    std::map<AnyConnector *, std::map<std::string, size_t>> produced;
+    std::map<AnyConnector *, std::set<std::string>> consumers;
+
+    for (AnyTaskManager *taskManager : *taskManagers) {
+      if (taskManager->getOutputConnector() != nullptr)
+        produced[taskManager->getOutputConnector().get()][getKey(taskManager)] += taskManager->getNumDataProduced();
+      if (taskManager->getInputConnector() != nullptr)
+        consumers[taskManager->getInputConnector().get()].insert(getKey(taskManager));
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    traffic.clear();
+    for (auto &connector : produced) {
+      std::set<std::string> &connectorConsumers = consumers[connector.first];
+      for (auto &producer : connector.second)
+        for (auto &consumer : connectorConsumers)
+          traffic[std::make_pair(producer.first, consumer)] += producer.second / connectorConsumers.size();
+    }
+  }
+
+  /**
+   * Sets the traffic between two tasks, for example to place a graph using traffic that is known ahead of time
+   * @param producer the key of the producer task (see getKey)
+   * @param consumer the key of the consumer task
+   * @param numData the number of data passed from the producer to the consumer
+   */
+  void setTraffic(std::string producer, std::string consumer, size_t numData) {
+    std::unique_lock<std::mutex> lock(mutex);
+    traffic[std::make_pair(producer, consumer)] = numData;
+  }
+
+  /**
+   * Gets the recorded traffic between two tasks
+   * @param producer the key of the producer task (see getKey)
+   * @param consumer the key of the consumer task
+   * @return the number of data passed from the producer to the consumer
+   */
+  size_t getTraffic(std::string producer, std::string consumer) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = traffic.find(std::make_pair(producer, consumer));
+    return it == traffic.end() ? 0 : it->second;
+  }
+
+  /**
+   * Computes the CPUs for the threads of each task in a graph
+   * @param taskManagers the task managers of the graph
+   * @return the placement, which maps each task's key to the CPU for each of its threads
+   */
+  Placement computePlacement(std::list<AnyTaskManager *> *taskManagers) {
+    // Tasks and the edges between them, which are weighted by traffic plus one so the structure of the graph is used
+    // before traffic has been recorded
+    std::map<std::string, size_t> numThreads;
+    std::map<AnyConnector *, std::set<std::string>> producers;
+    std::map<AnyConnector *, std::set<std::string>> consumers;
+    for (AnyTaskManager *taskManager : *taskManagers) {
+      if (taskManager->getNumThreads() == 0)
+        continue;
+      std::string key = getKey(taskManager);
+      numThreads[key] = std::max(numThreads[key], taskManager->getNumThreads());
+      if (taskManager->getOutputConnector() != nullptr)
+        producers[taskManager->getOutputConnector().get()].insert(key);
+      if (taskManager->getInputConnector() != nullptr)
+        consumers[taskManager->getInputConnector().get()].insert(key);
+    }
+
+    std::map<std::string, std::map<std::string, size_t>> weights;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      for (auto &connector : producers)
+        for (auto &producer : connector.second)
+          for (auto &consumer : consumers[connector.first]) {
+            if (producer == consumer)
+              continue;
+            auto it = traffic.find(std::make_pair(producer, consumer));
+            size_t weight = 1 + (it == traffic.end() ? 0 : it->second);
+            weights[producer][consumer] += weight;
+            weights[consumer][producer] += weight;
+          }
+    }
+
+    std::vector<std::vector<std::string>> clusters = clusterTasks(numThreads, weights);
+
+    // Spread the clusters across the cache domains, largest first, each into the domain with the most free CPUs
+    std::vector<size_t> domainCursors(topology.getCacheDomains().size(), 0);
+    Placement placement;
+    for (auto &cluster : clusters) {
+      size_t domain = 0;
+      long mostFree = 0;
+      for (size_t d = 0; d < domainCursors.size(); d++) {
+        long numFree = (long) topology.getDomainCpus(d).size() - (long) domainCursors[d];
+        if (d == 0 || numFree > mostFree) {
+          domain = d;
+          mostFree = numFree;
+        }
+      }
+
+      std::vector<int> cpus = topology.getDomainCpus(domain);
+      for (auto &task : cluster)
+        for (size_t thread = 0; thread < numThreads[task]; thread++)
+          placement[task].push_back(cpus[domainCursors[domain]++ % cpus.size()]);
+    }
+
+    return placement;
+  }
+
+  /**
+   * Gets the CPU for a thread of a task from a placement
+   * @param placement the placement
+   * @param taskManager the task manager
+   * @param threadId the thread id of the task manager
+   * @return the CPU id, or -1 if the task is not part of the placement
+   */
+  static int getCpu(const Placement &placement, AnyTaskManager *taskManager, size_t threadId) {
+    auto it = placement.find(getKey(taskManager));
+    if (it == placement.end() || threadId >= it->second.size())
+      return -1;
+    return it->second[threadId];
+  }
+
+  /**
+   * Computes the placement of a graph and sets the CPU affinity of its task managers (see
+   * AnyTaskManager::setCpuAffinity). Running threads are moved prior to processing their next data.
+   * @param taskManagers the task managers of the graph, including the copies for each thread
+   */
+  void applyPlacement(std::list<AnyTaskManager *> *taskManagers) {
+    Placement placement = computePlacement(taskManagers);
+    for (AnyTaskManager *taskManager : *taskManagers)
+      taskManager->setCpuAffinity(getCpu(placement, taskManager, taskManager->getThreadId()));
+  }
+
+ private:
+  /**
+   * Groups tasks that are connected by heavy edges, so that each group fits within a cache domain. The tasks within
+   * each group are ordered so that each task is next to the task it exchanges the most data with.
+   * @param numThreads the number of threads for each task
+   * @param weights the weight of the edges between each pair of tasks
+   * @return the groups of tasks, largest group first
+   */
+  std::vector<std::vector<std::string>> clusterTasks(std::map<std::string, size_t> &numThreads,
+                                                     std::map<std::string, std::map<std::string, size_t>> &weights) {
+    size_t capacity = 0;
+    for (size_t d = 0; d < topology.getCacheDomains().size(); d++)
+      capacity = std::max(capacity, topology.getDomainCpus(d).size());
+
+    // Merge the tasks along the heaviest edges first, as long as the merged group fits in a cache domain
+    std::vector<std::pair<size_t, std::pair<std::string, std::string>>> edges;
+    for (auto &task : weights)
+      for (auto &neighbor : task.second)
+        if (task.first < neighbor.first)
+          edges.push_back(std::make_pair(neighbor.second, std::make_pair(task.first, neighbor.first)));
+    std::stable_sort(edges.begin(), edges.end(), [](const std::pair<size_t, std::pair<std::string, std::string>> &a,
+                                                    const std::pair<size_t, std::pair<std::string, std::string>> &b) {
+      return a.first > b.first;
+    });
+
+    std::map<std::string, std::string> parent;
+    std::map<std::string, size_t> clusterThreads;
+    for (auto &task : numThreads) {
+      parent[task.first] = task.first;
+      clusterThreads[task.first] = task.second;
+    }
+
+    auto find = [&parent](std::string task) {
+      while (parent[task] != task) {
+        parent[task] = parent[parent[task]];
+        task = parent[task];
+      }
+      return task;
+    };
+
+    for (auto &edge : edges) {
+      std::string a = find(edge.second.first);
+      std::string b = find(edge.second.second);
+      if (a != b && clusterThreads[a] + clusterThreads[b] <= capacity) {
+        parent[b] = a;
+        clusterThreads[a] += clusterThreads[b];
+      }
+    }
+
+    std::map<std::string, std::set<std::string>> members;
+    for (auto &task : numThreads)
+      members[find(task.first)].insert(task.first);
+
+    std::vector<std::vector<std::string>> clusters;
+    for (auto &cluster : members)
+      clusters.push_back(orderCluster(cluster.second, weights));
+
+    std::stable_sort(clusters.begin(), clusters.end(), [&clusterThreads, &find](const std::vector<std::string> &a,
+                                                                                 const std::vector<std::string> &b) {
+      return clusterThreads[find(a.front())] > clusterThreads[find(b.front())];
+    });
+    return clusters;
+  }
+
+  /**
+   * Orders the tasks of a group, starting with the task with the most traffic and then repeatedly adding the task
+   * that exchanges the most data with the last task added
+   * @param tasks the tasks of the group
+   * @param weights the weight of the edges between each pair of tasks
+   * @return the ordered tasks
+   */
+  static std::vector<std::string> orderCluster(std::set<std::string> tasks,
+                                               std::map<std::string, std::map<std::string, size_t>> &weights) {
+    std::vector<std::string> order;
+    std::map<std::string, size_t> weightToPlaced;
+    while (!tasks.empty()) {
+      std::string next = *tasks.begin();
+      size_t bestToLast = 0;
+      size_t bestToPlaced = 0;
+      for (auto &task : tasks) {
+        size_t toLast = order.empty() ? 0 : weights[order.back()][task];
+        size_t toPlaced = order.empty() ? totalWeight(weights[task]) : weightToPlaced[task];
+        if (toLast > bestToLast || (toLast == bestToLast && toPlaced > bestToPlaced)) {
+          next = task;
+          bestToLast = toLast;
+          bestToPlaced = toPlaced;
+        }
+      }
+
+      order.push_back(next);
+      tasks.erase(next);
+      for (auto &neighbor : weights[next])
+        weightToPlaced[neighbor.first] += neighbor.second;
+    }
+    return order;
+  }
+
+  /**
+   * Gets the total weight of the edges of a task
+   * @param edges the edges of the task
+   * @return the total weight
+   */
+  static size_t totalWeight(std::map<std::string, size_t> &edges) {
+    size_t total = 0;
+    for (auto &edge : edges)
+      total += edge.second;
+    return total;
+  }
+
+  CpuTopology topology; //!< The topology of the CPUs
+  std::map<std::pair<std::string, std::string>, size_t> traffic; //!< The number of data passed between each producer and consumer task
+  std::mutex mutex; //!< Protects the recorded traffic
+};
+}
+
+#endif //HTGS_TASKPLACEMENT_HPP
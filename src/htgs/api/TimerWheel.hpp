@@ -0,0 +1,338 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file TimerWheel.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the TimerWheel, which drives the periodic and one-shot timers of tasks from a single thread.
+ */
+#ifndef HTGS_TIMERWHEEL_HPP
+#define HTGS_TIMERWHEEL_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <htgs/debug/debug_message.hpp>
+
+namespace htgs {
+
+/**
+ * @class TimerWheel TimerWheel.hpp <htgs/api/TimerWheel.hpp>
+ * @brief A hierarchical timer wheel that runs timer callbacks on a single thread.
+ *
+ * @details
+ * Time is divided into ticks of a fixed resolution. The wheel has four levels of 256 slots; the first level holds timers
+ * that expire within 256 ticks, and each higher level holds timers that expire 256 times further out. When the first
+ * level wraps around, the next slot of the higher level is cascaded down. Scheduling and cancelling a timer are O(1).
+ *
+ * The thread of the wheel sleeps until the next slot that holds a timer, or until the next cascade, and does not run
+ * when there are no timers. Callbacks run on the thread of the wheel, so they must be short; tasks use them to wake up
+ * their threads (see ITask::scheduleTimer and TaskGraphRuntime::setTimerWheel).
+ *
+ * Periodic timers are rescheduled relative to their previous expiration, so the period does not drift.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<htgs::TimerWheel> timerWheel = std::make_shared<htgs::TimerWheel>(std::chrono::microseconds(100));
+ *
+ * // Drive all polling tasks of the runtime with the timer wheel
+ * htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(taskGraph);
+ * runtime->setTimerWheel(timerWheel);
+ *
+ * // Or schedule callbacks directly
+ * uint64_t id = timerWheel->schedulePeriodic(std::chrono::milliseconds(10), [](uint64_t timerId) { ... });
+ * timerWheel->cancel(id);
+ * @endcode
+ */
+class TimerWheel {
+ public:
+  /**
+   * Constructs a timer wheel. The thread of the wheel is started when the first timer is scheduled.
+   * @param resolution the duration of a tick, which is the precision of the timers
+   */
+  TimerWheel(std::chrono::microseconds resolution = std::chrono::microseconds(100)) {
+    HTGS_ASSERT(resolution.count() > 0, "The resolution of a TimerWheel must be greater than 0");
+    this->resolution = resolution;
+    this->startTime = std::chrono::steady_clock::now();
+    this->currentTick = 0;
+    this->nextId = 1;
+    this->running = false;
+    this->thread = nullptr;
+  }
+
+  /**
+   * Destructor, stops the thread of the wheel. Timers that have not expired are not run.
+   */
+  ~TimerWheel() {
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->running = false;
+      this->condition.notify_all();
+    }
+
+    if (this->thread != nullptr) {
+      this->thread->join();
+      delete this->thread;
+    }
+  }
+
+  /**
+   * Gets the process-wide timer wheel, which has a resolution of 100 microseconds.
+   * @return the process-wide timer wheel
+   */
+  static std::shared_ptr<TimerWheel> getProcessTimerWheel() {
+    static std::shared_ptr<TimerWheel> processTimerWheel = std::make_shared<TimerWheel>();
+    return processTimerWheel;
+  }
+
+  /**
+   * Schedules a callback that runs once after a delay
+   * @param delay the delay
+   * @param callback the callback, which runs on the thread of the wheel and receives the timer id
+   * @return the timer id, which can be used to cancel the timer
+   */
+  uint64_t schedule(std::chrono::microseconds delay, std::function<void(uint64_t)> callback) {
+    return addTimer(delay, std::chrono::microseconds(0), callback);
+  }
+
+  /**
+   * Schedules a callback that runs periodically
+   * @param period the period, which is rounded up to the resolution of the wheel
+   * @param callback the callback, which runs on the thread of the wheel and receives the timer id
+   * @return the timer id, which can be used to cancel the timer
+   */
+  uint64_t schedulePeriodic(std::chrono::microseconds period, std::function<void(uint64_t)> callback) {
+    HTGS_ASSERT(period.count() > 0, "The period of a timer must be greater than 0");
+    return addTimer(period, period, callback);
+  }
+
+  /**
+   * Cancels a timer. A callback that is already running is not interrupted.
+   * @param timerId the timer id
+   * @return whether the timer was cancelled; false if the timer already ran (one-shot) or does not exist
+   */
+  bool cancel(uint64_t timerId) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto it = this->timers.find(timerId);
+    if (it == this->timers.end())
+      return false;
+
+    // Removed from its slot when the slot is processed
+    it->second->cancelled = true;
+    this->timers.erase(it);
+    return true;
+  }
+
+  /**
+   * Gets the number of timers that are scheduled
+   * @return the number of timers
+   */
+  size_t getNumTimers() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->timers.size();
+  }
+
+  /**
+   * Gets the resolution of the wheel
+   * @return the duration of a tick
+   */
+  std::chrono::microseconds getResolution() const { return resolution; }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static const size_t NUM_LEVELS = 4;
+  static const size_t SLOT_BITS = 8;
+  static const size_t NUM_SLOTS = 1 << SLOT_BITS;
+
+  struct Timer {
+    uint64_t id;
+    uint64_t expiry;
+    uint64_t period;
+    std::function<void(uint64_t)> callback;
+    bool cancelled;
+  };
+
+  typedef std::list<std::shared_ptr<Timer>> Slot;
+  //! @endcond
+
+  /**
+   * Adds a timer to the wheel, starting the thread of the wheel if needed
+   * @param delay the delay until the first expiration
+   * @param period the period, or 0 for a one-shot timer
+   * @param callback the callback
+   * @return the timer id
+   */
+  uint64_t addTimer(std::chrono::microseconds delay,
+                    std::chrono::microseconds period,
+                    std::function<void(uint64_t)> callback) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+
+    if (this->thread == nullptr) {
+      this->running = true;
+      this->thread = new std::thread(&TimerWheel::run, this);
+    }
+
+    // Skip the ticks that passed while there were no timers
+    uint64_t nowTick = toTick(std::chrono::steady_clock::now());
+    if (this->timers.empty() && nowTick > this->currentTick + 1)
+      this->currentTick = nowTick - 1;
+
+    std::shared_ptr<Timer> timer = std::make_shared<Timer>();
+    timer->id = this->nextId++;
+    timer->expiry = toTick(std::chrono::steady_clock::now() + delay);
+    timer->period = (uint64_t) ((period.count() + resolution.count() - 1) / resolution.count());
+    timer->callback = callback;
+    timer->cancelled = false;
+
+    this->timers.insert(std::make_pair(timer->id, timer));
+    insertTimer(timer, this->currentTick + 1);
+    this->condition.notify_all();
+
+    return timer->id;
+  }
+
+  /**
+   * Converts a time to the tick that expires at or after the time
+   * @param time the time
+   * @return the tick
+   */
+  uint64_t toTick(std::chrono::steady_clock::time_point time) const {
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(time - startTime).count();
+    return (uint64_t) ((elapsed + resolution.count() - 1) / resolution.count());
+  }
+
+  /**
+   * Places a timer into the slot for its expiration
+   * @param timer the timer
+   * @param minTick the earliest tick to place the timer at, used for timers that already expired
+   */
+  void insertTimer(std::shared_ptr<Timer> timer, uint64_t minTick) {
+    uint64_t expiry = std::max(timer->expiry, minTick);
+    uint64_t delta = expiry - this->currentTick;
+
+    size_t level = 0;
+    while (level < NUM_LEVELS - 1 && delta >= ((uint64_t) 1 << (SLOT_BITS * (level + 1))))
+      level++;
+
+    // Timers beyond the last level are placed at the furthest slot and cascaded again
+    uint64_t maxDelta = ((uint64_t) 1 << (SLOT_BITS * NUM_LEVELS)) - 1;
+    if (delta > maxDelta)
+      expiry = this->currentTick + maxDelta;
+
+    size_t slot = (size_t) ((expiry >> (SLOT_BITS * level)) & (NUM_SLOTS - 1));
+    this->wheel[level][slot].push_back(timer);
+  }
+
+  /**
+   * Advances the wheel by one tick, cascading higher levels and collecting the expired timers
+   * @param expired the list of expired timers
+   */
+  void advance(std::list<std::shared_ptr<Timer>> &expired) {
+    this->currentTick++;
+
+    for (size_t level = 1; level < NUM_LEVELS; level++) {
+      if ((this->currentTick & (((uint64_t) 1 << (SLOT_BITS * level)) - 1)) != 0)
+        break;
+
+      Slot &slot = this->wheel[level][(this->currentTick >> (SLOT_BITS * level)) & (NUM_SLOTS - 1)];
+      Slot cascade;
+      cascade.swap(slot);
+      // Timers that expire on this tick are placed in the slot that is processed next
+      for (auto timer : cascade)
+        if (!timer->cancelled)
+          insertTimer(timer, this->currentTick);
+    }
+
+    Slot &slot = this->wheel[0][this->currentTick & (NUM_SLOTS - 1)];
+    for (auto it = slot.begin(); it != slot.end();) {
+      if ((*it)->cancelled) {
+        it = slot.erase(it);
+      } else if ((*it)->expiry <= this->currentTick) {
+        expired.push_back(*it);
+        it = slot.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  /**
+   * Gets the number of ticks until the next slot in the first level that has timers, or until the next cascade
+   * @return the number of ticks to wait
+   */
+  uint64_t ticksUntilNextEvent() const {
+    uint64_t ticks = 1;
+    for (; ticks < NUM_SLOTS; ticks++) {
+      uint64_t tick = this->currentTick + ticks;
+      if ((tick & (NUM_SLOTS - 1)) == 0 || !this->wheel[0][tick & (NUM_SLOTS - 1)].empty())
+        break;
+    }
+    return ticks;
+  }
+
+  /**
+   * The loop of the thread of the wheel
+   */
+  void run() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (this->running) {
+      if (this->timers.empty()) {
+        this->condition.wait(lock, [&] { return !this->running || !this->timers.empty(); });
+        continue;
+      }
+
+      uint64_t nextTick = this->currentTick + ticksUntilNextEvent();
+      auto wakeTime = this->startTime + nextTick * this->resolution;
+      if (std::chrono::steady_clock::now() < wakeTime) {
+        // Woken up early when a timer is scheduled, which may be sooner than the next event
+        this->condition.wait_until(lock, wakeTime);
+        continue;
+      }
+
+      std::list<std::shared_ptr<Timer>> expired;
+      while (this->currentTick < nextTick)
+        advance(expired);
+
+      for (auto timer : expired) {
+        if (timer->period > 0) {
+          timer->expiry += timer->period;
+          insertTimer(timer, this->currentTick + 1);
+        } else {
+          this->timers.erase(timer->id);
+        }
+      }
+
+      lock.unlock();
+      for (auto timer : expired)
+        timer->callback(timer->id);
+      lock.lock();
+    }
+  }
+
+  std::chrono::microseconds resolution; //!< The duration of a tick
+  std::chrono::steady_clock::time_point startTime; //!< The time of tick 0
+  uint64_t currentTick; //!< The last tick that was processed
+  uint64_t nextId; //!< The id for the next timer
+  std::array<std::array<Slot, NUM_SLOTS>, NUM_LEVELS> wheel; //!< The slots of each level of the wheel
+  std::unordered_map<uint64_t, std::shared_ptr<Timer>> timers; //!< The scheduled timers by id
+  bool running; //!< Whether the thread of the wheel is running
+  std::thread *thread; //!< The thread of the wheel
+  std::mutex mutex; //!< The mutex to ensure thread safety
+  std::condition_variable condition; //!< The condition variable used to wake up the thread of the wheel
+};
+}
+
+#endif //HTGS_TIMERWHEEL_HPP
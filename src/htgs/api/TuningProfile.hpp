@@ -0,0 +1,372 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file TuningProfile.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Saves the best tuning parameters of a task graph to a file, so later runs on the same machine start with them
+ */
+#ifndef HTGS_TUNINGPROFILE_HPP
+#define HTGS_TUNINGPROFILE_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <htgs/api/TaskPlacement.hpp>
+#include <htgs/core/task/AnyTaskManager.hpp>
+#include <htgs/core/task/CpuTopology.hpp>
+
+namespace htgs {
+/**
+ * @class TuningProfile TuningProfile.hpp <htgs/api/TuningProfile.hpp>
+ * @brief Persists the best tuning parameters observed for a task graph, and applies them when the graph is executed
+ * again.
+ *
+ * @details
+ * When a TaskGraphRuntime finishes, it records the configuration of its graph into the TuningProfile along with the
+ * graph's compute time. The configuration holds the number of threads of each task, the parameters reported by
+ * AnyITask::getTuningParameters (the pool size of each memory edge and the number of pipelines of each
+ * ExecutionPipeline), and the CPU each thread was bound to (see TaskPlacement). The configuration replaces the
+ * previous record only if the graph finished faster, and the profile is then saved to its file.
+ *
+ * Records are keyed by the signature of the graph and of the machine. The graph signature is built from the names of
+ * its tasks, the edges between them and its memory edges, so it is the same across runs that build the same graph
+ * with different thread counts or pool sizes. The machine signature is built from its CpuTopology.
+ *
+ * When a TaskGraphRuntime executes a graph that has a record, the recorded parameters replace the ones the graph was
+ * built with, prior to any thread being spawned. If the Runtime has no TaskPlacement, the threads are bound to the
+ * recorded CPUs. Applying records can be disabled with setApplyEnabled or by setting the environment variable
+ * HTGS_TUNING=off, in which case runs still record their configuration, so a faster hand-coded configuration still
+ * replaces the saved one.
+ *
+ * Tasks are identified by name and pipeline id (see TaskPlacement::getKey), so tasks in a graph should have unique
+ * names. Only the tasks of the runtime's graph are tuned, the sub-graphs of an ExecutionPipeline or TGTask are not.
+ *
+ * Example usage:
+ * @code
+ * std::shared_ptr<htgs::TuningProfile> tuning = std::make_shared<htgs::TuningProfile>("htgs_tuning.txt");
+ *
+ * htgs::TaskGraphConf<Data, Data> *taskGraph = createGraph(numThreads, poolSize);
+ * htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(taskGraph);
+ * runtime->setTuningProfile(tuning);
+ * runtime->executeRuntime();
+ * ...
+ * runtime->waitForRuntime();
+ * @endcode
+ */
+class TuningProfile {
+ public:
+  /**
+   * @struct Record TuningProfile.hpp <htgs/api/TuningProfile.hpp>
+   * @brief The configuration of a graph and how long it took to compute
+   */
+  struct Record {
+    unsigned long long int graphTime; //!< The compute time of the graph in microseconds
+    std::map<std::string, size_t> numThreads; //!< The number of threads for each task
+    std::map<std::string, std::map<std::string, size_t>> parameters; //!< The tuning parameters for each task
+    TaskPlacement::Placement placement; //!< The CPU for each thread of each task (empty if threads were not bound)
+  };
+
+  /**
+   * Creates a tuning profile that is stored in a file, for the topology of the machine. Existing records are loaded
+   * from the file.
+   * @param path the path of the file
+   */
+  TuningProfile(std::string path) : TuningProfile(path, CpuTopology::detect()) {}
+
+  /**
+   * Creates a tuning profile that is stored in a file, for a specific topology. Existing records are loaded from the
+   * file.
+   * @param path the path of the file
+   * @param topology the topology
+   */
+  TuningProfile(std::string path, CpuTopology topology) : path(path), topology(topology), applyEnabled(true) {
+    const char *env = std::getenv("HTGS_TUNING");
+    if (env != nullptr && std::string(env) == "off")
+      this->applyEnabled = false;
+    load();
+  }
+
+  /**
+   * Sets whether records are applied to graphs when they are executed. Graphs are still recorded when disabled.
+   * @param applyEnabled whether records are applied
+   */
+  void setApplyEnabled(bool applyEnabled) { this->applyEnabled = applyEnabled; }
+
+  /**
+   * Gets whether records are applied to graphs when they are executed
+   * @return whether records are applied
+   */
+  bool isApplyEnabled() const { return this->applyEnabled; }
+
+  /**
+   * Gets the path of the file that stores the profile
+   * @return the path
+   */
+  const std::string &getPath() const { return this->path; }
+
+  /**
+   * Gets the signature of a graph, which is a hash of the names of its tasks, its edges and its memory edges
+   * @param taskManagers the task managers of the graph
+   * @return the signature
+   */
+  static std::string getGraphSignature(std::list<AnyTaskManager *> *taskManagers) {
+    std::set<std::string> tasks;
+    std::map<AnyConnector *, std::set<std::string>> producers;
+    std::map<AnyConnector *, std::set<std::string>> consumers;
+    for (AnyTaskManager *taskManager : *taskManagers) {
+      std::string name = taskManager->getName();
+      tasks.insert("task " + name);
+      if (taskManager->getOutputConnector() != nullptr)
+        producers[taskManager->getOutputConnector().get()].insert(name);
+      if (taskManager->getInputConnector() != nullptr)
+        consumers[taskManager->getInputConnector().get()].insert(name);
+      for (auto &memoryEdge : *taskManager->getTaskFunction()->getMemoryEdges())
+        tasks.insert("memory " + memoryEdge.first + " -> " + name);
+    }
+
+    for (auto &connector : producers)
+      for (auto &producer : connector.second)
+        for (auto &consumer : consumers[connector.first])
+          tasks.insert("edge " + producer + " -> " + consumer);
+
+    // FNV-1a, which unlike std::hash is the same across builds
+    uint64_t hash = 14695981039346656037ULL;
+    for (auto &entry : tasks)
+      for (char c : entry + "\n") {
+        hash ^= (unsigned char) c;
+        hash *= 1099511628211ULL;
+      }
+
+    std::ostringstream oss;
+    oss << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return oss.str();
+  }
+
+  /**
+   * Gets the signature of the topology, which lists the number of CPUs in each cache domain
+   * @return the signature
+   */
+  std::string getTopologySignature() const {
+    std::ostringstream oss;
+    oss << "cpus=" << topology.getNumCpus() << ";domains=";
+    for (size_t d = 0; d < topology.getCacheDomains().size(); d++)
+      oss << (d == 0 ? "" : ".") << topology.getDomainCpus(d).size();
+    return oss.str();
+  }
+
+  /**
+   * Gets the key of the record for a graph on this machine
+   * @param taskManagers the task managers of the graph
+   * @return the key
+   */
+  std::string getKey(std::list<AnyTaskManager *> *taskManagers) const {
+    return getGraphSignature(taskManagers) + "@" + getTopologySignature();
+  }
+
+  /**
+   * Gets whether a graph has a record
+   * @param taskManagers the task managers of the graph
+   * @return whether the graph has a record
+   */
+  bool hasRecord(std::list<AnyTaskManager *> *taskManagers) {
+    std::string key = getKey(taskManagers);
+    std::unique_lock<std::mutex> lock(mutex);
+    return records.find(key) != records.end();
+  }
+
+  /**
+   * Gets the record for a graph
+   * @param taskManagers the task managers of the graph
+   * @param record the record, which is set if the graph has a record
+   * @return whether the graph has a record
+   */
+  bool getRecord(std::list<AnyTaskManager *> *taskManagers, Record &record) {
+    std::string key = getKey(taskManagers);
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = records.find(key);
+    if (it == records.end())
+      return false;
+    record = it->second;
+    return true;
+  }
+
+  /**
+   * Applies the record for a graph, setting the number of threads and the tuning parameters of its tasks. Must be
+   * called prior to the graph being executed.
+   * @param taskManagers the task managers of the graph
+   * @param placement set to the recorded placement of the threads, which is empty if threads were not bound
+   * @return whether a record was applied
+   * @retval TRUE if the graph has a record and applying records is enabled
+   * @retval FALSE if the graph is left as it was built
+   */
+  bool apply(std::list<AnyTaskManager *> *taskManagers, TaskPlacement::Placement &placement) {
+    if (!this->applyEnabled)
+      return false;
+
+    Record record;
+    if (!getRecord(taskManagers, record))
+      return false;
+
+    for (AnyTaskManager *taskManager : *taskManagers) {
+      std::string key = TaskPlacement::getKey(taskManager);
+
+      auto threads = record.numThreads.find(key);
+      if (threads != record.numThreads.end() && threads->second > 0)
+        taskManager->setNumThreads(threads->second);
+
+      auto parameters = record.parameters.find(key);
+      if (parameters != record.parameters.end())
+        for (auto &parameter : parameters->second)
+          taskManager->getTaskFunction()->setTuningParameter(parameter.first, parameter.second);
+    }
+
+    placement = record.placement;
+    return true;
+  }
+
+  /**
+   * Records the configuration of a graph that has finished executing. The record replaces the previous record for
+   * the graph if the graph finished faster, in which case the profile is saved to its file.
+   * @param taskManagers the task managers of the graph, including the copies for each thread
+   * @param graphTime the compute time of the graph in microseconds
+   * @return whether the configuration was recorded
+   */
+  bool record(std::list<AnyTaskManager *> *taskManagers, unsigned long long int graphTime) {
+    Record record;
+    record.graphTime = graphTime;
+    for (AnyTaskManager *taskManager : *taskManagers) {
+      std::string key = TaskPlacement::getKey(taskManager);
+      record.numThreads[key] = taskManager->getNumThreads();
+
+      std::map<std::string, size_t> parameters = taskManager->getTaskFunction()->getTuningParameters();
+      if (!parameters.empty())
+        record.parameters[key] = parameters;
+
+      if (taskManager->getCpuAffinity() >= 0 && taskManager->getThreadId() < taskManager->getNumThreads()) {
+        std::vector<int> &cpus = record.placement[key];
+        cpus.resize(taskManager->getNumThreads(), -1);
+        cpus[taskManager->getThreadId()] = taskManager->getCpuAffinity();
+      }
+    }
+
+    std::string key = getKey(taskManagers);
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      auto it = records.find(key);
+      if (it != records.end() && it->second.graphTime <= graphTime)
+        return false;
+      records[key] = record;
+    }
+
+    save();
+    return true;
+  }
+
+  /**
+   * Loads the records from the file, replacing the records in memory. A missing file loads no records.
+   * @return whether the file was read
+   */
+  bool load() {
+    std::ifstream file(this->path);
+    std::unique_lock<std::mutex> lock(mutex);
+    records.clear();
+    if (!file.is_open())
+      return false;
+
+    std::string line;
+    Record *current = nullptr;
+    while (std::getline(file, line)) {
+      std::vector<std::string> fields = split(line, '\t');
+      if (fields.empty() || fields[0].empty() || fields[0][0] == '#')
+        continue;
+
+      if (fields[0] == "record" && fields.size() == 3) {
+        current = &records[fields[1]];
+        *current = Record();
+        current->graphTime = std::strtoull(fields[2].c_str(), nullptr, 10);
+      } else if (current == nullptr) {
+        continue;
+      } else if (fields[0] == "threads" && fields.size() == 3) {
+        current->numThreads[fields[1]] = std::strtoull(fields[2].c_str(), nullptr, 10);
+      } else if (fields[0] == "param" && fields.size() == 4) {
+        current->parameters[fields[1]][fields[2]] = std::strtoull(fields[3].c_str(), nullptr, 10);
+      } else if (fields[0] == "cpus" && fields.size() == 3) {
+        for (auto &cpu : split(fields[2], ','))
+          current->placement[fields[1]].push_back(std::atoi(cpu.c_str()));
+      } else if (fields[0] == "end") {
+        current = nullptr;
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Saves the records to the file. The file is written next to the profile and then renamed over it, so a profile
+   * that is being read is never partially written.
+   * @return whether the file was written
+   */
+  bool save() {
+    std::string tmpPath = this->path + ".tmp";
+    {
+      std::ofstream file(tmpPath);
+      if (!file.is_open())
+        return false;
+
+      std::unique_lock<std::mutex> lock(mutex);
+      file << "# HTGS tuning profile" << std::endl;
+      for (auto &entry : records) {
+        const Record &record = entry.second;
+        file << "record\t" << entry.first << "\t" << record.graphTime << std::endl;
+        for (auto &threads : record.numThreads)
+          file << "threads\t" << threads.first << "\t" << threads.second << std::endl;
+        for (auto &task : record.parameters)
+          for (auto &parameter : task.second)
+            file << "param\t" << task.first << "\t" << parameter.first << "\t" << parameter.second << std::endl;
+        for (auto &task : record.placement) {
+          file << "cpus\t" << task.first << "\t";
+          for (size_t i = 0; i < task.second.size(); i++)
+            file << (i == 0 ? "" : ",") << task.second[i];
+          file << std::endl;
+        }
+        file << "end" << std::endl;
+      }
+    }
+    return std::rename(tmpPath.c_str(), this->path.c_str()) == 0;
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static std::vector<std::string> split(const std::string &line, char delimiter) {
+    std::vector<std::string> fields;
+    std::istringstream iss(line);
+    std::string field;
+    while (std::getline(iss, field, delimiter))
+      fields.push_back(field);
+    return fields;
+  }
+  //! @endcond
+
+  std::string path; //!< The path of the file that stores the profile
+  CpuTopology topology; //!< The topology of the machine
+  bool applyEnabled; //!< Whether records are applied to graphs when they are executed
+  std::map<std::string, Record> records; //!< The best record for each graph and topology
+  std::mutex mutex; //!< Protects the records
+};
+}
+
+#endif //HTGS_TUNINGPROFILE_HPP
@@ -0,0 +1,419 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file WindowAggregateTask.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the WindowAggregateTask, which aggregates keyed data into tumbling or sliding event-time windows.
+ */
+#ifndef HTGS_WINDOWAGGREGATETASK_HPP
+#define HTGS_WINDOWAGGREGATETASK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <htgs/api/ITask.hpp>
+
+namespace htgs {
+
+/**
+ * @class WindowSpec WindowAggregateTask.hpp <htgs/api/WindowAggregateTask.hpp>
+ * @brief Describes the windows of a WindowAggregateTask in event-time units.
+ *
+ * @details
+ * Windows are aligned to multiples of the slide. A tumbling window has a slide equal to its size, so each event is in
+ * exactly one window. A sliding window has a slide smaller than its size, so each event is in size / slide windows.
+ */
+class WindowSpec {
+ public:
+  /**
+   * Creates a tumbling window specification
+   * @param size the size of each window
+   * @return the window specification
+   */
+  static WindowSpec tumbling(int64_t size) { return WindowSpec(size, size); }
+
+  /**
+   * Creates a sliding window specification
+   * @param size the size of each window
+   * @param slide the distance between the starts of consecutive windows, size must be a multiple of the slide
+   * @return the window specification
+   */
+  static WindowSpec sliding(int64_t size, int64_t slide) { return WindowSpec(size, slide); }
+
+  /**
+   * Gets the size of each window
+   * @return the window size
+   */
+  int64_t getSize() const { return size; }
+
+  /**
+   * Gets the distance between the starts of consecutive windows
+   * @return the window slide
+   */
+  int64_t getSlide() const { return slide; }
+
+  /**
+   * Gets whether the windows are tumbling
+   * @return whether the windows do not overlap
+   */
+  bool isTumbling() const { return size == slide; }
+
+ private:
+  //! @cond Doxygen_Suppress
+  WindowSpec(int64_t size, int64_t slide) : size(size), slide(slide) {
+    HTGS_ASSERT(slide > 0 && size >= slide && size % slide == 0,
+                "Window size (" << size << ") must be a positive multiple of the slide (" << slide << ")");
+  }
+  //! @endcond
+
+  int64_t size; //!< The size of each window
+  int64_t slide; //!< The distance between the starts of consecutive windows
+};
+
+/**
+ * @class WindowData WindowAggregateTask.hpp <htgs/api/WindowAggregateTask.hpp>
+ * @brief The aggregate of one key in one window, produced by a WindowAggregateTask.
+ * @tparam K the key type
+ * @tparam A the aggregate type
+ */
+template<class K, class A>
+class WindowData : public IData {
+ public:
+  /**
+   * Constructs window data
+   * @param key the key
+   * @param windowStart the start of the window (inclusive)
+   * @param windowEnd the end of the window (exclusive)
+   * @param aggregate the aggregate of the data with the key in the window
+   */
+  WindowData(K key, int64_t windowStart, int64_t windowEnd, A aggregate) :
+      key(key), windowStart(windowStart), windowEnd(windowEnd), aggregate(aggregate) {}
+
+  /**
+   * Gets the key
+   * @return the key
+   */
+  const K &getKey() const { return key; }
+
+  /**
+   * Gets the start of the window (inclusive)
+   * @return the window start
+   */
+  int64_t getWindowStart() const { return windowStart; }
+
+  /**
+   * Gets the end of the window (exclusive)
+   * @return the window end
+   */
+  int64_t getWindowEnd() const { return windowEnd; }
+
+  /**
+   * Gets the aggregate
+   * @return the aggregate of the data with the key in the window
+   */
+  const A &getAggregate() const { return aggregate; }
+
+ private:
+  K key; //!< The key
+  int64_t windowStart; //!< The start of the window
+  int64_t windowEnd; //!< The end of the window
+  A aggregate; //!< The aggregate
+};
+
+/**
+ * @class WindowAggregateTask WindowAggregateTask.hpp <htgs/api/WindowAggregateTask.hpp>
+ * @brief Aggregates data per key into tumbling or sliding event-time windows, emitting each window when the watermark
+ * passes its end.
+ *
+ * @details
+ * The key and event time of each data are obtained with user extractor functions. Data is aggregated incrementally
+ * into panes, which are slide-sized slices of time per key, using the add function. When a window is emitted, the panes
+ * of the window are combined with the merge function; for tumbling windows each window has one pane, so no merge
+ * function is needed.
+ *
+ * The watermark is the largest event time that has been seen minus the allowed lateness. When the watermark reaches
+ * the end of a window, a WindowData is produced for each key that has data in the window. Data with an event time
+ * below the watermark is late and is dropped (see getNumLateData). All remaining windows are emitted when the task
+ * terminates.
+ *
+ * The per-key state is held in a hash table that is split into shards, each with its own mutex, and is shared by all
+ * threads of the task. Threads only lock the shard of the key they are updating, and windows are emitted shard by
+ * shard, so there is no global lock for high rate streams. Within an ExecutionPipeline, each pipeline has its own
+ * state and emits the windows of the data it receives.
+ *
+ * Example usage:
+ * @code
+ * // Count readings and sum values per sensor per second (event time in milliseconds)
+ * struct Stats { size_t count = 0; double sum = 0.0; };
+ *
+ * auto windowTask = new htgs::WindowAggregateTask<SensorData, int, Stats>(
+ *     4, htgs::WindowSpec::tumbling(1000),
+ *     [](const SensorData &data) { return data.getSensorId(); },
+ *     [](const SensorData &data) { return data.getTime(); },
+ *     Stats(),
+ *     [](Stats &stats, const SensorData &data) { stats.count++; stats.sum += data.getValue(); });
+ * windowTask->setAllowedLateness(100);
+ *
+ * taskGraph->addEdge(readTask, windowTask);
+ * taskGraph->addEdge(windowTask, reportTask); // reportTask consumes htgs::WindowData<int, Stats>
+ * @endcode
+ *
+ * @tparam T the input type
+ * @tparam K the key type, must be hashable with std::hash
+ * @tparam A the aggregate type, must be copyable
+ */
+template<class T, class K, class A>
+class WindowAggregateTask : public ITask<T, WindowData<K, A>> {
+ public:
+  typedef std::function<K(const T &)> KeyFunction; //!< Extracts the key from data
+  typedef std::function<int64_t(const T &)> TimeFunction; //!< Extracts the event time from data
+  typedef std::function<void(A &, const T &)> AddFunction; //!< Adds data to an aggregate
+  typedef std::function<void(A &, const A &)> MergeFunction; //!< Merges an aggregate into another aggregate
+
+  /**
+   * Constructs a window aggregate task
+   * @param numThreads the number of threads for the task
+   * @param windowSpec the windows to aggregate into
+   * @param keyOf the function that extracts the key from data
+   * @param timeOf the function that extracts the event time from data
+   * @param initial the initial value of an aggregate
+   * @param add the function that adds data to an aggregate
+   * @param merge the function that merges an aggregate into another aggregate, required for sliding windows
+   * @param numShards the number of shards for the per-key state
+   */
+  WindowAggregateTask(size_t numThreads,
+                      WindowSpec windowSpec,
+                      KeyFunction keyOf,
+                      TimeFunction timeOf,
+                      A initial,
+                      AddFunction add,
+                      MergeFunction merge = nullptr,
+                      size_t numShards = 64) :
+      ITask<T, WindowData<K, A>>(numThreads),
+      state(std::make_shared<WindowState>(windowSpec, keyOf, timeOf, initial, add, merge, numShards)) {
+    HTGS_ASSERT(windowSpec.isTumbling() || merge != nullptr, "Sliding windows require a merge function");
+    HTGS_ASSERT(numShards > 0, "WindowAggregateTask must have at least one shard");
+  }
+
+  /**
+   * Sets how far the event time may be behind the largest event time seen before data is late.
+   * Must be set prior to executing the task graph.
+   * @param allowedLateness the allowed lateness in event-time units
+   */
+  void setAllowedLateness(int64_t allowedLateness) { this->state->allowedLateness = allowedLateness; }
+
+  /**
+   * Gets the current watermark
+   * @return the watermark, windows that end at or before the watermark have been emitted
+   */
+  int64_t getWatermark() const { return this->state->getWatermark(); }
+
+  /**
+   * Gets the number of data that arrived after the watermark passed its event time and were dropped
+   * @return the number of late data
+   */
+  size_t getNumLateData() const { return this->state->numLateData; }
+
+  void executeTask(std::shared_ptr<T> data) override {
+    WindowState &s = *this->state;
+    int64_t time = s.timeOf(*data);
+    K key = s.keyOf(*data);
+
+    // Update the pane for the key, only locking the shard for the key
+    Shard &shard = s.getShard(key);
+    {
+      std::unique_lock<std::mutex> lock(shard.mutex);
+
+      // Checked while holding the shard lock, so the windows for the data cannot be emitted until the data is added
+      if (time < s.getWatermark()) {
+        s.numLateData++;
+        return;
+      }
+
+      KeyState &keyState = shard.keys[key];
+      int64_t paneStart = s.alignDown(time);
+      auto pane = keyState.panes.find(paneStart);
+      if (pane == keyState.panes.end())
+        pane = keyState.panes.insert(std::make_pair(paneStart, s.initial)).first;
+      s.add(pane->second, *data);
+
+      int64_t firstWindow = paneStart - s.spec.getSize() + s.spec.getSlide();
+      if (keyState.nextWindowStart == NO_WINDOW || firstWindow < keyState.nextWindowStart)
+        keyState.nextWindowStart = firstWindow;
+
+      updateMinWindowEnd(shard, keyState.nextWindowStart + s.spec.getSize());
+    }
+
+    // Advance the watermark and emit the windows that it passed
+    int64_t maxTime = s.maxEventTime.load();
+    while (time > maxTime && !s.maxEventTime.compare_exchange_weak(maxTime, time)) {}
+
+    if (time > maxTime)
+      emitWindows(s.getWatermark());
+  }
+
+  void executeTaskFinal() override {
+    emitWindows(std::numeric_limits<int64_t>::max());
+  }
+
+  std::string getName() override { return "WindowAggregateTask"; }
+
+  WindowAggregateTask<T, K, A> *copy() override {
+    return new WindowAggregateTask<T, K, A>(this->getNumThreads(), this->state);
+  }
+
+  /**
+   * Copies the task. The copies for the threads of the task share its windows, whereas the copies for another task
+   * graph, such as for each pipeline of an ExecutionPipeline, aggregate their own windows from empty state.
+   * @param deep whether the copy is for another thread of the task
+   * @return the copy of the task
+   */
+  ITask<T, WindowData<K, A>> *copyITask(bool deep) override {
+    if (deep)
+      return ITask<T, WindowData<K, A>>::copyITask(deep);
+
+    return new WindowAggregateTask<T, K, A>(this->getNumThreads(), this->state->createEmpty());
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static constexpr int64_t NO_WINDOW = std::numeric_limits<int64_t>::min();
+
+  struct KeyState {
+    std::map<int64_t, A> panes;
+    int64_t nextWindowStart = NO_WINDOW;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_map<K, KeyState> keys;
+    std::atomic<int64_t> minWindowEnd{std::numeric_limits<int64_t>::max()};
+  };
+
+  struct WindowState {
+    WindowState(WindowSpec spec, KeyFunction keyOf, TimeFunction timeOf, A initial, AddFunction add,
+                MergeFunction merge, size_t numShards) :
+        spec(spec), keyOf(keyOf), timeOf(timeOf), initial(initial), add(add), merge(merge), shards(numShards),
+        allowedLateness(0), maxEventTime(std::numeric_limits<int64_t>::min()), numLateData(0) {}
+
+    std::shared_ptr<WindowState> createEmpty() const {
+      auto empty = std::make_shared<WindowState>(spec, keyOf, timeOf, initial, add, merge, shards.size());
+      empty->allowedLateness = allowedLateness;
+      return empty;
+    }
+
+    int64_t alignDown(int64_t time) const {
+      int64_t slide = spec.getSlide();
+      return time >= 0 ? time - time % slide : time - ((time % slide) + slide) % slide;
+    }
+
+    int64_t getWatermark() const {
+      int64_t maxTime = maxEventTime.load();
+      return maxTime == std::numeric_limits<int64_t>::min() ? maxTime : maxTime - allowedLateness;
+    }
+
+    Shard &getShard(const K &key) { return shards[std::hash<K>()(key) % shards.size()]; }
+
+    WindowSpec spec;
+    KeyFunction keyOf;
+    TimeFunction timeOf;
+    A initial;
+    AddFunction add;
+    MergeFunction merge;
+    std::vector<Shard> shards;
+    int64_t allowedLateness;
+    std::atomic<int64_t> maxEventTime;
+    std::atomic_size_t numLateData;
+  };
+
+  WindowAggregateTask(size_t numThreads, std::shared_ptr<WindowState> state) :
+      ITask<T, WindowData<K, A>>(numThreads), state(state) {}
+
+  static void updateMinWindowEnd(Shard &shard, int64_t windowEnd) {
+    int64_t current = shard.minWindowEnd.load();
+    while (windowEnd < current && !shard.minWindowEnd.compare_exchange_weak(current, windowEnd)) {}
+  }
+  //! @endcond
+
+  /**
+   * Emits the windows that end at or before the watermark, for each shard that has such a window
+   * @param watermark the watermark
+   */
+  void emitWindows(int64_t watermark) {
+    WindowState &s = *this->state;
+    for (Shard &shard : s.shards) {
+      if (shard.minWindowEnd.load() > watermark)
+        continue;
+
+      std::unique_lock<std::mutex> lock(shard.mutex);
+      int64_t minWindowEnd = std::numeric_limits<int64_t>::max();
+      for (auto it = shard.keys.begin(); it != shard.keys.end();) {
+        emitKey(it->first, it->second, watermark);
+        if (it->second.panes.empty()) {
+          it = shard.keys.erase(it);
+        } else {
+          minWindowEnd = std::min(minWindowEnd, it->second.nextWindowStart + s.spec.getSize());
+          ++it;
+        }
+      }
+      shard.minWindowEnd = minWindowEnd;
+    }
+  }
+
+  /**
+   * Emits the windows of a key that end at or before the watermark and removes the panes that are no longer needed
+   * @param key the key
+   * @param keyState the state of the key
+   * @param watermark the watermark
+   */
+  void emitKey(const K &key, KeyState &keyState, int64_t watermark) {
+    WindowState &s = *this->state;
+    int64_t size = s.spec.getSize();
+    int64_t slide = s.spec.getSlide();
+
+    while (!keyState.panes.empty() && keyState.nextWindowStart <= watermark - size) {
+      int64_t windowStart = keyState.nextWindowStart;
+
+      // Skip windows that have no panes
+      int64_t firstPane = keyState.panes.begin()->first;
+      if (firstPane >= windowStart + size) {
+        keyState.nextWindowStart = firstPane - size + slide;
+        continue;
+      }
+
+      auto pane = keyState.panes.begin();
+      A aggregate = pane->second;
+      for (++pane; pane != keyState.panes.end() && pane->first < windowStart + size; ++pane)
+        s.merge(aggregate, pane->second);
+
+      this->addResult(new WindowData<K, A>(key, windowStart, windowStart + size, aggregate));
+
+      // The first pane of the window is not in any later window
+      if (firstPane < windowStart + slide)
+        keyState.panes.erase(keyState.panes.begin());
+
+      keyState.nextWindowStart = windowStart + slide;
+    }
+  }
+
+  std::shared_ptr<WindowState> state; //!< The window state shared by all threads of the task
+};
+
+//! @cond Doxygen_Suppress
+template<class T, class K, class A>
+constexpr int64_t WindowAggregateTask<T, K, A>::NO_WINDOW;
+//! @endcond
+}
+
+#endif //HTGS_WINDOWAGGREGATETASK_HPP
@@ -13,7 +13,11 @@
 #define HTGS_ANYCONNECTOR_HPP
 
 #include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <sstream>
+#include <list>
+#include <mutex>
 
 #include <htgs/api/IData.hpp>
 #include <htgs/types/TaskGraphDotGenFlags.hpp>
@@ -42,7 +46,7 @@ class AnyConnector {
   /**
    * Constructor initializing the producer task count to 0.
    */
-  AnyConnector() : producerTaskCount(0) {}
+  AnyConnector() : producerTaskCount(0), pollTicks(0), demandDriven(false), demandCredits(0), demandClosed(false) {}
 
   /**
    * Virtual destructor.
@@ -152,6 +156,13 @@ class AnyConnector {
    */
   virtual void produceAnyData(std::shared_ptr<IData> data) = 0;
 
+  /**
+   * Gets a copy of all data that is currently in the Connector's queue, in the order that it would be consumed.
+   * The data remains in the queue.
+   * @return the data in the queue
+   */
+  virtual std::list<std::shared_ptr<IData>> snapshotAnyData() = 0;
+
   /**
    * Provide profile output for the produce operation
    * @param numThreads the number of threads associated with producing data
@@ -184,8 +195,207 @@ class AnyConnector {
    */
   virtual void resetMaxQueueSize() = 0;
 
+  /**
+   * Switches the connector to a lock-free queue for exactly one producer thread and one consumer thread (see
+   * SpscQueue). Data that is already in the connector is moved into the new queue.
+   * @return whether the connector uses the single-producer single-consumer queue
+   * @retval TRUE if the queue was switched
+   * @retval FALSE if the connector's queue discipline requires the blocking queue
+   *
+   * @note This function should only be called by the HTGS API prior to spawning threads (see TaskGraphRuntime)
+   * @internal
+   */
+  virtual bool enableSpscQueue() = 0;
+
+  /**
+   * Gets whether the connector uses the single-producer single-consumer queue
+   * @return whether the connector uses the single-producer single-consumer queue
+   */
+  virtual bool isUsingSpscQueue() = 0;
+
+  /**
+   * Allows producers to add data to the connector through separate lanes, which each have their own queue (see
+   * Connector::createLane). Consumers of the connector take data from whichever lane has data, so producers writing
+   * to different lanes do not contend on a single queue.
+   * @return whether the connector can be split into lanes
+   * @retval TRUE if lanes are enabled
+   * @retval FALSE if the connector must keep a single queue, such as when it orders data by priority, uses a queue
+   * discipline other than FIFO, uses the single-producer single-consumer queue, or is demand-driven
+   *
+   * @note This function should only be called by the HTGS API prior to spawning threads (see TaskGraphRuntime)
+   * @internal
+   */
+  virtual bool enableLanes() = 0;
+
+  /**
+   * Gets whether producers can add data to the connector through separate lanes
+   * @return whether lanes are enabled
+   */
+  virtual bool isUsingLanes() = 0;
+
+  /**
+   * Posts a timer that has expired and wakes up a consumer. Timers are delivered through the connector, so the timer
+   * is run by one of the threads consuming from the connector (see TaskManager).
+   * @param timerId the id of the timer
+   * @note This function should only be called by the HTGS API
+   */
+  void postTimer(uint64_t timerId) {
+    {
+      std::unique_lock<std::mutex> lock(this->timerMutex);
+      this->expiredTimers.push_back(timerId);
+    }
+    this->wakeupConsumer();
+  }
+
+  /**
+   * Posts a poll tick from a TimerWheel and wakes up a consumer, which then executes its polling task with nullptr.
+   * @note This function should only be called by the HTGS API
+   */
+  void postPollTick() {
+    {
+      std::unique_lock<std::mutex> lock(this->timerMutex);
+      this->pollTicks++;
+    }
+    this->wakeupConsumer();
+  }
+
+  /**
+   * Takes all of the timers that have expired
+   * @return the ids of the expired timers
+   * @note This function should only be called by the HTGS API
+   */
+  std::list<uint64_t> takeExpiredTimers() {
+    std::list<uint64_t> timers;
+    std::unique_lock<std::mutex> lock(this->timerMutex);
+    timers.swap(this->expiredTimers);
+    return timers;
+  }
+
+  /**
+   * Takes one poll tick
+   * @return whether there was a poll tick
+   * @note This function should only be called by the HTGS API
+   */
+  bool takePollTick() {
+    std::unique_lock<std::mutex> lock(this->timerMutex);
+    if (this->pollTicks == 0)
+      return false;
+
+    this->pollTicks--;
+    return true;
+  }
+
+  /**
+   * Switches the connector to demand-driven (pull) execution. Producers then only produce data for the connector
+   * when a consumer has requested it (see requestData and acquireDemand).
+   * @note This function should only be called by the HTGS API prior to spawning threads (see TaskGraphRuntime)
+   * @internal
+   */
+  void enableDemand() { this->demandDriven = true; }
+
+  /**
+   * Gets whether the connector uses demand-driven (pull) execution
+   * @return whether the connector is demand-driven
+   */
+  bool isDemandDriven() const { return this->demandDriven; }
+
+  /**
+   * Requests data from the producers of the connector by issuing demand credits. Does nothing if the connector is not
+   * demand-driven.
+   * @param count the number of data requested
+   */
+  void requestData(size_t count) {
+    if (!this->demandDriven || count == 0)
+      return;
+
+    {
+      std::unique_lock<std::mutex> lock(this->demandMutex);
+      this->demandCredits += count;
+    }
+    this->demandCondition.notify_all();
+  }
+
+  /**
+   * Waits until a consumer has requested data and takes one demand credit. Returns immediately if the connector
+   * is not demand-driven.
+   * @return whether a data should be produced
+   * @retval TRUE if a credit was taken or the connector is not demand-driven
+   * @retval FALSE if no more data will be requested (see closeDemand)
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  bool acquireDemand() {
+    if (!this->demandDriven)
+      return true;
+
+    std::unique_lock<std::mutex> lock(this->demandMutex);
+    this->demandCondition.wait(lock, [this] { return this->demandCredits > 0 || this->demandClosed; });
+
+    if (this->demandClosed)
+      return false;
+
+    this->demandCredits--;
+    return true;
+  }
+
+  /**
+   * Returns a demand credit that was taken with acquireDemand, but did not result in any data
+   * @note This function should only be called by the HTGS API
+   * @internal
+   */
+  void returnDemand() {
+    {
+      std::unique_lock<std::mutex> lock(this->demandMutex);
+      if (this->demandClosed)
+        return;
+      this->demandCredits++;
+    }
+    this->demandCondition.notify_one();
+  }
+
+  /**
+   * Indicates that the consumers of the connector will not request any more data, which wakes up the producers that
+   * are waiting for demand so that they can stop producing.
+   */
+  void closeDemand() {
+    if (!this->demandDriven)
+      return;
+
+    {
+      std::unique_lock<std::mutex> lock(this->demandMutex);
+      this->demandClosed = true;
+    }
+    this->demandCondition.notify_all();
+  }
+
+  /**
+   * Gets whether the consumers of the connector will not request any more data
+   * @return whether demand is closed
+   */
+  bool isDemandClosed() {
+    std::unique_lock<std::mutex> lock(this->demandMutex);
+    return this->demandClosed;
+  }
+
+  /**
+   * Gets the number of demand credits that have been requested, but not yet taken by a producer
+   * @return the number of outstanding demand credits
+   */
+  size_t getDemand() {
+    std::unique_lock<std::mutex> lock(this->demandMutex);
+    return this->demandCredits;
+  }
+
  private:
   std::atomic_size_t producerTaskCount; //!< The number of producers adding data to the connector
+  std::list<uint64_t> expiredTimers; //!< The timers that have expired and are waiting to be run by a consumer
+  size_t pollTicks; //!< The number of poll ticks waiting to be taken by a consumer
+  std::mutex timerMutex; //!< The mutex for the expired timers and poll ticks
+  bool demandDriven; //!< Whether producers only produce data that has been requested (pull execution)
+  size_t demandCredits; //!< The number of data requested by consumers that producers have not yet taken
+  bool demandClosed; //!< Whether consumers will not request any more data
+  std::mutex demandMutex; //!< The mutex for the demand credits
+  std::condition_variable demandCondition; //!< Signals producers waiting for demand
 
 };
 }
@@ -14,8 +14,12 @@
 #define HTGS_CONNECTOR_HPP
 
 #include <atomic>
-
+#include <chrono>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
 
 #if defined( __GLIBCXX__ ) || defined( __GLIBCPP__ )
 #include <cxxabi.h>
@@ -29,6 +33,8 @@
 #else
 #include <htgs/core/queue/BlockingQueue.hpp>
 #endif
+#include <htgs/core/queue/SpscQueue.hpp>
+#include <htgs/core/queue/LaneSignal.hpp>
 
 #include <htgs/core/graph/AnyConnector.hpp>
 
@@ -66,34 +72,183 @@ class Connector : public AnyConnector {
   /**
    * Initializes the Connector with no producer tasks.
    */
-  Connector() {}
+  Connector() : mergesLanes(false), nextLane(0), numPrefetched(0), prefetchUsed(false), capacity(0) {}
 
   /**
    * Destructor
    */
   ~Connector() {}
 
-  bool isInputTerminated() override { return super::getProducerCount() == 0 && this->queue.isEmpty(); }
+  bool isInputTerminated() override {
+    if (super::getProducerCount() != 0 || !(spscQueue ? spscQueue->isEmpty() : this->queue.isEmpty()))
+      return false;
+
+    if (mergesLanes) {
+      for (std::shared_ptr<Connector<T>> lane : *getLanes())
+        if (!lane->isInputTerminated())
+          return false;
+    }
+    return true;
+  }
+
+  Connector<T> *copy() override {
+    Connector<T> *connector = new Connector<T>();
+    connector->setQueueDiscipline(this->getQueueDiscipline());
+    connector->setLifoBound(this->getLifoBound());
+    return connector;
+  }
+
+  void wakeupConsumer() override {
+    if (spscQueue)
+      spscQueue->wakeup();
+    else
+      this->queue.Enqueue(nullptr);
+    notifyLanes();
+  }
+
+  bool enableSpscQueue() override {
+    if (spscQueue)
+      return true;
+
+    if (laneSignal)
+      return false;
+
+#ifdef USE_PRIORITY_QUEUE
+    return false;
+#else
+    if (this->getQueueDiscipline() != QueueDiscipline::FIFO)
+      return false;
+
+    spscQueue = std::unique_ptr<SpscQueue<std::shared_ptr<T>>>(new SpscQueue<std::shared_ptr<T>>());
+    while (!this->queue.isEmpty()) {
+      std::shared_ptr<T> data = this->queue.remove();
+      if (data == nullptr)
+        spscQueue->wakeup();
+      else
+        spscQueue->Enqueue(data);
+    }
+    return true;
+#endif
+  }
+
+  bool isUsingSpscQueue() override { return spscQueue != nullptr; }
+
+  bool enableLanes() override {
+    if (mergesLanes)
+      return true;
+
+#ifdef USE_PRIORITY_QUEUE
+    return false;
+#else
+    if (laneSignal || spscQueue || this->isDemandDriven() || this->getQueueDiscipline() != QueueDiscipline::FIFO)
+      return false;
 
-  Connector<T> *copy() override { return new Connector<T>(); }
+    this->laneSignal = std::make_shared<LaneSignal>();
+    std::atomic_store(&this->lanes, std::make_shared<const std::vector<std::shared_ptr<Connector<T>>>>());
+    this->mergesLanes = true;
+    return true;
+#endif
+  }
 
-  void wakeupConsumer() override { this->queue.Enqueue(nullptr); }
+  bool isUsingLanes() override { return mergesLanes; }
+
+  /**
+   * Creates a lane for a producer of this connector (see enableLanes). The lane is a connector of its own, with its
+   * own queue and producer count, whose data is taken by the consumers of this connector. Consumers check the lanes
+   * starting from a different lane each time and skip lanes that are empty, so no lane is starved.
+   *
+   * Data is consumed in the order it was produced within a lane, but data from different lanes may be interleaved in
+   * any order.
+   * @return the lane, or nullptr if lanes are not enabled for this connector
+   * @note Can be called while consumers are taking data from this connector
+   */
+  std::shared_ptr<Connector<T>> createLane() {
+    if (!mergesLanes)
+      return nullptr;
+
+    std::shared_ptr<Connector<T>> lane(new Connector<T>());
+    lane->laneSignal = this->laneSignal;
+
+    std::unique_lock<std::mutex> lock(this->laneMutex);
+    auto newLanes = std::make_shared<std::vector<std::shared_ptr<Connector<T>>>>(*getLanes());
+    newLanes->push_back(lane);
+    std::atomic_store(&this->lanes, std::shared_ptr<const std::vector<std::shared_ptr<Connector<T>>>>(newLanes));
+
+    return lane;
+  }
+
+  /**
+   * Gets the number of lanes that have been created for this connector
+   * @return the number of lanes
+   */
+  size_t getNumLanes() {
+    return mergesLanes ? getLanes()->size() : 0;
+  }
+
+  /**
+   * Sets the order in which data is consumed from the connector.
+   * @param discipline the queue discipline
+   * @note Should only be set prior to producing data for the connector
+   */
+  void setQueueDiscipline(QueueDiscipline discipline) { this->queue.setDiscipline(discipline); }
+
+  /**
+   * Gets the order in which data is consumed from the connector.
+   * @return the queue discipline
+   */
+  QueueDiscipline getQueueDiscipline() const { return this->queue.getDiscipline(); }
+
+  /**
+   * Sets the number of data that are consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO, before the
+   * oldest data is consumed.
+   * @param bound the bound
+   */
+  void setLifoBound(size_t bound) { this->queue.setLifoBound(bound); }
+
+  /**
+   * Gets the number of data that are consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO
+   * @return the bound
+   */
+  size_t getLifoBound() const { return this->queue.getLifoBound(); }
+
+  /**
+   * Sets the maximum number of data that can be in the connector at once, such as the number of elements of memory
+   * that a memory manager produces for its memory edge.
+   * @param capacity the capacity, 0 if unbounded
+   */
+  void setCapacity(size_t capacity) { this->capacity = capacity; }
+
+  /**
+   * Gets the maximum number of data that can be in the connector at once.
+   * @return the capacity, 0 if unbounded
+   */
+  size_t getCapacity() const { return this->capacity; }
 
   void profileProduce(size_t numThreads) override {}
 
   void profileConsume(size_t numThreads, bool showQueueSize) override {
 #ifdef PROFILE
-    std::cout << "consume largest queue size: " << queue.getQueueActiveMaxSize() << std::endl;
+    std::cout << "consume largest queue size: " << getMaxQueueSize() << std::endl;
 #endif
   }
 
   size_t getQueueSize() override {
-    return this->queue.size();
+    size_t queueSize = spscQueue ? spscQueue->size() : this->queue.size();
+    if (mergesLanes) {
+      for (std::shared_ptr<Connector<T>> lane : *getLanes())
+        queueSize += lane->getQueueSize();
+    }
+    return queueSize;
   }
 
   size_t getMaxQueueSize() override {
 #ifdef PROFILE
-    return queue.getQueueActiveMaxSize();
+    size_t maxQueueSize = spscQueue ? spscQueue->getQueueActiveMaxSize() : queue.getQueueActiveMaxSize();
+    if (mergesLanes) {
+      for (std::shared_ptr<Connector<T>> lane : *getLanes())
+        maxQueueSize += lane->getMaxQueueSize();
+    }
+    return maxQueueSize;
 #else
     return 0;
 #endif
@@ -101,15 +256,24 @@ class Connector : public AnyConnector {
 
   void resetMaxQueueSize() override {
 #ifdef PROFILE
+    if (spscQueue)
+      spscQueue->resetMaxQueueSize();
     this->queue.resetMaxQueueSize();
+    if (mergesLanes) {
+      for (std::shared_ptr<Connector<T>> lane : *getLanes())
+        lane->resetMaxQueueSize();
+    }
 #endif
   }
 
   void produceAnyData(std::shared_ptr<IData> data) override {
     HTGS_DEBUG_VERBOSE("Connector " << this << " producing any data: " << data);
     std::shared_ptr<T> dataCast = std::dynamic_pointer_cast<T>(data);
-    this->queue.Enqueue(dataCast);
-
+    if (spscQueue)
+      spscQueue->Enqueue(dataCast);
+    else
+      this->queue.Enqueue(dataCast);
+    notifyLanes();
   }
 
   /**
@@ -123,7 +287,22 @@ class Connector : public AnyConnector {
    * @internal
    */
   std::shared_ptr<T> pollConsumeData(size_t timeout) {
-    std::shared_ptr<T> data = this->queue.poll(timeout);
+    if (mergesLanes) {
+      auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout);
+      std::shared_ptr<T> data;
+      while (true) {
+        size_t key = laneSignal->prepareWait();
+        if (tryConsumeLanes(data))
+          return data;
+
+        auto now = std::chrono::steady_clock::now();
+        if (now >= deadline
+            || !laneSignal->waitFor(key, (size_t) std::chrono::duration_cast<std::chrono::microseconds>(deadline - now).count()))
+          return tryConsumeLanes(data) ? data : nullptr;
+      }
+    }
+
+    std::shared_ptr<T> data = spscQueue ? spscQueue->poll(timeout) : this->queue.poll(timeout);
     return data;
   }
 
@@ -135,29 +314,175 @@ class Connector : public AnyConnector {
    * @internal
    */
   std::shared_ptr<T> consumeData() {
-    std::shared_ptr<T> data = this->queue.Dequeue();
+    if (mergesLanes) {
+      std::shared_ptr<T> data;
+      while (true) {
+        size_t key = laneSignal->prepareWait();
+        if (tryConsumeLanes(data))
+          return data;
+        laneSignal->wait(key);
+      }
+    }
+
+    std::shared_ptr<T> data = spscQueue ? spscQueue->Dequeue() : this->queue.Dequeue();
+    return data;
+  }
+
+  std::list<std::shared_ptr<IData>> snapshotAnyData() override {
+    std::list<std::shared_ptr<IData>> snapshot;
+    for (auto data : this->peekData(this->getQueueSize()))
+      snapshot.push_back(data);
+    return snapshot;
+  }
+
+  /**
+   * Gets up to count data elements that are next in the queue without consuming them.
+   * @param count the maximum number of elements to look ahead
+   * @return the list of data that will be consumed next, nullptr entries are excluded
+   *
+   * @note Data may be consumed by another thread at any time after this function returns.
+   * @internal
+   */
+  std::list<std::shared_ptr<T>> peekData(size_t count) {
+    std::list<std::shared_ptr<T>> data = spscQueue ? spscQueue->peek(count) : this->queue.peek(count);
+    if (mergesLanes) {
+      for (std::shared_ptr<Connector<T>> lane : *getLanes())
+        if (data.size() < count)
+          data.splice(data.end(), lane->peekData(count - data.size()));
+    }
+    data.remove(nullptr);
+    return data;
+  }
+
+  /**
+   * Gets the data among the next count data in the queue that have not been prefetched yet, and marks them as
+   * prefetched, so that each data is only prefetched once by all consumers of the connector (see ITask::prefetch).
+   * The queue is not inspected if count data are already marked as prefetched.
+   * @param count the maximum number of elements to look ahead
+   * @return the list of data that have not been prefetched yet
+   *
+   * @note Data is unmarked once consumed with prefetchConsumed
+   * @internal
+   */
+  std::list<std::shared_ptr<T>> peekDataToPrefetch(size_t count) {
+    std::list<std::shared_ptr<T>> data;
+    if (this->numPrefetched.load() >= count)
+      return data;
+
+    // Set before peeking, a consumer that still sees it unset dequeued its data before the peek, so it was not marked
+    this->prefetchUsed = true;
+
+    // Peek while holding the lock, so that data consumed and unmarked by another thread cannot be marked again
+    std::unique_lock<std::mutex> lock(this->prefetchMutex);
+    data = this->peekData(count);
+    for (auto it = data.begin(); it != data.end();) {
+      if (this->prefetched.insert(*it).second)
+        ++it;
+      else
+        it = data.erase(it);
+    }
+    this->numPrefetched = this->prefetched.size();
     return data;
   }
 
+  /**
+   * Unmarks data that was marked as prefetched by peekDataToPrefetch, must be called once the data has been consumed.
+   * @param data the data that was consumed
+   * @internal
+   */
+  void prefetchConsumed(const std::shared_ptr<T> &data) {
+    // The number of marked data is not checked without the lock, as a peek in progress may mark the data right after
+    // the check, the lock is only skipped if data has never been peeked for prefetching
+    if (!this->prefetchUsed.load())
+      return;
+
+    std::unique_lock<std::mutex> lock(this->prefetchMutex);
+    this->prefetched.erase(data);
+    this->numPrefetched = this->prefetched.size();
+  }
+
+  /**
+   * Consumes count data from the queue at once.
+   * @param count the number of data to consume
+   * @return the list of data
+   *
+   * @note This function will block until count data are available, no data is consumed while waiting. If lanes are
+   * enabled, data is consumed as it arrives until count data have been consumed.
+   * @internal
+   */
+  std::list<std::shared_ptr<T>> consumeDataBatch(size_t count) {
+    if (spscQueue || mergesLanes) {
+      std::list<std::shared_ptr<T>> data;
+      for (size_t i = 0; i < count; i++)
+        data.push_back(this->consumeData());
+      return data;
+    }
+    return this->queue.DequeueBatch(count);
+  }
+
+  /**
+   * Gets the largest number of data that a consumer waiting in consumeDataBatch is waiting for.
+   * @return the number of data, 0 if no consumer is waiting for a batch
+   * @note Consumers of the SPSC queue or of lanes take a batch one data at a time, and are not reported.
+   */
+  size_t getBatchDemand() {
+    return spscQueue || mergesLanes ? 0 : this->queue.getBatchDemand();
+  }
+
   /**
    * Produces data into the queue.
    * @param data the data to be added
    */
   void produceData(std::shared_ptr<T> data) {
     HTGS_DEBUG_VERBOSE("Connector " << this << " producing data: " << data);
-    this->queue.Enqueue(data);
+    if (spscQueue)
+      spscQueue->Enqueue(data);
+    else
+      this->queue.Enqueue(data);
+    notifyLanes();
   }
 
   /**
-   * Produces a list of data adding each element into the queue.
+   * Produces a list of data adding each element into the queue. The queue is locked once for the entire list.
    * @param data the list of data t obe added
    */
   void produceData(std::list<std::shared_ptr<T>> *data) {
-    for (std::shared_ptr<T> v : *data) {
-      HTGS_DEBUG_VERBOSE("Connector " << this << " producing list data: " << v);
+    if (spscQueue) {
+      for (std::shared_ptr<T> v : *data)
+        spscQueue->Enqueue(v);
+    } else {
+      this->queue.EnqueueBatch(*data);
+    }
+    notifyLanes();
+  }
 
-      this->queue.Enqueue(v);
+  /**
+   * Consumes up to count data that are available in the queue at once.
+   * @param count the maximum number of data to consume
+   * @param wait whether to wait until at least one data is available
+   * @return the list of data, which may include nullptr if the consumers have been woken up
+   * @internal
+   */
+  std::list<std::shared_ptr<T>> consumeAvailableData(size_t count, bool wait) {
+    if (mergesLanes) {
+      std::list<std::shared_ptr<T>> data;
+      std::shared_ptr<T> next;
+      if (wait && count > 0)
+        data.push_back(this->consumeData());
+      while (data.size() < count && tryConsumeLanes(next))
+        data.push_back(next);
+      return data;
     }
+
+    if (spscQueue) {
+      std::list<std::shared_ptr<T>> data;
+      if (wait && count > 0)
+        data.push_back(spscQueue->Dequeue());
+      while (data.size() < count && !spscQueue->isEmpty())
+        data.push_back(spscQueue->Dequeue());
+      return data;
+    }
+    return this->queue.DequeueAvailable(count, wait);
   }
 
 #ifdef PROFILE_QUEUE
@@ -191,6 +516,48 @@ class Connector : public AnyConnector {
  private:
   //! @cond Doxygen_Suppress
   typedef AnyConnector super;
+
+  /**
+   * Gets the current list of lanes
+   * @return the lanes
+   */
+  std::shared_ptr<const std::vector<std::shared_ptr<Connector<T>>>> getLanes() const {
+    return std::atomic_load(&this->lanes);
+  }
+
+  /**
+   * Takes the next data from this connector's queue or one of its lanes without waiting. Each call starts from the
+   * next queue in turn, and queues that are empty are skipped without locking them.
+   * @param data the data that was taken
+   * @return whether data was taken
+   */
+  bool tryConsumeLanes(std::shared_ptr<T> &data) {
+    auto laneList = getLanes();
+    size_t numQueues = laneList->size() + 1;
+    size_t start = this->nextLane++;
+
+    for (size_t i = 0; i < numQueues; i++) {
+      size_t index = (start + i) % numQueues;
+      auto &laneQueue = index == laneList->size() ? this->queue : (*laneList)[index]->queue;
+      if (laneQueue.isEmpty())
+        continue;
+
+      std::list<std::shared_ptr<T>> taken = laneQueue.DequeueAvailable(1, false);
+      if (!taken.empty()) {
+        data = taken.front();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   * Notifies the consumers of the connector that merges this lane that data was added
+   */
+  void notifyLanes() {
+    if (laneSignal)
+      laneSignal->notify();
+  }
   //! @endcond
 
 #ifdef USE_PRIORITY_QUEUE
@@ -199,6 +566,20 @@ class Connector : public AnyConnector {
   BlockingQueue <std::shared_ptr<T>>
 #endif
       queue; //!< The blocking queue associated with the connector (thread safe) (can be switched to a priority queue using the USE_PRIORITY_QUEUE directive)
+
+  std::unique_ptr<SpscQueue<std::shared_ptr<T>>> spscQueue; //!< The single-producer single-consumer queue that replaces the blocking queue when enabled (see enableSpscQueue)
+
+  bool mergesLanes; //!< Whether consumers take data from the lanes of this connector (see enableLanes)
+  std::shared_ptr<LaneSignal> laneSignal; //!< The signal shared by this connector and its lanes, that wakes up consumers waiting for data
+  std::shared_ptr<const std::vector<std::shared_ptr<Connector<T>>>> lanes; //!< The lanes, which are replaced as a whole when a lane is created (see createLane)
+  std::mutex laneMutex; //!< The mutex for creating lanes
+  std::atomic_size_t nextLane; //!< The queue that the next consumer starts checking for data
+
+  std::set<std::weak_ptr<T>, std::owner_less<std::weak_ptr<T>>> prefetched; //!< The queued data that has been prefetched (see peekDataToPrefetch)
+  std::atomic_size_t numPrefetched; //!< The number of queued data that has been prefetched
+  std::mutex prefetchMutex; //!< The mutex to protect the prefetched data
+  std::atomic_bool prefetchUsed; //!< Whether data has been peeked for prefetching from this connector
+  std::atomic_size_t capacity; //!< The maximum number of data that can be in the connector at once (0 if unbounded)
 };
 }
 
@@ -0,0 +1,92 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+
+/**
+ * @file DeadlineEdge.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the deadline edge that connects two tasks with earliest deadline first ordering.
+ */
+#ifndef HTGS_DEADLINEEDGE_HPP
+#define HTGS_DEADLINEEDGE_HPP
+
+#include <htgs/core/graph/edge/ProducerConsumerEdge.hpp>
+#include <htgs/types/QueueDiscipline.hpp>
+
+namespace htgs {
+
+/**
+ * @class DeadlineEdge DeadlineEdge.hpp <htgs/core/graph/edge/DeadlineEdge.hpp>
+ * @brief Implements the deadline edge that connects two tasks where the consumer processes
+ * data using earliest deadline first (EDF) ordering.
+ *
+ * The edge is applied as a ProducerConsumerEdge, and then the consumer's input connector is set to use
+ * QueueDiscipline::Priority and deadline expiry is enabled for the consumer task manager. Data that
+ * derives from IDeadlineData and has passed its deadline when it is consumed is diverted to the
+ * fallback task or dropped if there is no fallback task.
+ *
+ * When the edge is copied the ITasks that represent the producer, consumer, and fallback are retrieved
+ * from the task graph that will become the copied graph.
+ *
+ * @tparam T the input type of the producer task
+ * @tparam U the output type of the producer task and the input type of the consumer and fallback tasks
+ * @tparam W the output type of the consumer task
+ * @tparam X the output type of the fallback task
+ */
+template<class T, class U, class W, class X>
+class DeadlineEdge : public EdgeDescriptor {
+ public:
+
+  /**
+   * Constructs a deadline edge.
+   * @param producer the task producing data
+   * @param consumer the task consuming the data from the producer task in earliest deadline first order
+   * @param fallback the task that receives expired data, or nullptr to drop expired data
+   */
+  DeadlineEdge(ITask<T, U> *producer, ITask<U, W> *consumer, ITask<U, X> *fallback) :
+      producer(producer), consumer(consumer), fallback(fallback) {}
+
+  ~DeadlineEdge() override {}
+
+  void applyEdge(AnyTaskGraphConf *graph) override {
+    ProducerConsumerEdge<T, U, W> producerConsumerEdge(producer, consumer);
+    producerConsumerEdge.applyEdge(graph);
+
+    TaskManager<U, W> *consumerTaskManager = graph->getTaskManager(consumer);
+
+    auto connector = std::static_pointer_cast<Connector<U>>(consumerTaskManager->getInputConnector());
+    connector->setQueueDiscipline(QueueDiscipline::Priority);
+
+    std::shared_ptr<AnyConnector> expiredConnector = nullptr;
+    if (fallback != nullptr) {
+      TaskManager<U, X> *fallbackTaskManager = graph->getTaskManager(fallback);
+
+      expiredConnector = fallbackTaskManager->getInputConnector();
+      if (expiredConnector == nullptr) {
+        expiredConnector = std::shared_ptr<Connector<U>>(new Connector<U>());
+        fallbackTaskManager->setInputConnector(expiredConnector);
+      }
+
+      expiredConnector->incrementInputTaskCount();
+    }
+
+    consumerTaskManager->setDeadlineExpiry(true, expiredConnector);
+  }
+
+  EdgeDescriptor *copy(AnyTaskGraphConf *graph) override {
+    return new DeadlineEdge(graph->getCopy(producer),
+                            graph->getCopy(consumer),
+                            fallback == nullptr ? nullptr : graph->getCopy(fallback));
+  }
+
+ private:
+  ITask<T, U> *producer; //!< The producer ITask
+  ITask<U, W> *consumer; //!< The consumer ITask
+  ITask<U, X> *fallback; //!< The ITask that receives expired data (nullptr drops expired data)
+
+};
+}
+#endif //HTGS_DEADLINEEDGE_HPP
@@ -34,7 +34,7 @@ namespace htgs {
       bookkeeper->addRuleManager(ruleManager);
     }
 
-    void updateEdge(std::shared_ptr<Connector<T>> newConnector, AnyTaskGraphConf *graph) override {
+    void updateEdge(std::shared_ptr<Connector<U>> newConnector, AnyTaskGraphConf *graph) override {
       auto taskManager = graph->getTaskManager(bookkeeper);
       auto oldConnector = this->getGraphConnector();
 
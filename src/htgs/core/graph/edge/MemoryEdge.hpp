@@ -79,6 +79,7 @@ class MemoryEdge : public EdgeDescriptor {
 
     memTaskManager->setInputConnector(releaseMemoryConnector);
     memTaskManager->setOutputConnector(getMemoryConnector);
+    getMemoryConnector->setCapacity(memoryManager->getMemoryCapacity());
 
     getMemoryConnector->incrementInputTaskCount();
     releaseMemoryConnector->incrementInputTaskCount();
@@ -15,6 +15,7 @@
 #include <htgs/core/graph/edge/EdgeDescriptor.hpp>
 #include <htgs/api/ITask.hpp>
 #include <htgs/core/graph/AnyTaskGraphConf.hpp>
+#include <htgs/types/QueueDiscipline.hpp>
 #ifdef WS_PROFILE
 #include <htgs/core/graph/profile/CustomProfile.hpp>
 #endif
@@ -29,6 +30,9 @@ namespace htgs {
  * The edge is applied by getting the task managers for two ITasks and setting the output and
  * input connectors for the producer and consumer tasks to be the same, respectively.
  *
+ * If the edge has a queue discipline other than QueueDiscipline::FIFO, then the consumer's input connector is set to
+ * use that discipline.
+ *
  * When the edge is copied the ITasks that represent the producer and consumer are retrieved
  * from the task graph that will become the copied graph.
  *
@@ -45,7 +49,18 @@ class ProducerConsumerEdge : public EdgeDescriptor {
    * @param producer the task producing data
    * @param consumer the task consuming the data from the producer task
    */
-  ProducerConsumerEdge(ITask<T, U> *producer, ITask<U, W> *consumer) : producer(producer), consumer(consumer) {}
+  ProducerConsumerEdge(ITask<T, U> *producer, ITask<U, W> *consumer) :
+      producer(producer), consumer(consumer), discipline(QueueDiscipline::FIFO), lifoBound(HTGS_DEFAULT_LIFO_BOUND) {}
+
+  /**
+   * Constructs a producer consumer edge, where the consumer consumes data in the order given by a queue discipline.
+   * @param producer the task producing data
+   * @param consumer the task consuming the data from the producer task
+   * @param discipline the order in which the consumer consumes data
+   * @param lifoBound the number of data consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO
+   */
+  ProducerConsumerEdge(ITask<T, U> *producer, ITask<U, W> *consumer, QueueDiscipline discipline, size_t lifoBound) :
+      producer(producer), consumer(consumer), discipline(discipline), lifoBound(lifoBound) {}
 
   ~ProducerConsumerEdge() override {}
 
@@ -73,6 +88,12 @@ class ProducerConsumerEdge : public EdgeDescriptor {
 
     connector->incrementInputTaskCount();
 
+    if (discipline != QueueDiscipline::FIFO) {
+      auto connectorCast = std::static_pointer_cast<Connector<U>>(connector);
+      connectorCast->setQueueDiscipline(discipline);
+      connectorCast->setLifoBound(lifoBound);
+    }
+
     consumerTaskManager->setInputConnector(connector);
     producerTaskManager->setOutputConnector(connector);
 #ifdef WS_PROFILE
@@ -99,12 +120,14 @@ class ProducerConsumerEdge : public EdgeDescriptor {
   }
 
   EdgeDescriptor *copy(AnyTaskGraphConf *graph) override {
-    return new ProducerConsumerEdge(graph->getCopy(producer), graph->getCopy(consumer));
+    return new ProducerConsumerEdge(graph->getCopy(producer), graph->getCopy(consumer), discipline, lifoBound);
   }
 
  private:
   ITask<T, U> *producer; //!< The producer ITask
   ITask<U, W> *consumer; //!< The consumer ITask
+  QueueDiscipline discipline; //!< The order in which the consumer consumes data
+  size_t lifoBound; //!< The number of data consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO
 
 };
 }
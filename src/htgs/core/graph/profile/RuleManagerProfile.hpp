@@ -0,0 +1,203 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file RuleManagerProfile.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the RuleManagerProfile class that is used to gather profile data for a rule manager.
+ */
+
+#ifndef HTGS_RULEMANAGERPROFILE_HPP
+#define HTGS_RULEMANAGERPROFILE_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <htgs/types/TaskGraphDotGenFlags.hpp>
+
+/**
+ * @def HTGS_RULE_PROFILE_NUM_BUCKETS
+ * @brief The number of buckets in the apply time histogram of a RuleManagerProfile.
+ * Bucket i holds the applications that took less than 10^i microseconds, and the last bucket holds the rest.
+ */
+#define HTGS_RULE_PROFILE_NUM_BUCKETS 8
+
+namespace htgs {
+
+/**
+ * @class RuleManagerProfile RuleManagerProfile.hpp <htgs/core/graph/profile/RuleManagerProfile.hpp>
+ * @brief Implements a rule manager profile that holds profiling data for a rule manager.
+ * @details
+ * Records the number of times the rule was applied, the time spent inside IRule::applyRuleFunction (total and as a
+ * histogram), the time spent waiting for the rule's mutex, the number of data emitted and the time at which the rule
+ * manager terminated. Times are in nanoseconds, as most rules complete in well under a microsecond.
+ *
+ * @note Add the PROFILE directive during compilation to enable profiling
+ */
+class RuleManagerProfile {
+ public:
+
+  /**
+   * Constructs a rule manager profile with no profiling data.
+   */
+  RuleManagerProfile() {
+    invocations = 0;
+    applyTime = 0;
+    lockWaitTime = 0;
+    lockContentions = 0;
+    outputs = 0;
+    terminationTime = 0;
+    for (size_t i = 0; i < HTGS_RULE_PROFILE_NUM_BUCKETS; i++)
+      histogram[i] = 0;
+  }
+
+  /**
+   * Adds one application of the rule to the profile.
+   * @param applyTime the time spent applying the rule (ns)
+   * @param lockWaitTime the time spent waiting for the rule's mutex (ns)
+   * @param contended whether the rule's mutex was held by another thread
+   * @param numOutputs the number of data emitted by the rule
+   */
+  void addInvocation(unsigned long long int applyTime, unsigned long long int lockWaitTime, bool contended,
+                     size_t numOutputs) {
+    this->invocations++;
+    this->applyTime += applyTime;
+    this->lockWaitTime += lockWaitTime;
+    this->lockContentions += contended ? 1 : 0;
+    this->outputs += numOutputs;
+
+    size_t bucket = 0;
+    unsigned long long int limit = 1000;
+    while (bucket < HTGS_RULE_PROFILE_NUM_BUCKETS - 1 && applyTime >= limit) {
+      bucket++;
+      limit *= 10;
+    }
+    this->histogram[bucket]++;
+  }
+
+  /**
+   * Sets the time at which the rule manager terminated, relative to when it was initialized
+   * @param terminationTime the termination time (ns)
+   */
+  void setTerminationTime(unsigned long long int terminationTime) { this->terminationTime = terminationTime; }
+
+  /**
+   * Generates the dot contents for the rule manager profile. The flags control whether the profile is shown.
+   * @param flags The DOTGEN flags
+   * @return the profiling data for dot graphviz.
+   */
+  std::string genDot(int flags) const {
+    std::string ret = "";
+#ifdef PROFILE
+    if ((flags & DOTGEN_FLAG_HIDE_RULE_PROFILE) == 0) {
+      ret += "invocations: " + std::to_string(invocations) + "\\n";
+      ret += "applyTime: " + std::to_string((double) applyTime / 1000000000.0) + " s\\n";
+      if (lockWaitTime > 0)
+        ret += "lockWaitTime: " + std::to_string((double) lockWaitTime / 1000000000.0) + " s (" +
+            std::to_string(lockContentions) + " contended)\\n";
+      ret += "emissionRatio: " + std::to_string(getEmissionRatio()) + "\\n";
+      if (terminationTime > 0)
+        ret += "terminationTime: " + std::to_string((double) terminationTime / 1000000000.0) + " s\\n";
+    }
+#endif
+    return ret;
+  }
+
+  /**
+   * Output stream operator to output the rule manager profile to a stream.
+   * @param os the output stream
+   * @param profile the profile to output
+   * @return the output stream
+   */
+  friend std::ostream &operator<<(std::ostream &os, const RuleManagerProfile &profile) {
+    os << "invocations: " << profile.invocations << " applyTime: " << profile.applyTime << " lockWaitTime: "
+       << profile.lockWaitTime << " lockContentions: " << profile.lockContentions << " outputs: " << profile.outputs
+       << " emissionRatio: " << profile.getEmissionRatio() << " terminationTime: " << profile.terminationTime
+       << " applyTimeHistogram:";
+    for (size_t i = 0; i < HTGS_RULE_PROFILE_NUM_BUCKETS; i++)
+      os << " " << profile.histogram[i];
+    return os;
+  }
+
+  /**
+   * Gets the number of times the rule was applied
+   * @return the number of invocations
+   */
+  size_t getInvocations() const { return invocations; }
+
+  /**
+   * Gets the total time spent applying the rule
+   * @return the apply time (ns)
+   */
+  unsigned long long int getApplyTime() const { return applyTime; }
+
+  /**
+   * Gets the total time spent waiting for the rule's mutex
+   * @return the lock wait time (ns)
+   */
+  unsigned long long int getLockWaitTime() const { return lockWaitTime; }
+
+  /**
+   * Gets the number of applications that found the rule's mutex held by another thread
+   * @return the number of contended lock acquisitions
+   */
+  size_t getLockContentions() const { return lockContentions; }
+
+  /**
+   * Gets the number of data emitted by the rule
+   * @return the number of outputs
+   */
+  size_t getOutputs() const { return outputs; }
+
+  /**
+   * Gets the number of data emitted per input data
+   * @return the emission ratio, or 0 if the rule was never applied
+   */
+  double getEmissionRatio() const { return invocations == 0 ? 0.0 : (double) outputs / (double) invocations; }
+
+  /**
+   * Gets the time at which the rule manager terminated, relative to when it was initialized
+   * @return the termination time (ns), or 0 if the rule manager has not terminated
+   */
+  unsigned long long int getTerminationTime() const { return terminationTime; }
+
+  /**
+   * Gets the number of applications within a bucket of the apply time histogram
+   * @param bucket the bucket, bucket i holds the applications that took less than 10^i microseconds
+   * @return the number of applications in the bucket
+   */
+  size_t getHistogramCount(size_t bucket) const { return histogram[bucket]; }
+
+  /**
+   * Adds the profile data of another rule manager profile to this profile.
+   * The termination time is the latest of the two.
+   * @param other the other rule manager profile
+   */
+  void sum(const RuleManagerProfile &other) {
+    this->invocations += other.invocations;
+    this->applyTime += other.applyTime;
+    this->lockWaitTime += other.lockWaitTime;
+    this->lockContentions += other.lockContentions;
+    this->outputs += other.outputs;
+    if (other.terminationTime > this->terminationTime)
+      this->terminationTime = other.terminationTime;
+    for (size_t i = 0; i < HTGS_RULE_PROFILE_NUM_BUCKETS; i++)
+      this->histogram[i] += other.histogram[i];
+  }
+
+ private:
+  size_t invocations; //!< The number of times the rule was applied
+  unsigned long long int applyTime; //!< The time spent applying the rule (ns)
+  unsigned long long int lockWaitTime; //!< The time spent waiting for the rule's mutex (ns)
+  size_t lockContentions; //!< The number of applications that found the rule's mutex held by another thread
+  size_t outputs; //!< The number of data emitted by the rule
+  unsigned long long int terminationTime; //!< The time the rule manager terminated after initialization (ns)
+  size_t histogram[HTGS_RULE_PROFILE_NUM_BUCKETS]; //!< The number of applications per apply time bucket
+
+};
+}
+#endif //HTGS_RULEMANAGERPROFILE_HPP
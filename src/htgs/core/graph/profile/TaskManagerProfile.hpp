@@ -15,7 +15,9 @@
 
 #include <cstddef>
 #include <ostream>
+#include <vector>
 #include <htgs/types/TaskGraphDotGenFlags.hpp>
+#include <htgs/core/graph/profile/RuleManagerProfile.hpp>
 namespace htgs {
 
 /**
@@ -35,6 +37,7 @@ class TaskManagerProfile {
     waitTime = 0;
     maxQueueSize = 0;
     memoryWaitTime = 0;
+    deadlineMisses = 0;
   }
 
   /**
@@ -43,9 +46,10 @@ class TaskManagerProfile {
    * @param waitTime the wait time
    * @param maxQueueSize the max queue size
    * @param memoryWaitTime the amount of time spent waiting for data from a memory manager
+   * @param deadlineMisses the number of data that expired prior to being processed
    */
-  TaskManagerProfile(unsigned long long int computeTime, unsigned long long int waitTime, size_t maxQueueSize, unsigned long long int memoryWaitTime)
-      : computeTime(computeTime), waitTime(waitTime), memoryWaitTime(memoryWaitTime), maxQueueSize(maxQueueSize) {}
+  TaskManagerProfile(unsigned long long int computeTime, unsigned long long int waitTime, size_t maxQueueSize, unsigned long long int memoryWaitTime, size_t deadlineMisses = 0)
+      : computeTime(computeTime), waitTime(waitTime), memoryWaitTime(memoryWaitTime), maxQueueSize(maxQueueSize), deadlineMisses(deadlineMisses) {}
 
   /**
    * Generates the dot contents for the task manager profile. The flags control which
@@ -67,6 +71,9 @@ class TaskManagerProfile {
 
     if ((flags & DOTGEN_FLAG_HIDE_MEMORY_WAIT_TIME) == 0 && memoryWaitTime > 0)
       ret += "memoryWaitTime: " + std::to_string((double)memoryWaitTime/1000000.0) + " sec\\n";
+
+    if ((flags & DOTGEN_FLAG_HIDE_DEADLINE_MISSES) == 0 && deadlineMisses > 0)
+      ret += "deadlineMisses: " + std::to_string(deadlineMisses) + "\\n";
 #endif
     return ret;
   }
@@ -79,7 +86,10 @@ class TaskManagerProfile {
    */
   friend std::ostream &operator<<(std::ostream &os, const TaskManagerProfile &profile) {
     os << "computeTime: " << profile.computeTime << " waitTime: " << profile.waitTime << " maxQueueSize: "
-       << profile.maxQueueSize << (profile.memoryWaitTime == 0 ? "" : " memoryWaitTime: " + profile.memoryWaitTime);
+       << profile.maxQueueSize << (profile.memoryWaitTime == 0 ? "" : " memoryWaitTime: " + profile.memoryWaitTime)
+       << (profile.deadlineMisses == 0 ? "" : " deadlineMisses: " + std::to_string(profile.deadlineMisses));
+    for (const auto &ruleProfile : profile.ruleProfiles)
+      os << std::endl << "  Rule " << ruleProfile.first << ": " << ruleProfile.second;
     return os;
   }
 
@@ -134,15 +144,50 @@ class TaskManagerProfile {
     return memoryWaitTime;
   }
 
+  /**
+   * Gets the number of deadline misses
+   * @return the number of data that expired prior to being processed
+   */
+  size_t getDeadlineMisses() const {
+    return deadlineMisses;
+  }
+
+  /**
+   * Adds the profile of a rule manager that is executed by the task manager (see Bookkeeper)
+   * @param name the name of the rule
+   * @param ruleProfile the rule manager profile
+   */
+  void addRuleProfile(const std::string &name, const RuleManagerProfile &ruleProfile) {
+    this->ruleProfiles.push_back(std::make_pair(name, ruleProfile));
+  }
+
+  /**
+   * Gets the profiles of the rule managers that are executed by the task manager
+   * @return the rule names and their rule manager profiles
+   */
+  const std::vector<std::pair<std::string, RuleManagerProfile>> &getRuleProfiles() const {
+    return ruleProfiles;
+  }
+
   /**
    * Computes the sum for the compute time and wait time between this profile and some other profile.
    * This is used when computing the average compute/wait time among multiple task managers.
+   * Deadline misses and rule profiles are summed and are not averaged.
    * @param other the other task manager
    */
   void sum(TaskManagerProfile *other) {
     this->computeTime += other->getComputeTime();
     this->waitTime += other->getWaitTime();
     this->memoryWaitTime += other->getMemoryWaitTime();
+    this->deadlineMisses += other->getDeadlineMisses();
+
+    auto &otherRuleProfiles = other->getRuleProfiles();
+    for (size_t i = 0; i < otherRuleProfiles.size(); i++) {
+      if (i < this->ruleProfiles.size())
+        this->ruleProfiles[i].second.sum(otherRuleProfiles[i].second);
+      else
+        this->ruleProfiles.push_back(otherRuleProfiles[i]);
+    }
   }
 
   /**
@@ -166,6 +211,8 @@ class TaskManagerProfile {
   unsigned long long int waitTime; //!< The wait time for the task manager
   unsigned long long int memoryWaitTime; //!< The time spent waiting for memory from the memory manager
   size_t maxQueueSize; //!< The maximum queue size for the task manager
+  size_t deadlineMisses; //!< The number of data that expired prior to being processed
+  std::vector<std::pair<std::string, RuleManagerProfile>> ruleProfiles; //!< The profiles of the rules executed by the task manager
 
 };
 }
@@ -14,6 +14,8 @@
 #define HTGS_MEMORYMANAGER_H
 
 #include <htgs/core/memory/MemoryPool.hpp>
+#include <htgs/core/memory/SharedMemoryPool.hpp>
+#include <htgs/core/memory/MemoryOwnershipTracker.hpp>
 
 #include <htgs/api/ITask.hpp>
 #include <htgs/api/IMemoryAllocator.hpp>
@@ -41,6 +43,19 @@ namespace htgs {
  * Dynamic memory managers do not allocate memory. Memory allocation is moved to the ITask. Memory returned from an
  * ITask will be freed when the IMemoryRelease rule indicates the memory is ready to be released.
  *
+ * A MemoryManager can also be created with a SharedMemoryPool, which is shared among all copies of the
+ * MemoryManager within an ExecutionPipeline. In this case the memoryPoolSize is the number of elements reserved
+ * for each pipeline, and the MemoryManager polls its input to borrow additional memory from the SharedMemoryPool
+ * whenever all of its reserved memory is in use. Borrowed memory is returned to the SharedMemoryPool as soon
+ * as it is released, so that idle memory can be lent to whichever pipeline needs it.
+ *
+ * Borrowing is driven by polling, not by the release path: a MemoryManager only checks the SharedMemoryPool when it
+ * wakes up, either from released memory or once every lendTimeout microseconds, and only if its output has no memory
+ * left. Each check borrows at most one element. A pipeline that runs out of reserved memory therefore waits up to
+ * lendTimeout microseconds for each element it borrows, and memory returned by another pipeline is not lent out until
+ * the next check. Keep the lendTimeout small if pipelines are expected to rely on the shared pool; each MemoryManager
+ * thread wakes up once per lendTimeout while idle.
+ *
  * @tparam T the input/output MemoryData type for the MemoryManager; i.e., double *
  */
 template<class T>
@@ -66,6 +81,38 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
     this->pool = nullptr;
     this->name = name;
     this->type = type;
+    this->sharedPool = nullptr;
+    this->numBorrowed = 0;
+    this->ownershipTracker = nullptr;
+  }
+
+  /**
+   * Creates the MemoryManager with a memory pool reserved for each pipeline, and a memory pool
+   * that is shared among all pipelines.
+   * Specifies 1 thread that polls its input to lend memory from the shared pool.
+   * @param name the name of the memory manager edge
+   * @param memoryPoolSize the size of the memory pool reserved for each pipeline.
+   * @param sharedPool the memory pool that is shared among all pipelines
+   * @param memoryAllocator the allocator for how the memory pool allocates the memory.
+   * @param type the type of memory manager to create
+   * @param lendTimeout the timeout time in microseconds between checks for lending memory from the shared pool
+   */
+  MemoryManager(std::string name,
+                size_t memoryPoolSize,
+                std::shared_ptr<SharedMemoryPool<T>> sharedPool,
+                std::shared_ptr<IMemoryAllocator<T>> memoryAllocator,
+                MMType type,
+                size_t lendTimeout) : ITask<
+      MemoryData<T>,
+      MemoryData<T>>(1, true, true, lendTimeout) {
+    this->allocator = memoryAllocator;
+    this->memoryPoolSize = memoryPoolSize;
+    this->pool = nullptr;
+    this->name = name;
+    this->type = type;
+    this->sharedPool = sharedPool;
+    this->numBorrowed = 0;
+    this->ownershipTracker = nullptr;
   }
 
   /**
@@ -91,11 +138,23 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
 
     MemoryData<T> *memory = new MemoryData<T>(this->getAllocator(), inputConnector, this->getName(), this->type);
 
+    if (MemoryOwnershipTracker::isEnabled()) {
+      this->ownershipTracker = MemoryOwnershipTracker::create(this->name, this->getPipelineId(),
+                                                              this->getMemoryPoolSize());
+      memory->setOwnershipTracker(this->ownershipTracker);
+    }
+
     bool allocate = false;
     if (type == MMType::Static)
       allocate = true;
 
     this->pool->fillPool(memory, this->getPipelineId(), allocate);
+
+    if (this->sharedPool != nullptr) {
+      this->sharedPool->fillPool(memory, allocate);
+      this->releaseConnector = inputConnector;
+    }
+
     delete memory;
   }
 
@@ -115,18 +174,37 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
    * all data to its output edge. If the data is not nullptr, then the MemoryData::memoryUsed()
    * is called to update the state of the memory and checks if the memory can be recycled back into
    * the memory pool with MemoryData::canReleaseMemory().
+   *
+   * If the MemoryManager is shared among pipelines, then released memory is first returned to the
+   * SharedMemoryPool if this MemoryManager has any memory borrowed. Memory is then borrowed from the
+   * SharedMemoryPool while the output of the MemoryManager holds less memory than the largest batch that a task is
+   * waiting for (see ITask::getMemoryBatch), or is empty.
    * @param data the MemoryData being processed
    */
   void executeTask(std::shared_ptr<MemoryData<T>> data) override {
     if (data != nullptr) {
       if (data->getPipelineId() == this->getPipelineId()) {
         data->memoryUsed();
+        bool canRelease = data->canReleaseMemory();
+
+        std::shared_ptr<MemoryOwnershipTracker> tracker = data->getOwnershipTracker();
+        if (tracker != nullptr) {
+          if (canRelease)
+            tracker->recycled(data.get());
+          else
+            tracker->released(data.get(), data->getMemoryReleaseRule()->getState());
+        }
 
-        if (data->canReleaseMemory()) {
-          if (type == MMType::Static)
-            this->pool->addMemory(data);
-          else if (type == MMType::Dynamic) {
+        if (canRelease) {
+          if (type == MMType::Dynamic)
             data->memFree();
+          else
+            data->memReset();
+
+          if (this->numBorrowed > 0) {
+            this->sharedPool->returnMemory(data);
+            this->numBorrowed--;
+          } else {
             this->pool->addMemory(data);
           }
         }
@@ -139,13 +217,38 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
     while (!this->pool->isPoolEmpty()) {
       this->addResult(this->pool->getMemory());
     }
+
+    if (this->sharedPool != nullptr) {
+      auto outputConnector = std::static_pointer_cast<Connector<MemoryData<T>>>(
+          this->getOwnerTaskManager()->getOutputConnector());
+
+      // Borrow until the queued memory covers the largest batch a task is waiting for, a task waiting for a batch
+      // does not consume the queued memory, so borrowing only when the queue is empty would never satisfy it
+      size_t demand = std::max<size_t>(outputConnector->getBatchDemand(), 1);
+      while (outputConnector->getQueueSize() < demand) {
+        m_data_t<T> memory = this->sharedPool->borrowMemory(this->releaseConnector);
+        if (memory == nullptr)
+          break;
+
+        memory->setPipelineId(this->getPipelineId());
+        memory->setMemoryManagerConnector(this->releaseConnector);
+        memory->setOwnershipTracker(this->ownershipTracker);
+        this->numBorrowed++;
+        this->addResult(memory);
+      }
+    }
   }
 
   /**
    * Provides debug output for MemoryManager
    */
   void debug() override {
-    HTGS_DEBUG(this->getName() << " max pool size: " << this->memoryPoolSize << " isEmpty? " << this->pool->isPoolEmpty());
+    HTGS_DEBUG(this->getName() << " max pool size: " << this->memoryPoolSize << " isEmpty? " << this->pool->isPoolEmpty()
+                                << " borrowed: " << this->numBorrowed);
+#ifdef HTGS_DEBUG_FLAG
+    if (this->ownershipTracker != nullptr)
+      this->ownershipTracker->writeReport(std::cerr);
+#endif
   }
 
   /**
@@ -160,15 +263,20 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
       case MMType::Dynamic:typeStr = "dynamic";
         break;
     }
+    if (this->sharedPool != nullptr)
+      typeStr += ", shared";
     return std::string("MM(" + typeStr + "): " + this->name);
   }
 
   /**
    * Creates a shallow copy of the MemoryManager.
-   * Does not copy the contents of the MemoryPool.
+   * Does not copy the contents of the MemoryPool. The SharedMemoryPool is shared with the copy.
    * @return the shallow copy of the MemoryManager
    */
   virtual MemoryManager<T> *copy() override {
+    if (this->sharedPool != nullptr)
+      return new MemoryManager<T>(this->name, this->memoryPoolSize, this->sharedPool, this->allocator, this->type,
+                                  this->getMicroTimeoutTime());
     return new MemoryManager<T>(this->name, this->memoryPoolSize, this->allocator, this->type);
   }
 
@@ -181,6 +289,48 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
     return this->memoryPoolSize;
   }
 
+  /**
+   * Sets the size of the MemoryPool
+   * @param memoryPoolSize the size of the memory pool
+   * @note Must be called prior to executing the task graph
+   */
+  void setMemoryPoolSize(size_t memoryPoolSize) {
+    this->memoryPoolSize = memoryPoolSize;
+  }
+
+  /**
+   * Gets the maximum number of elements of memory that can be acquired from the memory edge at once, which includes
+   * the memory that can be borrowed from the shared memory pool.
+   * @return the number of elements of memory
+   */
+  size_t getMemoryCapacity() {
+    return this->getMemoryPoolSize() + (this->sharedPool != nullptr ? this->sharedPool->getPoolSize() : 0);
+  }
+
+  /**
+   * Gets the size of the memory pool, which is saved in a TuningProfile
+   * @return the tuning parameters
+   */
+  std::map<std::string, size_t> getTuningParameters() override {
+    return {{"poolSize", this->memoryPoolSize}};
+  }
+
+  /**
+   * Sets the size of the memory pool from a TuningProfile
+   * @param name the name of the parameter
+   * @param value the size of the memory pool
+   */
+  void setTuningParameter(std::string name, size_t value) override {
+    if (name == "poolSize" && value > 0) {
+      setMemoryPoolSize(value);
+
+      // The memory edge is already connected when the graph is tuned, so its capacity is updated to the new pool size
+      auto outputConnector = this->getOwnerTaskManager()->getOutputConnector();
+      if (outputConnector != nullptr)
+        std::static_pointer_cast<Connector<MemoryData<T>>>(outputConnector)->setCapacity(this->getMemoryCapacity());
+    }
+  }
+
   /**
    * Gets the allocator that is responsible for allocating and freeing memory for the MemoryPool.
    * @return the allocator
@@ -214,6 +364,25 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
 #endif
   }
 
+  /**
+   * Gets the pool of memory that is shared among pipelines.
+   * @return the shared memory pool, or nullptr if the memory manager is not shared
+   */
+  std::shared_ptr<SharedMemoryPool<T>> getSharedPool() const { return sharedPool; }
+
+  /**
+   * Gets the number of elements of memory currently borrowed from the shared memory pool.
+   * @return the number of elements borrowed
+   */
+  size_t getNumBorrowed() const { return numBorrowed; }
+
+  /**
+   * Gets the tracker that records who holds the memory of this memory manager.
+   * @return the tracker, or nullptr if ownership tracking was not enabled when the memory manager initialized (see
+   * MemoryOwnershipTracker::setEnabled)
+   */
+  std::shared_ptr<MemoryOwnershipTracker> getOwnershipTracker() const { return ownershipTracker; }
+
   /**
    * Gets the memory manager type.
    * @return the memory manager type.
@@ -249,6 +418,12 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
 
   }
 
+  /**
+   * Memory managers continue to execute during checkpoints, so that tasks waiting for memory can finish.
+   * @return false
+   */
+  bool canPauseForCheckpoint() override { return false; }
+
   std::string getDotFillColor() override {
     return "sienna";
   }
@@ -259,6 +434,10 @@ class MemoryManager : public ITask<MemoryData<T>, MemoryData<T>> {
   MemoryPool<T> *pool; //!< The memory pool
   std::string name; //!< The name of the memory manager
   MMType type; //!< The memory manager type
+  std::shared_ptr<SharedMemoryPool<T>> sharedPool; //!< The memory pool shared among pipelines (nullptr if not shared)
+  std::weak_ptr<Connector<MemoryData<T>>> releaseConnector; //!< The connector that borrowed memory is released to
+  size_t numBorrowed; //!< The number of elements currently borrowed from the shared memory pool
+  std::shared_ptr<MemoryOwnershipTracker> ownershipTracker; //!< The tracker that records who holds the memory (nullptr if not tracked)
 
 };
 }
@@ -0,0 +1,378 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file MemoryOwnershipTracker.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Tracks which tasks hold the memory of a memory edge, used to diagnose memory pool starvation
+ */
+#ifndef HTGS_MEMORYOWNERSHIPTRACKER_HPP
+#define HTGS_MEMORYOWNERSHIPTRACKER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace htgs {
+
+/**
+ * @struct MemoryOwnership MemoryOwnershipTracker.hpp <htgs/core/memory/MemoryOwnershipTracker.hpp>
+ * @brief Describes who acquired an element of memory from a memory edge that has not yet been recycled.
+ */
+struct MemoryOwnership {
+  const void *memory; //!< The MemoryData that is held
+  std::string taskName; //!< The name of the task that acquired the memory
+  size_t pipelineId; //!< The pipeline id of the task that acquired the memory
+  size_t threadId; //!< The thread id of the task that acquired the memory (see AnyTaskManager::getThreadId)
+  std::thread::id thread; //!< The thread that acquired the memory
+  std::chrono::steady_clock::time_point acquireTime; //!< The time the memory was acquired
+  size_t numReleases; //!< The number of times the memory was released without being recycled by its release rule
+  std::string releaseRuleState; //!< The state of the release rule when the memory was last acquired or released (see IMemoryReleaseRule::getState)
+
+  /**
+   * Gets how long the memory has been held
+   * @return the time since the memory was acquired
+   */
+  std::chrono::milliseconds getHoldTime() const {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - acquireTime);
+  }
+};
+
+/**
+ * @class MemoryOwnershipTracker MemoryOwnershipTracker.hpp <htgs/core/memory/MemoryOwnershipTracker.hpp>
+ * @brief Records which task, thread, and pipeline holds each element of memory of a memory edge.
+ *
+ * @details
+ * When ownership tracking is enabled with setEnabled, each MemoryManager creates a tracker when it initializes. The
+ * tracker is updated when a task acquires memory (ITask::getMemory), when the memory is released back to the
+ * MemoryManager, and when the release rule allows the memory to be recycled. The memory that is currently held can be
+ * queried with getOutstanding while the graph is executing, for example when getMemory has been waiting for a long
+ * time.
+ *
+ * Every tracker in the process is registered, so writeAllReports gives a report of all memory edges. The report is
+ * written by the TaskGraphSignalHandler with dumpAllReports when a signal is caught, so a stalled graph can be
+ * diagnosed by signalling it.
+ *
+ * Example usage:
+ * @code
+ * htgs::MemoryOwnershipTracker::setEnabled(true);
+ * ...
+ * runtime->executeRuntime();
+ * ...
+ * // From a watchdog thread once the graph appears to be stalled
+ * htgs::MemoryOwnershipTracker::writeAllReports(std::cerr);
+ * @endcode
+ *
+ * @note Must be enabled prior to executing the graph, the memory edges of graphs that are already executing are not
+ * tracked.
+ */
+class MemoryOwnershipTracker {
+ public:
+  /**
+   * Creates a tracker for a memory edge
+   * @param memoryEdgeName the name of the memory edge
+   * @param pipelineId the pipeline id of the MemoryManager
+   * @param poolSize the number of elements of memory in the pool of the MemoryManager
+   */
+  MemoryOwnershipTracker(std::string memoryEdgeName, size_t pipelineId, size_t poolSize) :
+      memoryEdgeName(memoryEdgeName), pipelineId(pipelineId), poolSize(poolSize), numAcquired(0) {}
+
+  /**
+   * Enables or disables ownership tracking for MemoryManagers that initialize afterwards
+   * @param enabled whether ownership tracking is enabled
+   */
+  static void setEnabled(bool enabled) { getEnabled() = enabled; }
+
+  /**
+   * Gets whether ownership tracking is enabled
+   * @return whether ownership tracking is enabled
+   */
+  static bool isEnabled() { return getEnabled(); }
+
+  /**
+   * Creates a tracker for a memory edge and registers it, so that it is part of writeAllReports
+   * @param memoryEdgeName the name of the memory edge
+   * @param pipelineId the pipeline id of the MemoryManager
+   * @param poolSize the number of elements of memory in the pool of the MemoryManager
+   * @return the tracker
+   */
+  static std::shared_ptr<MemoryOwnershipTracker> create(std::string memoryEdgeName, size_t pipelineId,
+                                                        size_t poolSize) {
+    std::shared_ptr<MemoryOwnershipTracker>
+        tracker = std::make_shared<MemoryOwnershipTracker>(memoryEdgeName, pipelineId, poolSize);
+
+    std::unique_lock<std::mutex> lock(getRegistryMutex());
+    std::list<std::weak_ptr<MemoryOwnershipTracker>> &registry = getRegistry();
+    registry.remove_if([](const std::weak_ptr<MemoryOwnershipTracker> &t) { return t.expired(); });
+    registry.push_back(tracker);
+    return tracker;
+  }
+
+  /**
+   * Gets the trackers of all memory edges that are still in use
+   * @return the trackers
+   */
+  static std::vector<std::shared_ptr<MemoryOwnershipTracker>> getTrackers() {
+    std::vector<std::shared_ptr<MemoryOwnershipTracker>> trackers;
+    std::unique_lock<std::mutex> lock(getRegistryMutex());
+    for (auto &tracker : getRegistry())
+      if (auto t = tracker.lock())
+        trackers.push_back(t);
+    return trackers;
+  }
+
+  /**
+   * Writes the report of every memory edge to a stream
+   * @param os the output stream
+   */
+  static void writeAllReports(std::ostream &os) {
+    for (auto &tracker : getTrackers())
+      tracker->writeReport(os);
+  }
+
+  /**
+   * Writes the report of every memory edge to a file
+   * @param fileName the name of the file
+   * @return whether the file was written
+   */
+  static bool writeAllReportsToFile(const std::string &fileName) {
+    std::ofstream file(fileName);
+    if (!file.good())
+      return false;
+
+    writeAllReports(file);
+    return file.good();
+  }
+
+  /**
+   * Writes the report of every memory edge to a stream, without waiting for locks, so that it can be called from a
+   * signal handler. The reports whose lock is held, possibly by the thread that was interrupted, are skipped.
+   * @param os the output stream
+   */
+  static void dumpAllReports(std::ostream &os) {
+    std::unique_lock<std::mutex> lock(getRegistryMutex(), std::try_to_lock);
+    if (!lock.owns_lock()) {
+      os << "Memory ownership reports skipped, the tracker registry is locked" << std::endl;
+      return;
+    }
+
+    for (auto &tracker : getRegistry())
+      if (auto t = tracker.lock())
+        t->dumpReport(os);
+  }
+
+  /**
+   * Writes the report of every memory edge to a file, without waiting for locks (see dumpAllReports)
+   * @param fileName the name of the file
+   * @return whether the file was written
+   */
+  static bool dumpAllReportsToFile(const std::string &fileName) {
+    std::ofstream file(fileName);
+    if (!file.good())
+      return false;
+
+    dumpAllReports(file);
+    return file.good();
+  }
+
+  /**
+   * Records that a task acquired memory
+   * @param memory the MemoryData
+   * @param taskName the name of the task
+   * @param pipelineId the pipeline id of the task
+   * @param threadId the thread id of the task
+   * @param releaseRuleState the state of the release rule that was attached to the memory
+   */
+  void acquired(const void *memory, std::string taskName, size_t pipelineId, size_t threadId,
+                std::string releaseRuleState) {
+    MemoryOwnership ownership;
+    ownership.memory = memory;
+    ownership.taskName = taskName;
+    ownership.pipelineId = pipelineId;
+    ownership.threadId = threadId;
+    ownership.thread = std::this_thread::get_id();
+    ownership.acquireTime = std::chrono::steady_clock::now();
+    ownership.numReleases = 0;
+    ownership.releaseRuleState = releaseRuleState;
+
+    std::unique_lock<std::mutex> lock(mutex);
+    outstanding[memory] = ownership;
+    numAcquired++;
+  }
+
+  /**
+   * Records that memory was released to the MemoryManager, but its release rule is not yet satisfied
+   * @param memory the MemoryData
+   * @param releaseRuleState the state of the release rule after the release
+   */
+  void released(const void *memory, std::string releaseRuleState) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = outstanding.find(memory);
+    if (it != outstanding.end()) {
+      it->second.numReleases++;
+      it->second.releaseRuleState = releaseRuleState;
+    }
+  }
+
+  /**
+   * Records that memory was recycled by the MemoryManager, so it is no longer held
+   * @param memory the MemoryData
+   */
+  void recycled(const void *memory) {
+    std::unique_lock<std::mutex> lock(mutex);
+    outstanding.erase(memory);
+  }
+
+  /**
+   * Gets the memory that is currently held, longest held first
+   * @return the ownership of each element of memory that is held
+   */
+  std::vector<MemoryOwnership> getOutstanding() {
+    std::vector<MemoryOwnership> ownerships;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      for (auto &ownership : outstanding)
+        ownerships.push_back(ownership.second);
+    }
+
+    std::sort(ownerships.begin(), ownerships.end(), [](const MemoryOwnership &a, const MemoryOwnership &b) {
+      return a.acquireTime < b.acquireTime;
+    });
+    return ownerships;
+  }
+
+  /**
+   * Gets the number of elements of memory held by each task
+   * @return the number of elements held, keyed by task name and pipeline id
+   */
+  std::map<std::string, size_t> getNumHeldByTask() {
+    std::map<std::string, size_t> numHeld;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto &ownership : outstanding)
+      numHeld[ownership.second.taskName + " (pipeline " + std::to_string(ownership.second.pipelineId) + ")"]++;
+    return numHeld;
+  }
+
+  /**
+   * Gets the total number of times memory has been acquired from the memory edge
+   * @return the number of acquisitions
+   */
+  size_t getNumAcquired() {
+    std::unique_lock<std::mutex> lock(mutex);
+    return numAcquired;
+  }
+
+  /**
+   * Writes the memory that is currently held to a stream, grouped by task and then longest held first
+   * @param os the output stream
+   */
+  void writeReport(std::ostream &os) {
+    std::unique_lock<std::mutex> lock(mutex);
+    writeReport(os, lock);
+  }
+
+  /**
+   * Writes the memory that is currently held to a stream if the tracker is not locked, otherwise notes that the report
+   * was skipped (see dumpAllReports)
+   * @param os the output stream
+   */
+  void dumpReport(std::ostream &os) {
+    std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+      os << "Memory edge '" << memoryEdgeName << "' (pipeline " << pipelineId << "): report skipped, the tracker is "
+         << "locked" << std::endl;
+      return;
+    }
+
+    writeReport(os, lock);
+  }
+
+  /**
+   * Gets the name of the memory edge
+   * @return the name of the memory edge
+   */
+  const std::string &getMemoryEdgeName() const { return memoryEdgeName; }
+
+  /**
+   * Gets the pipeline id of the MemoryManager
+   * @return the pipeline id
+   */
+  size_t getPipelineId() const { return pipelineId; }
+
+  /**
+   * Gets the number of elements of memory in the pool of the MemoryManager
+   * @return the pool size
+   */
+  size_t getPoolSize() const { return poolSize; }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static std::atomic_bool &getEnabled() {
+    static std::atomic_bool enabled(false);
+    return enabled;
+  }
+
+  static std::mutex &getRegistryMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static std::list<std::weak_ptr<MemoryOwnershipTracker>> &getRegistry() {
+    static std::list<std::weak_ptr<MemoryOwnershipTracker>> registry;
+    return registry;
+  }
+
+  void writeReport(std::ostream &os, std::unique_lock<std::mutex> &lock) {
+    std::vector<MemoryOwnership> ownerships;
+    for (auto &ownership : outstanding)
+      ownerships.push_back(ownership.second);
+    lock.unlock();
+
+    std::sort(ownerships.begin(), ownerships.end(), [](const MemoryOwnership &a, const MemoryOwnership &b) {
+      return a.acquireTime < b.acquireTime;
+    });
+
+    std::map<std::string, size_t> numHeld;
+    for (auto &ownership : ownerships)
+      numHeld[ownership.taskName + " (pipeline " + std::to_string(ownership.pipelineId) + ")"]++;
+
+    os << "Memory edge '" << memoryEdgeName << "' (pipeline " << pipelineId << "): " << ownerships.size()
+       << " of " << poolSize << " held" << std::endl;
+
+    for (auto &task : numHeld)
+      os << "  " << task.first << " holds " << task.second << std::endl;
+
+    for (auto &ownership : ownerships) {
+      os << "  " << ownership.memory << " held by " << ownership.taskName << " (pipeline " << ownership.pipelineId
+         << ", thread " << ownership.threadId << ") for " << ownership.getHoldTime().count() << " ms, released "
+         << ownership.numReleases << " times";
+      if (!ownership.releaseRuleState.empty())
+        os << ", release rule: " << ownership.releaseRuleState;
+      os << std::endl;
+    }
+  }
+  //! @endcond
+
+  std::string memoryEdgeName; //!< The name of the memory edge
+  size_t pipelineId; //!< The pipeline id of the MemoryManager
+  size_t poolSize; //!< The number of elements of memory in the pool
+  std::map<const void *, MemoryOwnership> outstanding; //!< The ownership of the memory that is currently held
+  size_t numAcquired; //!< The total number of acquisitions
+  std::mutex mutex; //!< Protects the ownership records
+};
+}
+
+#endif //HTGS_MEMORYOWNERSHIPTRACKER_HPP
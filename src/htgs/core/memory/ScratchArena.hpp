@@ -0,0 +1,136 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ScratchArena.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the per-thread arena that hands out transient memory to a task while it processes one data
+ */
+#ifndef HTGS_SCRATCHARENA_HPP
+#define HTGS_SCRATCHARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace htgs {
+/**
+ * @class ScratchArena ScratchArena.hpp <htgs/core/memory/ScratchArena.hpp>
+ * @brief Bump allocator for memory that is only used while a task processes one data.
+ *
+ * @details
+ * Memory is handed out from large blocks by advancing an offset, and is never freed individually. Once the task has
+ * processed the data, the TaskManager resets the arena, which makes all of its memory available again. If more than
+ * one block was needed, the blocks are replaced by a single block that is large enough for all of them, so a task
+ * that needs the same amount of memory for each data does not allocate once the arena has grown.
+ *
+ * Each TaskManager owns its own arena, so the arena is only used by one thread and does not lock.
+ */
+class ScratchArena {
+ public:
+  /**
+   * Creates an arena that has not allocated any memory
+   */
+  ScratchArena() {
+    this->offset = 0;
+    this->capacity = 0;
+    this->numBlockAllocations = 0;
+  }
+
+  /**
+   * Destructor, frees all blocks
+   */
+  ~ScratchArena() {
+    for (char *block : this->blocks)
+      delete[] block;
+  }
+
+  /**
+   * Allocates memory that remains valid until the arena is reset
+   * @param numBytes the number of bytes
+   * @param alignment the alignment of the memory, must be a power of two
+   * @return the memory
+   */
+  void *allocate(size_t numBytes, size_t alignment) {
+    if (!this->blocks.empty()) {
+      void *memory = this->bump(numBytes, alignment);
+      if (memory != nullptr)
+        return memory;
+    }
+
+    size_t blockSize = this->blockSizes.empty() ? MinBlockSize : this->blockSizes.back() * 2;
+    if (blockSize < numBytes + alignment)
+      blockSize = numBytes + alignment;
+
+    this->addBlock(blockSize);
+    return this->bump(numBytes, alignment);
+  }
+
+  /**
+   * Makes all memory of the arena available again, memory that was allocated prior to the reset must no longer be used
+   */
+  void reset() {
+    if (this->blocks.size() > 1) {
+      for (char *block : this->blocks)
+        delete[] block;
+      this->blocks.clear();
+      this->blockSizes.clear();
+
+      size_t total = this->capacity;
+      this->capacity = 0;
+      this->addBlock(total);
+    }
+    this->offset = 0;
+  }
+
+  /**
+   * Gets the number of bytes held by the arena
+   * @return the number of bytes
+   */
+  size_t getCapacity() const { return this->capacity; }
+
+  /**
+   * Gets the number of blocks the arena has allocated since it was created
+   * @return the number of block allocations
+   */
+  size_t getNumBlockAllocations() const { return this->numBlockAllocations; }
+
+ private:
+  //! @cond Doxygen_Suppress
+  static const size_t MinBlockSize = 4096;
+
+  void *bump(size_t numBytes, size_t alignment) {
+    char *block = this->blocks.back();
+    uintptr_t start = reinterpret_cast<uintptr_t>(block) + this->offset;
+    uintptr_t aligned = (start + alignment - 1) & ~(uintptr_t) (alignment - 1);
+    size_t newOffset = (size_t) (aligned - reinterpret_cast<uintptr_t>(block)) + numBytes;
+
+    if (newOffset > this->blockSizes.back())
+      return nullptr;
+
+    this->offset = newOffset;
+    return reinterpret_cast<void *>(aligned);
+  }
+
+  void addBlock(size_t blockSize) {
+    this->blocks.push_back(new char[blockSize]);
+    this->blockSizes.push_back(blockSize);
+    this->capacity += blockSize;
+    this->offset = 0;
+    this->numBlockAllocations++;
+  }
+  //! @endcond
+
+  std::vector<char *> blocks; //!< The blocks of memory, memory is handed out from the last block
+  std::vector<size_t> blockSizes; //!< The size of each block in bytes
+  size_t offset; //!< The number of bytes used in the last block
+  size_t capacity; //!< The total number of bytes of all blocks
+  size_t numBlockAllocations; //!< The number of blocks allocated since the arena was created
+};
+}
+
+#endif //HTGS_SCRATCHARENA_HPP
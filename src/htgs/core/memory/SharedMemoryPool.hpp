@@ -0,0 +1,154 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file SharedMemoryPool.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the SharedMemoryPool class, which is shared among MemoryManagers across ExecutionPipelines.
+ */
+#ifndef HTGS_SHAREDMEMORYPOOL_HPP
+#define HTGS_SHAREDMEMORYPOOL_HPP
+
+#include <mutex>
+#include <set>
+#include <htgs/core/memory/MemoryPool.hpp>
+
+namespace htgs {
+
+/**
+ * @class SharedMemoryPool SharedMemoryPool.hpp <htgs/core/memory/SharedMemoryPool.hpp>
+ * @brief Holds a pool of MemoryData that is lent out to the MemoryManagers of multiple pipelines.
+ * @details
+ * Each MemoryManager that is copied by an ExecutionPipeline receives its own MemoryPool, which represents
+ * the memory reserved for that pipeline. When a memory edge is shared, the copies of the
+ * MemoryManager also hold a reference to the same SharedMemoryPool. A MemoryManager whose reserved
+ * memory is in use borrows from the SharedMemoryPool, and returns the borrowed memory once
+ * the memory has been released by its IMemoryReleaseRule.
+ *
+ * The memory is allocated by the first MemoryManager to initialize, and freed once the last MemoryManager
+ * referencing the pool is destroyed.
+ *
+ * @tparam T the type of memory held by the pool
+ * @note This class should only be called by the HTGS API
+ */
+template<class T>
+class SharedMemoryPool {
+ public:
+  /**
+   * Creates a shared memory pool with the specified number of elements
+   * @param poolSize the number of elements that can be lent across all pipelines
+   */
+  SharedMemoryPool(size_t poolSize) {
+    this->pool = new MemoryPool<T>(poolSize);
+    this->poolSize = poolSize;
+    this->filled = false;
+    this->numLent = 0;
+    this->maxLent = 0;
+  }
+
+  /**
+   * Destructor, frees all memory that was allocated for the pool.
+   */
+  ~SharedMemoryPool() {
+    pool->releaseAllMemory();
+    delete pool;
+    pool = nullptr;
+  }
+
+  /**
+   * Fills the pool with memory. Only the first call fills the pool, all other calls are ignored.
+   * @param memory the memory that is copied into the pool
+   * @param allocate whether to allocate the memory before adding
+   */
+  void fillPool(MemoryData<T> *memory, bool allocate) {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    if (filled)
+      return;
+
+    pool->fillPool(memory, 0, allocate);
+    filled = true;
+  }
+
+  /**
+   * Borrows memory from the pool.
+   * @param borrower the connector of the MemoryManager that is borrowing, which is woken up once memory is returned
+   * to the pool if there is no memory to lend
+   * @return the memory, or nullptr if all of the memory in the pool is currently lent out
+   */
+  m_data_t<T> borrowMemory(const std::weak_ptr<Connector<MemoryData<T>>> &borrower) {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    if (pool->isPoolEmpty()) {
+      waitingBorrowers.insert(borrower);
+      return nullptr;
+    }
+
+    numLent++;
+    if (numLent > maxLent)
+      maxLent = numLent;
+
+    return pool->getMemory();
+  }
+
+  /**
+   * Returns borrowed memory back into the pool. The MemoryManagers that could not borrow memory are woken up to
+   * borrow it, rather than waiting for their lend timeout.
+   * @param memory the memory that is returned
+   */
+  void returnMemory(m_data_t<T> memory) {
+    std::set<std::weak_ptr<Connector<MemoryData<T>>>, std::owner_less<std::weak_ptr<Connector<MemoryData<T>>>>>
+        borrowers;
+    {
+      std::unique_lock<std::mutex> lock(poolMutex);
+      numLent--;
+      pool->addMemory(memory);
+      borrowers.swap(waitingBorrowers);
+    }
+
+    for (auto &borrower : borrowers) {
+      auto connector = borrower.lock();
+      if (connector != nullptr)
+        connector->wakeupConsumer();
+    }
+  }
+
+  /**
+   * Gets the number of elements in the pool.
+   * @return the number of elements
+   */
+  size_t getPoolSize() const { return poolSize; }
+
+  /**
+   * Gets the number of elements that are currently lent out
+   * @return the number of elements lent
+   */
+  size_t getNumLent() {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    return numLent;
+  }
+
+  /**
+   * Gets the maximum number of elements that were lent out at the same time
+   * @return the high water mark of elements lent
+   */
+  size_t getMaxLent() {
+    std::unique_lock<std::mutex> lock(poolMutex);
+    return maxLent;
+  }
+
+ private:
+  MemoryPool<T> *pool; //!< The pool of memory that is lent out
+  size_t poolSize; //!< The number of elements in the pool
+  bool filled; //!< Whether the pool has been filled
+  size_t numLent; //!< The number of elements currently lent out
+  size_t maxLent; //!< The maximum number of elements lent out at the same time
+  std::set<std::weak_ptr<Connector<MemoryData<T>>>, std::owner_less<std::weak_ptr<Connector<MemoryData<T>>>>>
+      waitingBorrowers; //!< The connectors of the MemoryManagers that could not borrow memory since it was last returned
+  std::mutex poolMutex; //!< The mutex to protect the pool
+};
+}
+
+#endif //HTGS_SHAREDMEMORYPOOL_HPP
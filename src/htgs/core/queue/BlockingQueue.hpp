@@ -17,7 +17,11 @@
 #include <mutex>
 #include <condition_variable>
 #include <deque>
-#include <queue>
+#include <list>
+#include <set>
+#include <algorithm>
+#include <htgs/api/IData.hpp>
+#include <htgs/types/QueueDiscipline.hpp>
 
 namespace htgs {
 /**
@@ -36,6 +40,9 @@ class BlockingQueue {
    */
   BlockingQueue() {
     this->queueSize = 0;
+    this->discipline = QueueDiscipline::FIFO;
+    this->lifoBound = HTGS_DEFAULT_LIFO_BOUND;
+    this->lifoStreak = 0;
 #ifdef PROFILE_QUEUE
     enqueueLockTime = 0;
     dequeueLockTime = 0;
@@ -54,6 +61,9 @@ class BlockingQueue {
    */
   BlockingQueue(size_t qSize) {
     this->queueSize = qSize;
+    this->discipline = QueueDiscipline::FIFO;
+    this->lifoBound = HTGS_DEFAULT_LIFO_BOUND;
+    this->lifoStreak = 0;
 #ifdef PROFILE_QUEUE
     enqueueLockTime = 0;
     dequeueLockTime = 0;
@@ -84,6 +94,40 @@ class BlockingQueue {
     return queueSize - queue.size();
   }
 
+  /**
+   * Sets the order in which elements are removed from the queue.
+   * @param discipline the queue discipline
+   * @note Should only be set prior to adding elements into the queue
+   */
+  void setDiscipline(QueueDiscipline discipline) {
+    this->discipline = discipline;
+  }
+
+  /**
+   * Gets the order in which elements are removed from the queue.
+   * @return the queue discipline
+   */
+  QueueDiscipline getDiscipline() const {
+    return this->discipline;
+  }
+
+  /**
+   * Sets the number of elements that are removed ahead of the oldest element with QueueDiscipline::BoundedLIFO,
+   * before the oldest element is removed.
+   * @param bound the bound, which must be greater than 0
+   */
+  void setLifoBound(size_t bound) {
+    this->lifoBound = bound == 0 ? 1 : bound;
+  }
+
+  /**
+   * Gets the number of elements that are removed ahead of the oldest element with QueueDiscipline::BoundedLIFO
+   * @return the bound
+   */
+  size_t getLifoBound() const {
+    return this->lifoBound;
+  }
+
   /**
    * Gets whether the queue is empty or not
    * @return whether the queue is empty
@@ -112,9 +156,7 @@ class BlockingQueue {
    * @internal
    */
   T remove() {
-    T res = this->queue.front();
-    this->queue.pop();
-    return res;
+    return popNext();
   }
 
   /**
@@ -143,14 +185,50 @@ class BlockingQueue {
       this->enqueueWaitTime += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 #endif
     }
-    queue.push(value);
+    queue.push_back(value);
+    if (this->discipline == QueueDiscipline::Priority)
+      std::push_heap(this->queue.begin(), this->queue.end(), IData());
+
+#ifdef PROFILE
+    if (queue.size() > queueActiveMaxSize)
+        queueActiveMaxSize = queue.size();
+#endif
+
+    // Consumers waiting for a batch may not be satisfied by a single element, so all consumers are woken up
+    if (!this->batchWaiters.empty())
+      this->condition.notify_all();
+    else
+      this->condition.notify_one();
+  }
+
+  /**
+   * Adds elements into the queue at once, so that the lock is only acquired once for all of the elements
+   * @param values the elements to be added
+   * @note Is thread safe.
+   * @note Will block while the queue is full if the maximum queue size > 0
+   */
+  void EnqueueBatch(const std::list<T> &values) {
+    if (values.empty())
+      return;
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    for (const T &value : values) {
+      if (this->queueSize > 0 && this->queue.size() == queueSize) {
+        this->condition.notify_all();
+        this->condition.wait(lock, [=] { return this->queue.size() != queueSize; });
+      }
+
+      queue.push_back(value);
+      if (this->discipline == QueueDiscipline::Priority)
+        std::push_heap(this->queue.begin(), this->queue.end(), IData());
+    }
 
 #ifdef PROFILE
     if (queue.size() > queueActiveMaxSize)
         queueActiveMaxSize = queue.size();
 #endif
 
-    this->condition.notify_one();
+    this->condition.notify_all();
   }
 
   /**
@@ -174,9 +252,56 @@ class BlockingQueue {
     end = std::chrono::high_resolution_clock::now();
     this->dequeueWaitTime += std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 #endif
-    T res = this->queue.front();
-    this->queue.pop();
-    return res;
+    return popNext();
+  }
+
+  /**
+   * Gets the largest number of elements that a consumer waiting on DequeueBatch requested.
+   * @return the number of elements, 0 if no consumer is waiting on DequeueBatch
+   * @note Is thread safe.
+   */
+  size_t getBatchDemand() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->batchWaiters.empty() ? 0 : *this->batchWaiters.rbegin();
+  }
+
+  /**
+   * Removes count elements from the queue at once.
+   * Waits until count elements are available, so that elements are never partially removed while waiting.
+   * @param count the number of elements to remove
+   * @return the list of elements
+   * @note Is thread safe.
+   * @note Will block until count elements are in the queue.
+   */
+  std::list<T> DequeueBatch(size_t count) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto waiter = this->batchWaiters.insert(count);
+    this->condition.wait(lock, [=] { return this->queue.size() >= count; });
+    this->batchWaiters.erase(waiter);
+    for (size_t i = 0; i < count; i++) {
+      elements.push_back(popNext());
+    }
+    return elements;
+  }
+
+  /**
+   * Removes up to count elements that are available in the queue at once.
+   * @param count the maximum number of elements to remove
+   * @param wait whether to wait until at least one element is in the queue
+   * @return the list of elements, which is empty if the queue is empty and wait is false
+   * @note Is thread safe.
+   */
+  std::list<T> DequeueAvailable(size_t count, bool wait) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (wait)
+      this->condition.wait(lock, [=] { return !this->queue.empty(); });
+
+    while (!this->queue.empty() && elements.size() < count) {
+      elements.push_back(popNext());
+    }
+    return elements;
   }
 
   /**
@@ -190,13 +315,34 @@ class BlockingQueue {
     std::unique_lock<std::mutex> lock(this->mutex);
     if (this->condition.wait_for(lock, std::chrono::microseconds(timeout),
                                  [=] { return !this->queue.empty(); })) {
-      T res = this->queue.front();
-      this->queue.pop();
-      return res;
+      return popNext();
     }
     return nullptr;
   }
 
+  /**
+   * Gets up to count elements at the front of the queue without removing them.
+   * Used to provide lookahead of the next elements that will be dequeued; other consumers
+   * may dequeue the elements at any time after this function returns.
+   * @param count the maximum number of elements to retrieve
+   * @return the list of elements at the front of the queue, in dequeue order
+   * @note Is thread safe.
+   */
+  std::list<T> peek(size_t count) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (this->discipline == QueueDiscipline::LIFO || this->discipline == QueueDiscipline::BoundedLIFO) {
+      for (auto it = this->queue.rbegin(); it != this->queue.rend() && elements.size() < count; ++it) {
+        elements.push_back(*it);
+      }
+    } else {
+      for (auto it = this->queue.begin(); it != this->queue.end() && elements.size() < count; ++it) {
+        elements.push_back(*it);
+      }
+    }
+    return elements;
+  }
+
 
 
 #ifdef PROFILE_QUEUE
@@ -225,6 +371,44 @@ class BlockingQueue {
 #endif
 
  private:
+  //! @cond Doxygen_Suppress
+  T popNext() {
+    bool fromBack;
+    switch (this->discipline) {
+      case QueueDiscipline::Priority:
+        std::pop_heap(this->queue.begin(), this->queue.end(), IData());
+        fromBack = true;
+        break;
+      case QueueDiscipline::LIFO:
+        fromBack = true;
+        break;
+      case QueueDiscipline::BoundedLIFO:
+        // Once enough elements were removed ahead of the oldest element, remove the oldest element
+        if (this->queue.size() > 1 && this->lifoStreak < this->lifoBound) {
+          this->lifoStreak++;
+          fromBack = true;
+        } else {
+          this->lifoStreak = 0;
+          fromBack = false;
+        }
+        break;
+      default:
+        fromBack = false;
+        break;
+    }
+
+    if (!fromBack) {
+      T res = this->queue.front();
+      this->queue.pop_front();
+      return res;
+    }
+
+    T res = this->queue.back();
+    this->queue.pop_back();
+    return res;
+  }
+  //! @endcond
+
 #ifdef PROFILE_QUEUE
     unsigned long long int enqueueLockTime; //!< The time to lock before enqueue
     unsigned long long int dequeueLockTime; //!< The time to lock before dequeue
@@ -236,7 +420,11 @@ class BlockingQueue {
   size_t queueActiveMaxSize; //!< The maximum size the queue reached in its lifetime
 #endif
   size_t queueSize; //!< The maximum size of the queue, set to -1 for infinite size
-  std::queue<T> queue; //!< The FIFO queue
+  std::multiset<size_t> batchWaiters; //!< The number of elements each consumer waiting on DequeueBatch requested
+  QueueDiscipline discipline; //!< The order in which elements are removed from the queue
+  size_t lifoBound; //!< The number of elements removed ahead of the oldest element with QueueDiscipline::BoundedLIFO
+  size_t lifoStreak; //!< The number of elements removed ahead of the oldest element since it was last removed
+  std::deque<T> queue; //!< The queue, which is maintained as a heap for QueueDiscipline::Priority
   std::mutex mutex; //!< The mutex to ensure thread safety
   std::condition_variable condition; //!< The condition variable used for waking up waiting threads
 };
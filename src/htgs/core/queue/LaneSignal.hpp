@@ -0,0 +1,95 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file LaneSignal.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the signal that wakes up consumers of a connector whose data is split across lanes
+ */
+#ifndef HTGS_LANESIGNAL_HPP
+#define HTGS_LANESIGNAL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace htgs {
+/**
+ * @class LaneSignal LaneSignal.hpp <htgs/core/queue/LaneSignal.hpp>
+ * @brief Notifies consumers that data was added to any one of several queues.
+ *
+ * @details
+ * A consumer gets a key with prepareWait(), checks each queue, and if all of them are empty waits with the key. Each
+ * producer calls notify() after adding data, which increments the key. A consumer only sleeps while the key has not
+ * changed, so a notification between checking the queues and waiting is not lost.
+ *
+ * Producers only take the mutex to notify if a consumer is waiting, so producers writing to different queues do not
+ * contend with each other.
+ */
+class LaneSignal {
+ public:
+  /**
+   * Creates a signal with no waiting consumers
+   */
+  LaneSignal() {
+    this->epoch = 0;
+    this->numWaiting = 0;
+  }
+
+  /**
+   * Gets the key to wait on, must be called prior to checking the queues
+   * @return the key
+   */
+  size_t prepareWait() const { return this->epoch.load(); }
+
+  /**
+   * Waits until notify() has been called since the key was acquired
+   * @param key the key from prepareWait()
+   */
+  void wait(size_t key) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->numWaiting++;
+    this->condition.wait(lock, [&]() { return this->epoch.load() != key; });
+    this->numWaiting--;
+  }
+
+  /**
+   * Waits until notify() has been called since the key was acquired, or until the timeout expires
+   * @param key the key from prepareWait()
+   * @param timeout the timeout time in microseconds
+   * @return whether notify() was called
+   */
+  bool waitFor(size_t key, size_t timeout) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->numWaiting++;
+    bool notified = this->condition.wait_for(lock, std::chrono::microseconds(timeout),
+                                             [&]() { return this->epoch.load() != key; });
+    this->numWaiting--;
+    return notified;
+  }
+
+  /**
+   * Notifies waiting consumers that data has been added, must be called after adding the data
+   */
+  void notify() {
+    this->epoch++;
+    if (this->numWaiting.load() > 0) {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->condition.notify_all();
+    }
+  }
+
+ private:
+  std::atomic_size_t epoch; //!< The number of notifications
+  std::atomic_size_t numWaiting; //!< The number of consumers waiting for a notification
+  std::mutex mutex; //!< The mutex for waiting consumers
+  std::condition_variable condition; //!< Signals waiting consumers
+};
+}
+
+#endif //HTGS_LANESIGNAL_HPP
@@ -19,6 +19,9 @@
 #include <ostream>
 #include <iostream>
 #include <queue>
+#include <list>
+#include <set>
+#include <htgs/types/QueueDiscipline.hpp>
 #include <htgs/api/IData.hpp>
 
 namespace htgs {
@@ -149,7 +152,39 @@ class PriorityBlockingQueue {
         queueActiveMaxSize = queue.size();
 #endif
 
-    this->condition.notify_one();
+    // Consumers waiting for a batch may not be satisfied by a single element, so all consumers are woken up
+    if (!this->batchWaiters.empty())
+      this->condition.notify_all();
+    else
+      this->condition.notify_one();
+  }
+
+  /**
+   * Adds elements into the priority queue at once, so that the lock is only acquired once for all of the elements
+   * @param values the elements to be added
+   * @note Is thread safe.
+   * @note Will block while the queue is full if the maximum queue size > 0
+   */
+  void EnqueueBatch(const std::list<T> &values) {
+    if (values.empty())
+      return;
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    for (const T &value : values) {
+      if (this->queueSize > 0 && this->queue.size() == queueSize) {
+        this->condition.notify_all();
+        this->condition.wait(lock, [=] { return this->queue.size() != queueSize; });
+      }
+
+      queue.push(value);
+    }
+
+#ifdef PROFILE
+    if (queue.size() > queueActiveMaxSize)
+        queueActiveMaxSize = queue.size();
+#endif
+
+    this->condition.notify_all();
   }
 
   /**
@@ -180,6 +215,57 @@ class PriorityBlockingQueue {
     return res;
   }
 
+  /**
+   * Gets the largest number of elements that a consumer waiting on DequeueBatch requested.
+   * @return the number of elements, 0 if no consumer is waiting on DequeueBatch
+   * @note Is thread safe.
+   */
+  size_t getBatchDemand() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->batchWaiters.empty() ? 0 : *this->batchWaiters.rbegin();
+  }
+
+  /**
+   * Removes count elements from the queue at once.
+   * Waits until count elements are available, so that elements are never partially removed while waiting.
+   * @param count the number of elements to remove
+   * @return the list of elements
+   * @note Is thread safe.
+   * @note Will block until count elements are in the queue.
+   */
+  std::list<T> DequeueBatch(size_t count) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    auto waiter = this->batchWaiters.insert(count);
+    this->condition.wait(lock, [=] { return this->queue.size() >= count; });
+    this->batchWaiters.erase(waiter);
+    for (size_t i = 0; i < count; i++) {
+      elements.push_back(this->queue.top());
+      this->queue.pop();
+    }
+    return elements;
+  }
+
+  /**
+   * Removes up to count elements that are available in the priority queue at once.
+   * @param count the maximum number of elements to remove
+   * @param wait whether to wait until at least one element is in the queue
+   * @return the list of elements, which is empty if the queue is empty and wait is false
+   * @note Is thread safe.
+   */
+  std::list<T> DequeueAvailable(size_t count, bool wait) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (wait)
+      this->condition.wait(lock, [=] { return !this->queue.empty(); });
+
+    while (!this->queue.empty() && elements.size() < count) {
+      elements.push_back(this->queue.top());
+      this->queue.pop();
+    }
+    return elements;
+  }
+
   /**
    * Polls for data given the specified timeout time in microseconds.
    * @param timeout the timeout time in microseconds
@@ -198,6 +284,58 @@ class PriorityBlockingQueue {
     return nullptr;
   }
 
+  /**
+   * Gets up to count elements at the front of the priority queue without removing them.
+   * Peeking more than one element copies the priority queue.
+   * @param count the maximum number of elements to retrieve
+   * @return the list of elements at the front of the queue, in dequeue order
+   * @note Is thread safe.
+   */
+  std::list<T> peek(size_t count) {
+    std::list<T> elements;
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (count == 1 && !this->queue.empty()) {
+      elements.push_back(this->queue.top());
+    } else if (count > 1) {
+      std::priority_queue<T, std::vector<T>, IData> copy = this->queue;
+      while (elements.size() < count && !copy.empty()) {
+        elements.push_back(copy.top());
+        copy.pop();
+      }
+    }
+    return elements;
+  }
+
+  /**
+   * Sets the order in which elements are removed from the queue.
+   * The priority blocking queue is always ordered by priority, so this function has no effect.
+   * @param discipline the queue discipline
+   */
+  void setDiscipline(QueueDiscipline discipline) {}
+
+  /**
+   * Gets the order in which elements are removed from the queue.
+   * @return QueueDiscipline::Priority
+   */
+  QueueDiscipline getDiscipline() const {
+    return QueueDiscipline::Priority;
+  }
+
+  /**
+   * Sets the bound for QueueDiscipline::BoundedLIFO.
+   * The priority blocking queue is always ordered by priority, so this function has no effect.
+   * @param bound the bound
+   */
+  void setLifoBound(size_t bound) {}
+
+  /**
+   * Gets the bound for QueueDiscipline::BoundedLIFO.
+   * @return HTGS_DEFAULT_LIFO_BOUND
+   */
+  size_t getLifoBound() const {
+    return HTGS_DEFAULT_LIFO_BOUND;
+  }
+
 #ifdef PROFILE_QUEUE
     unsigned long long int getEnqueueLockTime() const {
         return enqueueLockTime;
@@ -234,6 +372,7 @@ class PriorityBlockingQueue {
   size_t queueActiveMaxSize; //!< The maximum size the queue reached in its lifetime
 #endif
   size_t queueSize; //!< The maximum size of the queue, set to -1 for infinite size
+  std::multiset<size_t> batchWaiters; //!< The number of elements each consumer waiting on DequeueBatch requested
   std::priority_queue<T, std::vector<T>, IData> queue; //!< The priority queue
   std::mutex mutex; //!< The mutex to ensure thread safety
   std::condition_variable condition; //!< The condition variable used for waking up waiting threads
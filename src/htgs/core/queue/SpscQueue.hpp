@@ -0,0 +1,306 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file SpscQueue.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements a single-producer single-consumer queue used by connectors between two single-threaded tasks
+ */
+#ifndef HTGS_SPSCQUEUE_HPP
+#define HTGS_SPSCQUEUE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <mutex>
+#include <thread>
+
+namespace htgs {
+/**
+ * @class SpscQueue SpscQueue.hpp <htgs/core/queue/SpscQueue.hpp>
+ * @brief An unbounded queue for exactly one producer thread and one consumer thread.
+ *
+ * @details
+ * Elements are stored in a linked list of fixed-size blocks. The producer writes the next slot and publishes it by
+ * incrementing an atomic counter, and the consumer reads the slots up to that counter, so enqueueing and dequeueing
+ * do not take a lock. One emptied block is kept for reuse, so a steady stream of elements does not allocate.
+ *
+ * When the queue is empty, the consumer spins briefly and then parks on a condition variable. The producer only takes
+ * the mutex to notify the consumer if the consumer is parked.
+ *
+ * Any thread may wake up the consumer with wakeup(), which makes the consumer return nullptr (as the BlockingQueue
+ * does for a nullptr element).
+ *
+ * @tparam T the type of element, which must be default constructible and comparable to nullptr
+ */
+template<class T>
+class SpscQueue {
+ public:
+  /**
+   * Creates an empty queue
+   */
+  SpscQueue() {
+    this->headBlock = new Block();
+    this->tailBlock = this->headBlock;
+    this->headIndex = 0;
+    this->tailIndex = 0;
+    this->spareBlock = nullptr;
+    this->numEnqueued = 0;
+    this->numDequeued = 0;
+    this->numWakeups = 0;
+    this->parked = false;
+#ifdef PROFILE
+    this->queueActiveMaxSize = 0;
+#endif
+  }
+
+  /**
+   * Destructor
+   */
+  ~SpscQueue() {
+    while (this->headBlock != nullptr) {
+      Block *next = this->headBlock->next.load();
+      delete this->headBlock;
+      this->headBlock = next;
+    }
+    delete this->spareBlock.load();
+  }
+
+  /**
+   * Gets the number of elements in the queue
+   * @return the number of elements in the queue
+   */
+  size_t size() const { return this->numEnqueued.load() - this->numDequeued.load(); }
+
+  /**
+   * Gets whether the queue is empty
+   * @return whether the queue is empty
+   */
+  bool isEmpty() const { return size() == 0; }
+
+  /**
+   * Adds an element into the queue
+   * @param value the element
+   * @note Must only be called by the producer thread
+   */
+  void Enqueue(T const &value) {
+    this->tailBlock->slots[this->tailIndex++] = value;
+
+    // Link the next block prior to publishing the last slot of the block
+    if (this->tailIndex == BLOCK_SIZE) {
+      Block *block = this->spareBlock.exchange(nullptr);
+      if (block == nullptr)
+        block = new Block();
+      block->next.store(nullptr, std::memory_order_relaxed);
+      this->tailBlock->next.store(block, std::memory_order_release);
+      this->tailBlock = block;
+      this->tailIndex = 0;
+    }
+
+    size_t enqueued = this->numEnqueued.fetch_add(1) + 1;
+#ifdef PROFILE
+    size_t currentSize = enqueued - this->numDequeued.load(std::memory_order_relaxed);
+    if (currentSize > this->queueActiveMaxSize)
+      this->queueActiveMaxSize = currentSize;
+#else
+    (void) enqueued;
+#endif
+
+    notifyConsumer();
+  }
+
+  /**
+   * Wakes up the consumer, which then receives nullptr
+   * @note Is thread safe.
+   */
+  void wakeup() {
+    this->numWakeups++;
+    notifyConsumer();
+  }
+
+  /**
+   * Removes the next element, waiting until an element is available or the consumer is woken up
+   * @return the next element, or nullptr if the consumer was woken up
+   * @note Must only be called by the consumer thread
+   */
+  T Dequeue() {
+    T value;
+    while (!tryDequeue(value)) {
+      if (!spin())
+        park(nullptr);
+    }
+    return value;
+  }
+
+  /**
+   * Removes the next element, waiting until an element is available, the consumer is woken up, or the timeout expires
+   * @param timeout the timeout time in microseconds
+   * @return the next element, or nullptr if the consumer was woken up or the timeout expired
+   * @note Must only be called by the consumer thread
+   */
+  T poll(size_t timeout) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(timeout);
+    T value;
+    while (!tryDequeue(value)) {
+      if (!spin() && !park(&deadline))
+        return nullptr;
+    }
+    return value;
+  }
+
+  /**
+   * Gets up to count elements at the front of the queue without removing them.
+   * @param count the maximum number of elements to retrieve
+   * @return the elements at the front of the queue, in dequeue order
+   * @note Must only be called by the consumer thread, or while the producer and consumer are paused
+   */
+  std::list<T> peek(size_t count) {
+    std::list<T> elements;
+    size_t available = this->numEnqueued.load(std::memory_order_acquire) - this->numDequeued.load();
+    Block *block = this->headBlock;
+    size_t index = this->headIndex;
+    for (size_t i = 0; i < available && i < count; i++) {
+      elements.push_back(block->slots[index++]);
+      if (index == BLOCK_SIZE) {
+        block = block->next.load(std::memory_order_acquire);
+        index = 0;
+      }
+    }
+    return elements;
+  }
+
+#ifdef PROFILE
+  /**
+   * Gets the maximum number of elements in the queue
+   * @return the maximum queue size
+   */
+  size_t getQueueActiveMaxSize() const {
+    return queueActiveMaxSize;
+  }
+
+  /**
+   * Resets the maximum number of elements in the queue
+   */
+  void resetMaxQueueSize() {
+    queueActiveMaxSize = 0;
+  }
+#endif
+
+ private:
+  //! @cond Doxygen_Suppress
+  static const size_t BLOCK_SIZE = 256;
+  static const size_t SPIN_COUNT = 128;
+
+  struct Block {
+    T slots[BLOCK_SIZE];
+    std::atomic<Block *> next{nullptr};
+  };
+  //! @endcond
+
+  /**
+   * Removes the next element if there is one, or takes a wakeup
+   * @param value the element that is removed, or nullptr for a wakeup
+   * @return whether an element or wakeup was taken
+   */
+  bool tryDequeue(T &value) {
+    size_t wakeups = this->numWakeups.load(std::memory_order_relaxed);
+    while (wakeups > 0) {
+      if (this->numWakeups.compare_exchange_weak(wakeups, wakeups - 1)) {
+        value = nullptr;
+        return true;
+      }
+    }
+
+    size_t dequeued = this->numDequeued.load(std::memory_order_relaxed);
+    if (dequeued == this->numEnqueued.load(std::memory_order_acquire))
+      return false;
+
+    value = this->headBlock->slots[this->headIndex];
+    this->headBlock->slots[this->headIndex] = T();
+
+    if (++this->headIndex == BLOCK_SIZE) {
+      Block *next = this->headBlock->next.load(std::memory_order_acquire);
+      delete this->spareBlock.exchange(this->headBlock);
+      this->headBlock = next;
+      this->headIndex = 0;
+    }
+
+    this->numDequeued.store(dequeued + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Gets whether there is an element or wakeup for the consumer
+   * @return whether the consumer can make progress
+   */
+  bool isReady() const {
+    return this->numWakeups.load() > 0 || this->numEnqueued.load() != this->numDequeued.load();
+  }
+
+  /**
+   * Spins for a short time waiting for an element or wakeup
+   * @return whether an element or wakeup is available
+   */
+  bool spin() const {
+    for (size_t i = 0; i < SPIN_COUNT; i++) {
+      if (isReady())
+        return true;
+      std::this_thread::yield();
+    }
+    return false;
+  }
+
+  /**
+   * Parks the consumer until an element or wakeup is available
+   * @param deadline the time to stop waiting, or nullptr to wait indefinitely
+   * @return whether an element or wakeup is available
+   */
+  bool park(const std::chrono::steady_clock::time_point *deadline) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->parked = true;
+    bool ready;
+    if (deadline == nullptr) {
+      this->condition.wait(lock, [&] { return isReady(); });
+      ready = true;
+    } else {
+      ready = this->condition.wait_until(lock, *deadline, [&] { return isReady(); });
+    }
+    this->parked = false;
+    return ready;
+  }
+
+  /**
+   * Notifies the consumer if it is parked
+   */
+  void notifyConsumer() {
+    // Sequentially consistent with the consumer setting parked prior to checking for elements, so either the consumer
+    // sees the new element or the producer sees that the consumer is parked
+    if (this->parked.load()) {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->condition.notify_one();
+    }
+  }
+
+  Block *headBlock; //!< The block that the consumer reads from (consumer only)
+  size_t headIndex; //!< The next slot for the consumer to read (consumer only)
+  Block *tailBlock; //!< The block that the producer writes to (producer only)
+  size_t tailIndex; //!< The next slot for the producer to write (producer only)
+  std::atomic<Block *> spareBlock; //!< An emptied block that is reused by the producer
+  std::atomic_size_t numEnqueued; //!< The number of elements published by the producer
+  std::atomic_size_t numDequeued; //!< The number of elements removed by the consumer
+  std::atomic_size_t numWakeups; //!< The number of wakeups waiting for the consumer
+  std::atomic_bool parked; //!< Whether the consumer is parked
+  std::mutex mutex; //!< The mutex used for parking the consumer
+  std::condition_variable condition; //!< The condition variable used for parking the consumer
+#ifdef PROFILE
+  size_t queueActiveMaxSize; //!< The maximum size the queue reached in its lifetime
+#endif
+};
+}
+
+#endif //HTGS_SPSCQUEUE_HPP
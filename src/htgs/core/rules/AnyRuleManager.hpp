@@ -15,6 +15,7 @@
 #define HTGS_ANYRULEMANAGER_HPP
 
 #include <htgs/core/graph/AnyConnector.hpp>
+#include <htgs/core/graph/profile/RuleManagerProfile.hpp>
 
 namespace htgs {
 
@@ -137,6 +138,12 @@ class AnyRuleManager {
    */
   virtual void checkRuleTermination() = 0;
 
+  /**
+   * Gets the profile of the RuleManager, which is only gathered if the PROFILE directive is defined
+   * @return the rule manager profile
+   */
+  virtual const RuleManagerProfile &getProfile() = 0;
+
 };
 }
 #endif //HTGS_ANYRULEMANAGER_HPP
@@ -15,8 +15,11 @@
 
 #include <htgs/api/Bookkeeper.hpp>
 #include <htgs/api/IRule.hpp>
+#include <htgs/api/ILineageData.hpp>
 #include <htgs/core/graph/Connector.hpp>
 #include <htgs/core/rules/AnyRuleManagerInOnly.hpp>
+#include <htgs/log/FlightRecorder.hpp>
+#include <chrono>
 
 namespace htgs {
 
@@ -68,7 +71,8 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
    * @internal
    */
   RuleManager(std::shared_ptr<htgs::IRule<T, U>> rule)// TODO: Delete or Add #ifdef, TaskGraphCommunicator *communicator)
-      : rule(rule), /*TODO: Delete or Add #ifdef communicator(communicator),*/ pipelineId(0), numPipelines(1), terminated(false) {}
+      : rule(rule), /*TODO: Delete or Add #ifdef communicator(communicator),*/ pipelineId(0), numPipelines(1), terminated(false), flightRecorderId(0),
+        startTime(std::chrono::high_resolution_clock::now()) {}
 
   /**
    * Destructor
@@ -76,10 +80,21 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
   virtual ~RuleManager() override {}
 
   void executeTask(std::shared_ptr<T> data) override {
-
+#ifdef PROFILE
+    auto lockStart = std::chrono::high_resolution_clock::now();
+    bool contended = false;
+    if (this->rule->canUseLocks()) {
+      if (!this->rule->getMutex().try_lock()) {
+        contended = true;
+        this->rule->getMutex().lock();
+      }
+    }
+    auto applyStart = std::chrono::high_resolution_clock::now();
+#else
     if (this->rule->canUseLocks()) {
       this->rule->getMutex().lock();
     }
+#endif
 
     // Check if the rule is expecting data or not
     checkRuleTermination();
@@ -87,7 +102,19 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
     HTGS_DEBUG_VERBOSE("Rule: " << rule->getName() << " consuming data: " << data);
     auto result = rule->applyRuleFunction(data, pipelineId);
 
+#ifdef PROFILE
+    auto applyFinish = std::chrono::high_resolution_clock::now();
+    profile.addInvocation(std::chrono::duration_cast<std::chrono::nanoseconds>(applyFinish - applyStart).count(),
+                          contended ? std::chrono::duration_cast<std::chrono::nanoseconds>(applyStart - lockStart).count() : 0,
+                          contended, result == nullptr ? 0 : result->size());
+#endif
+
     if (result != nullptr && result->size() > 0) {
+      // Results inherit the lineage of the data that triggered them (only if T and U derive from ILineageData)
+      for (auto &resultData : *result)
+        propagateLineage(data.get(), resultData.get());
+
+      HTGS_FLIGHT_RECORD(this->flightRecorderId, FlightEventType::RuleOutput, result->size());
       if (this->connector != nullptr) {
 #ifdef WS_PROFILE
         sendWSProfileUpdate(this, StatusCode::ACTIVATE_EDGE);
@@ -115,6 +142,10 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
     return this->rule->getName() + inOutLabel;
   }
 
+  const RuleManagerProfile &getProfile() override {
+    return profile;
+  }
+
   void debug() override {
     HTGS_DEBUG(this->getName() << " output connector: " << this->connector);
   }
@@ -128,6 +159,11 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
     this->pipelineId = pipelineId;
     this->numPipelines = numPipelines;
     this->address = address;
+    this->startTime = std::chrono::high_resolution_clock::now();
+#ifdef USE_FLIGHT_RECORDER
+    this->flightRecorderId = FlightRecorder::registerName(
+        "Rule " + this->rule->getName() + " (pipeline " + std::to_string(pipelineId) + ")");
+#endif
   }
 
   void shutdown() override {
@@ -144,6 +180,7 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
 #ifdef WS_PROFILE
       sendWSProfileUpdate(this->connector.get(), StatusCode::DECREMENT);
 #endif
+      recordTermination();
     }
 
     // Shutdown the rule's pipeline ID
@@ -168,6 +205,7 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
       // Check if the rule is ready to be terminated before and after processing data
       if (rule->canTerminateRule(pipelineId)) {
         terminated = true;
+        recordTermination();
         this->connector->producerFinished();
         if (this->connector->isInputTerminated()) {
           this->connector->wakeupConsumer();
@@ -182,6 +220,13 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
  private:
 
   //! @cond Doxygen_Suppress
+  void recordTermination() {
+#ifdef PROFILE
+    profile.setTerminationTime(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() - startTime).count());
+#endif
+  }
+
 #ifdef WS_PROFILE
   void sendWSProfileUpdate(void *addr, StatusCode code)
   {
@@ -240,6 +285,9 @@ class RuleManager : public AnyRuleManagerInOnly<T> {
   std::string address; //!< The address for the rule manager
   std::shared_ptr<htgs::Connector<U>> connector; //!< The connector for producing data from the rule
   volatile bool terminated; //!< Whether this RuleManager is terminated or not
+  uint32_t flightRecorderId; //!< The name id used by the FlightRecorder for this RuleManager
+  std::chrono::time_point<std::chrono::high_resolution_clock> startTime; //!< The time the RuleManager was initialized
+  RuleManagerProfile profile; //!< The profile for the RuleManager
 
 };
 
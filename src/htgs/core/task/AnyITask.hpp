@@ -13,6 +13,7 @@
 #ifndef HTGS_ANYITASK_HPP
 #define HTGS_ANYITASK_HPP
 
+#include <map>
 #include <memory>
 #include <cassert>
 #include <sstream>
@@ -281,6 +282,75 @@ class AnyITask {
    */
   virtual std::string debugDotNode() { return ""; }
 
+  /**
+   * Gets whether the task is paused while its task graph is being checkpointed (see CheckpointManager).
+   * Tasks that must remain active for other tasks to make progress, such as memory managers, should return false.
+   * @return whether the task is paused for checkpoints
+   * @retval TRUE if the task is paused for checkpoints (default)
+   * @retval FALSE if the task continues to execute during checkpoints
+   */
+  virtual bool canPauseForCheckpoint() { return true; }
+
+  /**
+   * Gets whether the connectors of the task can use a single-producer single-consumer queue when the task is the only
+   * thread producing or consuming data for a connector (see TaskGraphRuntime). Tasks that produce data from threads
+   * other than their own, such as from the callbacks of an external library, must return false.
+   * @return whether the task's connectors can use single-producer single-consumer queues
+   * @retval TRUE if the task only produces and consumes data from its own thread (default)
+   * @retval FALSE if the task's connectors must use blocking queues
+   */
+  virtual bool canUseSpscQueue() { return true; }
+
+  /**
+   * Gets whether the task takes part in demand-driven (pull) execution (see TaskGraphConf::enablePullExecution).
+   * When the task's output is demand-driven, the task only consumes one data for each data that is requested from it,
+   * and its input becomes demand-driven. Tasks whose output is produced by other threads must return false.
+   * @return whether the task can pull data
+   * @retval TRUE if the task pulls its input on demand (default)
+   * @retval FALSE if the task consumes its input as it arrives
+   */
+  virtual bool canPullData() { return true; }
+
+  /**
+   * Gets whether the task's output connector should be split into lanes, which are handed out to the threads that
+   * produce the task's output (see AnyConnector::enableLanes). Tasks that hand their output connector to several
+   * sub-graphs, such as the ExecutionPipeline, return true so that the sub-graphs do not contend on one queue.
+   * @return whether the task's output connector uses lanes
+   * @retval TRUE if the output connector is split into lanes
+   * @retval FALSE if the output connector uses a single queue (default)
+   */
+  virtual bool usesOutputLanes() { return false; }
+
+  /**
+   * Gets the parameters of the task that are saved in a TuningProfile, such as the size of a memory pool. The number of
+   * threads is saved for every task and is not included.
+   * @return the tunable parameters, keyed by name (none by default)
+   */
+  virtual std::map<std::string, size_t> getTuningParameters() { return std::map<std::string, size_t>(); }
+
+  /**
+   * Sets a parameter that was loaded from a TuningProfile. Called prior to the task being bound to a thread.
+   * @param name the name of the parameter (see getTuningParameters)
+   * @param value the value of the parameter
+   */
+  virtual void setTuningParameter(std::string name, size_t value) {}
+
+  /**
+   * Gets the resource classes that the task uses while it executes, such as "disk" or "membw". A slot is acquired
+   * from each class prior to executing the task, which limits the number of threads among all tasks that use the
+   * resource at the same time (see ResourceRegistry).
+   * @return the names of the resource classes (none by default)
+   */
+  virtual std::vector<std::string> getResourceClasses() { return std::vector<std::string>(); }
+
+  /**
+   * Virtual function that is called when a timer that was scheduled with ITask::scheduleTimer or
+   * ITask::schedulePeriodicTimer expires. The timer is run by one of the threads of the task, which may be a different
+   * copy of the task than the one that scheduled it.
+   * @param timerId the id of the timer
+   */
+  virtual void executeTimer(uint64_t timerId) {}
+
 
 
   /**
@@ -413,6 +483,15 @@ class AnyITask {
     return this->numThreads;
   }
 
+  /**
+   * Sets the number of threads associated with this ITask
+   * @param numThreads the number of threads
+   * @note Must be called prior to executing the task graph
+   */
+  void setNumThreads(size_t numThreads) {
+    this->numThreads = numThreads;
+  }
+
   /**
    * Gets whether this ITask is a starting task
    * @return whether the ITask is a starting task
@@ -0,0 +1,119 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file AnySdfStage.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the AnySdfStage, which is the base class for a stage of a statically scheduled region.
+ */
+#ifndef HTGS_ANYSDFSTAGE_HPP
+#define HTGS_ANYSDFSTAGE_HPP
+
+#include <memory>
+#include <string>
+#include <htgs/api/IData.hpp>
+
+namespace htgs {
+
+/**
+ * @class AnySdfStage AnySdfStage.hpp <htgs/core/task/AnySdfStage.hpp>
+ * @brief Implements the base class for a stage of a statically scheduled region, removing the template arguments.
+ * @details
+ * A stage binds an ITask to a preallocated output buffer. Firing the stage executes the ITask on one data within the
+ * calling thread, which fills the output buffer with the results of the ITask. The SdfTask then passes the results
+ * to the next stage.
+ *
+ * @note This class should only be called by the HTGS API
+ */
+class AnySdfStage {
+ public:
+  /**
+   * Destructor
+   */
+  virtual ~AnySdfStage() {}
+
+  /**
+   * Initializes the ITask of the stage
+   */
+  virtual void initialize() = 0;
+
+  /**
+   * Executes the ITask on data, adding its results to the output buffer
+   * @param data the data
+   */
+  virtual void fire(std::shared_ptr<IData> data) = 0;
+
+  /**
+   * Executes the ITask's executeTaskFinal, adding its results to the output buffer
+   */
+  virtual void fireFinal() = 0;
+
+  /**
+   * Shuts down the ITask of the stage
+   */
+  virtual void shutdown() = 0;
+
+  /**
+   * Gets the number of results in the output buffer
+   * @return the number of results
+   */
+  virtual size_t getNumOutputs() const = 0;
+
+  /**
+   * Gets a result from the output buffer
+   * @param index the index of the result
+   * @return the result
+   */
+  virtual std::shared_ptr<IData> getOutput(size_t index) const = 0;
+
+  /**
+   * Clears the output buffer, keeping its capacity
+   */
+  virtual void clearOutputs() = 0;
+
+  /**
+   * Preallocates the output buffer
+   * @param capacity the number of results the output buffer holds without reallocating
+   */
+  virtual void reserveOutputs(size_t capacity) = 0;
+
+  /**
+   * Creates a copy of the stage with a copy of its ITask
+   * @param pipelineId the pipeline id for the copy
+   * @param numPipelines the number of pipelines
+   * @param address the address of the task graph that owns the copy
+   * @return the copy
+   */
+  virtual AnySdfStage *copy(size_t pipelineId, size_t numPipelines, std::string address) = 0;
+
+  /**
+   * Gets the name of the ITask
+   * @return the name
+   */
+  virtual std::string getName() = 0;
+
+  /**
+   * Gets the name of the ITask's input type
+   * @return the input type name
+   */
+  virtual std::string inTypeName() = 0;
+
+  /**
+   * Gets the name of the ITask's output type
+   * @return the output type name
+   */
+  virtual std::string outTypeName() = 0;
+
+  /**
+   * Gets the compute time of the ITask
+   * @return the compute time (us), if PROFILE is defined
+   */
+  virtual unsigned long long int getComputeTime() = 0;
+};
+}
+
+#endif //HTGS_ANYSDFSTAGE_HPP
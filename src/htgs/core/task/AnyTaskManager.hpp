@@ -20,6 +20,12 @@
 #include <htgs/core/comm/TaskGraphCommunicator.hpp>
 #include <htgs/core/graph/profile/TaskManagerProfile.hpp>
 #include <htgs/core/task/AnyITask.hpp>
+#include <htgs/api/FairShareScheduler.hpp>
+#include <htgs/api/ResourceRegistry.hpp>
+#include <htgs/log/FlightRecorder.hpp>
+#include <htgs/core/task/CheckpointGate.hpp>
+#include <htgs/api/TimerWheel.hpp>
+#include <htgs/core/task/CpuTopology.hpp>
 #include <htgs/core/graph/profile/NVTXProfiler.hpp>
 #ifdef USE_NVTX
 #include <nvtx3/nvToolsExt.h>
@@ -56,6 +62,17 @@ class AnyTaskManager {
   AnyTaskManager(size_t numThreads, bool isStartTask, size_t pipelineId, size_t numPipelines, std::string address) {
     this->taskComputeTime = 0L;
     this->taskWaitTime = 0L;
+    this->deadlineMisses = 0;
+    this->fairShareGroup = nullptr;
+    this->fairShareHeld = false;
+    this->resourceRegistry = nullptr;
+    this->resourcesHeld = false;
+    this->checkpointGate = nullptr;
+    this->timerWheel = nullptr;
+    this->pollTimerId = 0;
+    this->cpuAffinity = -1;
+    this->numDataProduced = 0;
+    this->flightRecorderId = 0;
     this->poll = false;
     this->timeout = 0L;
     this->numThreads = numThreads;
@@ -87,6 +104,17 @@ class AnyTaskManager {
                  std::string address) {
     this->taskComputeTime = 0L;
     this->taskWaitTime = 0L;
+    this->deadlineMisses = 0;
+    this->fairShareGroup = nullptr;
+    this->fairShareHeld = false;
+    this->resourceRegistry = nullptr;
+    this->resourcesHeld = false;
+    this->checkpointGate = nullptr;
+    this->timerWheel = nullptr;
+    this->pollTimerId = 0;
+    this->cpuAffinity = -1;
+    this->numDataProduced = 0;
+    this->flightRecorderId = 0;
     this->poll = poll;
     this->timeout = microTimeoutTime;
     this->numThreads = numThreads;
@@ -297,6 +325,16 @@ class AnyTaskManager {
    */
   size_t getNumThreads() const { return this->numThreads; }
 
+  /**
+   * Sets the number of threads associated with this TaskManager and its ITask
+   * @param numThreads the number of threads
+   * @note Must be called prior to executing the task graph
+   */
+  void setNumThreads(size_t numThreads) {
+    this->numThreads = numThreads;
+    this->getTaskFunction()->setNumThreads(numThreads);
+  }
+
   /**
    * Sets the alive state for this task manager
    * @param val the value to set, true = alive, false = dead/terminating
@@ -368,6 +406,261 @@ class AnyTaskManager {
    */
   void incWaitTime(int64_t val) { this->taskWaitTime += val; }
 
+  /**
+   * Increments the number of data that expired prior to being processed by this task
+   */
+  void incDeadlineMisses() { this->deadlineMisses++; }
+
+  /**
+   * Gets the number of data that expired prior to being processed by this task.
+   * Expired data is only detected on connectors created with TaskGraphConf::addDeadlineEdge.
+   * @return the number of deadline misses
+   */
+  size_t getDeadlineMisses() const { return this->deadlineMisses; }
+
+  /**
+   * Sets the fair share group that this TaskManager acquires slots from prior to executing its task.
+   * @param fairShareGroup the fair share group, or nullptr to disable fair share scheduling
+   */
+  void setFairShareGroup(std::shared_ptr<FairShareGroup> fairShareGroup) { this->fairShareGroup = fairShareGroup; }
+
+  /**
+   * Gets the fair share group that this TaskManager acquires slots from prior to executing its task.
+   * @return the fair share group, or nullptr if fair share scheduling is disabled
+   */
+  std::shared_ptr<FairShareGroup> getFairShareGroup() const { return this->fairShareGroup; }
+
+  /**
+   * Acquires a slot from the fair share group, which parks the thread until its task graph is within its fair share.
+   * Does nothing if there is no fair share group or if the slot is already held.
+   */
+  void acquireFairShare() {
+    if (this->fairShareGroup != nullptr && !this->fairShareHeld) {
+      this->fairShareStart = this->fairShareGroup->acquire();
+      this->fairShareHeld = true;
+    }
+  }
+
+  /**
+   * Releases the slot that is held from the fair share group.
+   * Does nothing if there is no fair share group or if the slot is not held.
+   */
+  void releaseFairShare() {
+    if (this->fairShareGroup != nullptr && this->fairShareHeld) {
+      this->fairShareGroup->release(this->fairShareStart);
+      this->fairShareHeld = false;
+    }
+  }
+
+  /**
+   * Sets the resource registry that this TaskManager acquires slots from for the resource classes of its task (see
+   * AnyITask::getResourceClasses).
+   * @param resourceRegistry the resource registry, or nullptr to not limit the resources of the task
+   */
+  void setResourceRegistry(std::shared_ptr<ResourceRegistry> resourceRegistry) {
+    this->resourceRegistry = resourceRegistry;
+    this->resourceClasses.clear();
+    if (resourceRegistry != nullptr)
+      this->resourceClasses = resourceRegistry->getResourceClasses(this->getTaskFunction()->getResourceClasses());
+  }
+
+  /**
+   * Gets the resource registry that this TaskManager acquires slots from
+   * @return the resource registry, or nullptr if the resources of the task are not limited
+   */
+  std::shared_ptr<ResourceRegistry> getResourceRegistry() const { return this->resourceRegistry; }
+
+  /**
+   * Acquires a slot from each resource class of the task, which parks the thread until each resource is below its
+   * limit. Does nothing if the task has no resource classes or if the slots are already held.
+   */
+  void acquireResources() {
+    if (!this->resourcesHeld && !this->resourceClasses.empty()) {
+      for (auto &resourceClass : this->resourceClasses)
+        resourceClass->acquire();
+      this->resourcesHeld = true;
+    }
+  }
+
+  /**
+   * Releases the slots that are held from the resource classes of the task.
+   * Does nothing if the slots are not held.
+   */
+  void releaseResources() {
+    if (this->resourcesHeld) {
+      for (auto it = this->resourceClasses.rbegin(); it != this->resourceClasses.rend(); ++it)
+        (*it)->release();
+      this->resourcesHeld = false;
+    }
+  }
+
+  /**
+   * Attaches this TaskManager to a checkpoint gate, which pauses the TaskManager prior to consuming data while the
+   * task graph is being checkpointed. Tasks that cannot be paused (see AnyITask::canPauseForCheckpoint) are not attached.
+   * @param checkpointGate the checkpoint gate, or nullptr to detach
+   */
+  void setCheckpointGate(std::shared_ptr<CheckpointGate> checkpointGate) {
+    if (checkpointGate != nullptr && !this->getTaskFunction()->canPauseForCheckpoint())
+      checkpointGate = nullptr;
+
+    this->checkpointGate = checkpointGate;
+  }
+
+  /**
+   * Sets the timer wheel for this TaskManager. If the TaskManager is polling, then the timer wheel drives the polling:
+   * the threads block on the input connector, and the timer wheel wakes up a thread every timeout period to execute
+   * the task with nullptr.
+   * @param timerWheel the timer wheel, or nullptr to poll with a timeout on the input connector
+   * @note Must be set prior to initializing the TaskManager
+   */
+  void setTimerWheel(std::shared_ptr<TimerWheel> timerWheel) { this->timerWheel = timerWheel; }
+
+  /**
+   * Gets the timer wheel for this TaskManager
+   * @return the timer wheel, or nullptr if no timer wheel has been set or used
+   */
+  std::shared_ptr<TimerWheel> getTimerWheel() const { return this->timerWheel; }
+
+  /**
+   * Gets whether the polling for this TaskManager is driven by a timer wheel
+   * @return whether polling is driven by a timer wheel
+   */
+  bool isPollDrivenByTimer() const { return this->pollTimerId != 0; }
+
+  /**
+   * Starts the periodic timer that drives polling, if this TaskManager is polling and has a timer wheel
+   */
+  void startPollTimer() {
+    std::shared_ptr<AnyConnector> connector = this->getInputConnector();
+    if (!this->poll || this->timerWheel == nullptr || connector == nullptr || this->pollTimerId != 0)
+      return;
+
+    this->pollTimerId = this->timerWheel->schedulePeriodic(std::chrono::microseconds(this->timeout),
+                                                           [connector](uint64_t) { connector->postPollTick(); });
+  }
+
+  /**
+   * Schedules a timer that is delivered to the threads of this TaskManager through its input connector (see
+   * AnyITask::executeTimer). Uses the process-wide timer wheel if no timer wheel has been set.
+   * @param delay the delay until the timer expires
+   * @param period the period of the timer, or 0 for a one-shot timer
+   * @return the timer id
+   */
+  uint64_t scheduleTimer(std::chrono::microseconds delay, std::chrono::microseconds period) {
+    std::shared_ptr<AnyConnector> connector = this->getInputConnector();
+    HTGS_ASSERT(connector != nullptr, "Task '" << this->getName() << "' must have an input connector to schedule timers");
+
+    if (this->timerWheel == nullptr)
+      this->timerWheel = TimerWheel::getProcessTimerWheel();
+
+    auto callback = [connector](uint64_t timerId) { connector->postTimer(timerId); };
+    if (period.count() == 0)
+      return this->timerWheel->schedule(delay, callback);
+
+    uint64_t timerId = this->timerWheel->schedulePeriodic(period, callback);
+    this->periodicTimers.push_back(timerId);
+    return timerId;
+  }
+
+  /**
+   * Cancels a timer that was scheduled by this TaskManager
+   * @param timerId the timer id
+   * @return whether the timer was cancelled
+   */
+  bool cancelTimer(uint64_t timerId) {
+    this->periodicTimers.remove(timerId);
+    return this->timerWheel != nullptr && this->timerWheel->cancel(timerId);
+  }
+
+  /**
+   * Sets the CPU that the thread of this TaskManager is bound to (see TaskPlacement). The thread applies the binding
+   * prior to initializing and before processing its next data, so it can be changed while the task is executing.
+   * @param cpu the CPU id, or -1 to allow the thread to run on any CPU
+   */
+  void setCpuAffinity(int cpu) { this->cpuAffinity.store(cpu, std::memory_order_relaxed); }
+
+  /**
+   * Gets the CPU that the thread of this TaskManager is bound to
+   * @return the CPU id, or -1 if the thread is not bound
+   */
+  int getCpuAffinity() const { return this->cpuAffinity.load(std::memory_order_relaxed); }
+
+  /**
+   * Gets the number of data that this TaskManager has produced into its output connector
+   * @return the number of data produced
+   */
+  size_t getNumDataProduced() const { return this->numDataProduced.load(std::memory_order_relaxed); }
+
+  /**
+   * Increments the number of data that this TaskManager has produced into its output connector
+   * @note Must only be called by the thread of this TaskManager, so the counter is not a contended atomic
+   */
+  void incrementNumDataProduced() {
+    this->numDataProduced.store(this->numDataProduced.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  /**
+   * Cancels the polling timer and the periodic timers of this TaskManager, called when the TaskManager terminates
+   */
+  void stopTimers() {
+    if (this->timerWheel == nullptr)
+      return;
+
+    if (this->pollTimerId != 0)
+      this->timerWheel->cancel(this->pollTimerId);
+
+    for (uint64_t timerId : this->periodicTimers)
+      this->timerWheel->cancel(timerId);
+
+    this->periodicTimers.clear();
+  }
+
+  /**
+   * Gets the checkpoint gate that this TaskManager is attached to
+   * @return the checkpoint gate, or nullptr if not attached
+   */
+  std::shared_ptr<CheckpointGate> getCheckpointGate() const { return this->checkpointGate; }
+
+  /**
+   * Enters the checkpoint gate prior to consuming data, blocking while the task graph is being checkpointed.
+   * Does nothing if the TaskManager is not attached to a checkpoint gate.
+   */
+  void enterCheckpointGate() {
+    if (this->checkpointGate != nullptr)
+      this->checkpointGate->enter(this->getInputConnector());
+  }
+
+  /**
+   * Marks that data has been consumed after entering the checkpoint gate, so the checkpoint gate no longer wakes up
+   * this TaskManager when pausing.
+   * Does nothing if the TaskManager is not attached to a checkpoint gate.
+   */
+  void endCheckpointGateWait() {
+    if (this->checkpointGate != nullptr)
+      this->checkpointGate->endWait(this->getInputConnector());
+  }
+
+  /**
+   * Exits the checkpoint gate after data has been processed.
+   * Does nothing if the TaskManager is not attached to a checkpoint gate.
+   */
+  void exitCheckpointGate() {
+    if (this->checkpointGate != nullptr)
+      this->checkpointGate->exit();
+  }
+
+  /**
+   * Gets the name id used by the FlightRecorder for this TaskManager (set during initialization)
+   * @return the flight recorder name id
+   */
+  uint32_t getFlightRecorderId() const { return this->flightRecorderId; }
+
+  /**
+   * Sets the name id used by the FlightRecorder for this TaskManager
+   * @param flightRecorderId the flight recorder name id
+   */
+  void setFlightRecorderId(uint32_t flightRecorderId) { this->flightRecorderId = flightRecorderId; }
+
   /**
    * Shuts down the TaskManager
    */
@@ -491,6 +784,7 @@ class AnyTaskManager {
   void resetProfile() {
     taskComputeTime = 0;
     taskWaitTime = 0;
+    deadlineMisses = 0;
     if (this->getInputConnector() != nullptr)
     {
       this->getInputConnector()->resetMaxQueueSize();
@@ -537,6 +831,21 @@ class AnyTaskManager {
 
   unsigned long long int taskComputeTime; //!< The total compute time for the task
   unsigned long long int taskWaitTime; //!< The total wait time for the task
+  size_t deadlineMisses; //!< The number of data that expired prior to being processed
+
+  std::shared_ptr<FairShareGroup> fairShareGroup; //!< The fair share group to acquire slots from (nullptr if disabled)
+  bool fairShareHeld; //!< Whether a slot from the fair share group is held
+  std::chrono::steady_clock::time_point fairShareStart; //!< The time when the slot from the fair share group was acquired
+  std::shared_ptr<ResourceRegistry> resourceRegistry; //!< The registry of the resource classes (nullptr if not limited)
+  std::vector<std::shared_ptr<ResourceClass>> resourceClasses; //!< The resource classes of the task, ordered by name
+  bool resourcesHeld; //!< Whether the slots from the resource classes are held
+  uint32_t flightRecorderId; //!< The name id used by the FlightRecorder for this TaskManager
+  std::shared_ptr<CheckpointGate> checkpointGate; //!< The checkpoint gate that pauses this TaskManager (nullptr if not attached)
+  std::shared_ptr<TimerWheel> timerWheel; //!< The timer wheel for polling and timers (nullptr if not used)
+  uint64_t pollTimerId; //!< The id of the timer that drives polling (0 if not driven by a timer wheel)
+  std::list<uint64_t> periodicTimers; //!< The periodic timers scheduled by this TaskManager
+  std::atomic_int cpuAffinity; //!< The CPU that the thread is bound to (-1 if not bound)
+  std::atomic_size_t numDataProduced; //!< The number of data produced into the output connector (written only by the thread of this TaskManager)
 
   size_t timeout; //!< The timeout time for polling in microseconds
   bool poll; //!< Whether the manager should poll for data
@@ -590,6 +899,7 @@ class TaskManagerThread {
     this->numThreadsAfterDecrement = *this->numThreads;
     this->taskGraphInitializeCond = taskGraphInitializeCond;
     this->taskGraphInitializeMutex = taskGraphInitializeMutex;
+    this->boundCpu = -1;
   }
 
   /**
@@ -612,6 +922,7 @@ class TaskManagerThread {
 //#endif
 
     HTGS_DEBUG("Starting Thread for task : " << task->getName());
+    applyCpuAffinity();
     this->task->initialize();
 
     {
@@ -620,6 +931,7 @@ class TaskManagerThread {
     }
 
     while (!this->terminated) {
+      applyCpuAffinity();
       this->task->executeTask();
     }
     this->task->shutdown();
@@ -680,12 +992,24 @@ class TaskManagerThread {
   void terminate() { this->terminated = true; }
 
  private:
+  /**
+   * Binds the thread to the CPU of the TaskManager if it has changed
+   */
+  void applyCpuAffinity() {
+    int cpu = this->task->getCpuAffinity();
+    if (cpu != this->boundCpu) {
+      CpuTopology::bindThread(cpu);
+      this->boundCpu = cpu;
+    }
+  }
+
   volatile bool terminated; //!< Whether the thread is ready to be terminated or not
   std::shared_ptr<std::atomic_size_t> numThreads; //!< The number of total threads managing the TaskManager
   AnyTaskManager *task; //!< The TaskManager that is called from the thread
   size_t numThreadsAfterDecrement; // !< The number of threads after being decremented
   std::condition_variable *taskGraphInitializeCond; //!< The condition variable that is used by the owner task graph for checking if all tasks have been initialized
   std::mutex *taskGraphInitializeMutex; //!< The mutex used to notify the task has been initialized
+  int boundCpu; //!< The CPU that the thread is currently bound to (-1 if not bound)
 };
 
 }
@@ -0,0 +1,147 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file CheckpointGate.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the CheckpointGate, which pauses task threads so that a task graph can be checkpointed.
+ */
+#ifndef HTGS_CHECKPOINTGATE_HPP
+#define HTGS_CHECKPOINTGATE_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include <htgs/core/graph/AnyConnector.hpp>
+
+namespace htgs {
+
+/**
+ * @class CheckpointGate CheckpointGate.hpp <htgs/core/task/CheckpointGate.hpp>
+ * @brief Pauses the threads of a task graph at the point where they consume data, so that the graph is quiescent.
+ *
+ * @details
+ * Each TaskManager that is attached to the gate enters the gate prior to consuming data from its input connector and
+ * exits the gate after it has finished executing that data. When the gate is paused, threads that have not entered
+ * are blocked, and the input connectors of the threads that are waiting for data are woken up so that those threads
+ * exit the gate. Threads that are executing are not woken up, so no stale wakeups are left in their connectors.
+ * Once no threads are inside the gate, the graph is quiescent: no task is executing, and all pending data is in
+ * the connectors.
+ *
+ * Memory managers and start tasks are not paused by the gate. A task that is blocked inside of execute, waiting for
+ * memory (ITask::getMemory) or for demand (ITask::waitForDemand), stays inside the gate because the data that it is
+ * executing is not in a connector. If that task is unblocked by a task that is paused, then pause times out.
+ *
+ * @note This class should only be called by the HTGS API, see CheckpointManager
+ */
+class CheckpointGate {
+ public:
+  /**
+   * Constructs a checkpoint gate that is not paused
+   */
+  CheckpointGate() {
+    this->paused = false;
+    this->numActive = 0;
+  }
+
+  /**
+   * Enters the gate, blocking while the gate is paused.
+   * The thread is then waiting for data from its input connector until endWait is called.
+   * @param connector the input connector of the thread, or nullptr if it has none
+   */
+  void enter(std::shared_ptr<AnyConnector> connector) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->condition.wait(lock, [&] { return !this->paused; });
+    this->numActive++;
+    if (connector != nullptr)
+      this->waitingConnectors.push_back(connector);
+  }
+
+  /**
+   * Marks that the thread has received from its input connector and is no longer waiting for data
+   * @param connector the input connector of the thread, or nullptr if it has none
+   */
+  void endWait(std::shared_ptr<AnyConnector> connector) {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    // The connector is not found if the thread was woken up by pause
+    auto it = std::find(this->waitingConnectors.begin(), this->waitingConnectors.end(), connector);
+    if (it != this->waitingConnectors.end())
+      this->waitingConnectors.erase(it);
+  }
+
+  /**
+   * Exits the gate
+   */
+  void exit() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->numActive--;
+    if (this->numActive == 0)
+      this->condition.notify_all();
+  }
+
+  /**
+   * Pauses the gate and waits for all threads to exit the gate.
+   * If the threads do not exit in time (for example a task is waiting for memory that is released
+   * by a paused task), then the gate is resumed.
+   * @param timeout the maximum time to wait for the threads to exit the gate
+   * @return whether the gate is paused with no threads inside of it
+   */
+  bool pause(std::chrono::milliseconds timeout) {
+    std::list<std::shared_ptr<AnyConnector>> connectors;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->paused = true;
+      // Each waiting thread is woken up once, even if pause is called again before it exits the gate
+      connectors.swap(this->waitingConnectors);
+    }
+
+    // Threads waiting for data are woken up with no data and then block on entering the gate
+    for (auto connector : connectors)
+      connector->wakeupConsumer();
+
+    std::unique_lock<std::mutex> lock(this->mutex);
+    if (!this->condition.wait_for(lock, timeout, [&] { return this->numActive == 0; })) {
+      this->paused = false;
+      this->condition.notify_all();
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * Resumes the gate, unblocking all threads that are waiting to enter
+   */
+  void resume() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    this->paused = false;
+    this->condition.notify_all();
+  }
+
+  /**
+   * Gets whether the gate is paused
+   * @return whether the gate is paused
+   */
+  bool isPaused() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    return this->paused;
+  }
+
+ private:
+  bool paused; //!< Whether the gate is paused
+  size_t numActive; //!< The number of threads inside the gate
+  std::list<std::shared_ptr<AnyConnector>> waitingConnectors; //!< The input connectors of the threads waiting for data, one per thread
+  std::mutex mutex; //!< The mutex to ensure thread safety
+  std::condition_variable condition; //!< The condition variable used for blocking threads and waiting for quiescence
+};
+}
+
+#endif //HTGS_CHECKPOINTGATE_HPP
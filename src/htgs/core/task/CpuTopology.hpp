@@ -0,0 +1,267 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file CpuTopology.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Describes which CPUs share caches, and binds threads to CPUs
+ */
+#ifndef HTGS_CPUTOPOLOGY_HPP
+#define HTGS_CPUTOPOLOGY_HPP
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace htgs {
+/**
+ * @class CpuTopology CpuTopology.hpp <htgs/core/task/CpuTopology.hpp>
+ * @brief Describes the CPUs of the machine grouped by the caches they share.
+ *
+ * @details
+ * The CPUs are grouped into cache domains, which share a last level cache (L3, or the socket if there is no L3).
+ * Each cache domain is split into core groups, which share an L2 cache (usually the hardware threads of a core).
+ *
+ * On Linux the topology is read from /sys/devices/system/cpu, limited to the CPUs in the affinity mask of the calling
+ * thread (see getAllowedCpus). On other systems, or if sysfs is not available, every
+ * hardware thread is placed in its own core group within a single cache domain.
+ */
+class CpuTopology {
+ public:
+  /**
+   * Creates a topology from an explicit description
+   * @param cacheDomains the cache domains, each a list of core groups, each a list of CPU ids
+   */
+  CpuTopology(std::vector<std::vector<std::vector<int>>> cacheDomains) : cacheDomains(cacheDomains) {}
+
+  /**
+   * Detects the topology of the machine
+   * @return the topology of the machine
+   */
+  static CpuTopology detect() {
+    std::vector<int> cpus = parseCpuList(readLine("/sys/devices/system/cpu/online"));
+
+    // Only the CPUs in the affinity mask of the process, such as set by taskset or a container, can be used
+    std::vector<int> allowedCpus = getAllowedCpus();
+    if (!allowedCpus.empty())
+      cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [&](int cpu) {
+        return std::find(allowedCpus.begin(), allowedCpus.end(), cpu) == allowedCpus.end();
+      }), cpus.end());
+
+    std::map<std::string, std::map<std::string, std::vector<int>>> domains;
+    for (int cpu : cpus) {
+      std::string path = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+      std::string l2, l3;
+      for (int index = 0; index < 8; index++) {
+        std::string cachePath = path + "/cache/index" + std::to_string(index);
+        std::string level = readLine(cachePath + "/level");
+        if (level.empty())
+          break;
+        if (level == "2")
+          l2 = readLine(cachePath + "/shared_cpu_list");
+        else if (level == "3")
+          l3 = readLine(cachePath + "/shared_cpu_list");
+      }
+
+      if (l3.empty())
+        l3 = "package" + readLine(path + "/topology/physical_package_id");
+      if (l2.empty())
+        l2 = readLine(path + "/topology/thread_siblings_list");
+      if (l2.empty())
+        l2 = std::to_string(cpu);
+
+      domains[l3][l2].push_back(cpu);
+    }
+
+    std::vector<std::vector<std::vector<int>>> cacheDomains;
+    for (auto &domain : domains) {
+      std::vector<std::vector<int>> coreGroups;
+      for (auto &coreGroup : domain.second)
+        coreGroups.push_back(coreGroup.second);
+      cacheDomains.push_back(coreGroups);
+    }
+
+    if (cacheDomains.empty()) {
+      std::vector<std::vector<int>> coreGroups;
+      if (allowedCpus.empty()) {
+        unsigned int numCpus = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int cpu = 0; cpu < numCpus; cpu++)
+          allowedCpus.push_back((int) cpu);
+      }
+      for (int cpu : allowedCpus)
+        coreGroups.push_back(std::vector<int>(1, cpu));
+      cacheDomains.push_back(coreGroups);
+    }
+
+    return CpuTopology(cacheDomains);
+  }
+
+  /**
+   * Gets the cache domains, each a list of core groups, each a list of CPU ids
+   * @return the cache domains
+   */
+  const std::vector<std::vector<std::vector<int>>> &getCacheDomains() const { return cacheDomains; }
+
+  /**
+   * Gets the CPUs of a cache domain, ordered so that CPUs sharing an L2 cache are adjacent
+   * @param domain the index of the cache domain
+   * @return the CPUs of the cache domain
+   */
+  std::vector<int> getDomainCpus(size_t domain) const {
+    std::vector<int> cpus;
+    for (auto &coreGroup : cacheDomains[domain])
+      cpus.insert(cpus.end(), coreGroup.begin(), coreGroup.end());
+    return cpus;
+  }
+
+  /**
+   * Gets the total number of CPUs
+   * @return the number of CPUs
+   */
+  size_t getNumCpus() const {
+    size_t numCpus = 0;
+    for (size_t domain = 0; domain < cacheDomains.size(); domain++)
+      numCpus += getDomainCpus(domain).size();
+    return numCpus;
+  }
+
+  /**
+   * Gets the cache domain and core group of a CPU
+   * @param cpu the CPU id
+   * @param domain the index of the cache domain that contains the CPU
+   * @param coreGroup the index of the core group within the cache domain that contains the CPU
+   * @return whether the CPU is part of the topology
+   * @note If the CPU is not part of the topology, then domain and coreGroup are set to 0
+   */
+  bool findCpu(int cpu, size_t &domain, size_t &coreGroup) const {
+    for (size_t d = 0; d < cacheDomains.size(); d++)
+      for (size_t g = 0; g < cacheDomains[d].size(); g++) {
+        auto &cpus = cacheDomains[d][g];
+        if (std::find(cpus.begin(), cpus.end(), cpu) != cpus.end()) {
+          domain = d;
+          coreGroup = g;
+          return true;
+        }
+      }
+
+    domain = 0;
+    coreGroup = 0;
+    return false;
+  }
+
+  /**
+   * Binds the calling thread to a CPU
+   * @param cpu the CPU id, or -1 to restore the affinity the thread had before it was first bound
+   * @return whether the thread was bound
+   * @note Only supported on Linux, on other systems no binding is done
+   */
+  static bool bindThread(int cpu) {
+#ifdef __linux__
+    OriginalAffinity &original = getOriginalAffinity();
+    if (cpu < 0)
+      return !original.saved || pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &original.cpuSet) == 0;
+
+    if (!original.saved) {
+      if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &original.cpuSet) != 0)
+        return false;
+      original.saved = true;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(cpu, &cpuSet);
+    return pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0;
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Gets the CPUs that the calling thread may run on, prior to being bound with bindThread
+   * @return the CPU ids, or an empty list if the affinity cannot be read
+   * @note Only supported on Linux, on other systems the list is empty
+   */
+  static std::vector<int> getAllowedCpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    OriginalAffinity &original = getOriginalAffinity();
+    cpu_set_t cpuSet;
+    if (original.saved)
+      cpuSet = original.cpuSet;
+    else if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0)
+      return cpus;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+      if (CPU_ISSET(cpu, &cpuSet))
+        cpus.push_back(cpu);
+#endif
+    return cpus;
+  }
+
+  /**
+   * Parses a Linux CPU list, such as "0-3,8,10-11"
+   * @param list the CPU list
+   * @return the CPU ids
+   */
+  static std::vector<int> parseCpuList(std::string list) {
+    std::vector<int> cpus;
+    std::stringstream stream(list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+      if (range.empty())
+        continue;
+      size_t dash = range.find('-');
+      int first = std::stoi(range.substr(0, dash));
+      int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; cpu++)
+        cpus.push_back(cpu);
+    }
+    return cpus;
+  }
+
+ private:
+  /**
+   * Reads the first line of a file
+   * @param path the path to the file
+   * @return the first line, or an empty string if the file cannot be read
+   */
+  static std::string readLine(std::string path) {
+    std::ifstream file(path);
+    std::string line;
+    if (file.good())
+      std::getline(file, line);
+    return line;
+  }
+
+#ifdef __linux__
+  //! @cond Doxygen_Suppress
+  struct OriginalAffinity {
+    bool saved = false;
+    cpu_set_t cpuSet;
+  };
+
+  static OriginalAffinity &getOriginalAffinity() {
+    static thread_local OriginalAffinity original;
+    return original;
+  }
+  //! @endcond
+#endif
+
+  std::vector<std::vector<std::vector<int>>> cacheDomains; //!< The cache domains, each a list of core groups, each a list of CPU ids
+};
+}
+
+#endif //HTGS_CPUTOPOLOGY_HPP
@@ -0,0 +1,127 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file SdfStage.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the SdfStage, which executes an ITask within a statically scheduled region.
+ */
+#ifndef HTGS_SDFSTAGE_HPP
+#define HTGS_SDFSTAGE_HPP
+
+#include <vector>
+#include <htgs/api/ITask.hpp>
+#include <htgs/core/task/AnySdfStage.hpp>
+
+namespace htgs {
+
+/**
+ * @class SdfStage SdfStage.hpp <htgs/core/task/SdfStage.hpp>
+ * @brief Executes an ITask within a statically scheduled region (see SdfTask).
+ * @details
+ * The ITask is bound to a TaskManager that is never attached to a thread or connectors. Instead, the TaskManager
+ * adds the results of the ITask to the stage's output buffer, which is preallocated based on the production rate
+ * declared for the ITask.
+ *
+ * @tparam T the input data type for the ITask, T must derive from IData.
+ * @tparam U the output data type for the ITask, U must derive from IData.
+ * @note This class should only be called by the HTGS API
+ */
+template<class T, class U>
+class SdfStage : public AnySdfStage {
+  static_assert(std::is_base_of<IData, T>::value, "T must derive from IData");
+  static_assert(std::is_base_of<IData, U>::value, "U must derive from IData");
+
+ public:
+  /**
+   * Constructs a stage for an ITask
+   * @param task the ITask, which is deleted by the stage
+   * @param pipelineId the pipeline id
+   * @param numPipelines the number of pipelines
+   * @param address the address of the task graph that owns the stage
+   */
+  SdfStage(ITask<T, U> *task, size_t pipelineId, size_t numPipelines, std::string address) : task(task) {
+    taskManager = new TaskManager<T, U>(task, 1, false, pipelineId, numPipelines, address);
+    taskManager->setResultBuffer(&outputs);
+  }
+
+  /**
+   * Destructor, deletes the TaskManager and its ITask
+   */
+  ~SdfStage() override {
+    delete taskManager;
+    taskManager = nullptr;
+  }
+
+  void initialize() override {
+    taskManager->initialize();
+  }
+
+  void fire(std::shared_ptr<IData> data) override {
+    taskManager->executeStatic(std::static_pointer_cast<T>(data));
+  }
+
+  void fireFinal() override {
+    taskManager->executeStatic(nullptr);
+  }
+
+  void shutdown() override {
+    taskManager->shutdown();
+  }
+
+  size_t getNumOutputs() const override {
+    return outputs.size();
+  }
+
+  std::shared_ptr<IData> getOutput(size_t index) const override {
+    return outputs[index];
+  }
+
+  void clearOutputs() override {
+    outputs.clear();
+  }
+
+  void reserveOutputs(size_t capacity) override {
+    outputs.reserve(capacity);
+  }
+
+  AnySdfStage *copy(size_t pipelineId, size_t numPipelines, std::string address) override {
+    return new SdfStage<T, U>(task->copyITask(false), pipelineId, numPipelines, address);
+  }
+
+  std::string getName() override {
+    return task->getName();
+  }
+
+  std::string inTypeName() override {
+    return task->inTypeName();
+  }
+
+  std::string outTypeName() override {
+    return task->outTypeName();
+  }
+
+  unsigned long long int getComputeTime() override {
+    return taskManager->getComputeTime();
+  }
+
+  /**
+   * Gets the ITask of the stage
+   * @return the ITask
+   */
+  ITask<T, U> *getTask() {
+    return task;
+  }
+
+ private:
+  ITask<T, U> *task; //!< The ITask executed by the stage
+  TaskManager<T, U> *taskManager; //!< The TaskManager that owns the ITask and adds its results to the output buffer
+  std::vector<std::shared_ptr<U>> outputs; //!< The preallocated output buffer
+};
+}
+
+#endif //HTGS_SDFSTAGE_HPP
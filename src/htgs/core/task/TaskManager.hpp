@@ -22,6 +22,9 @@
 
 #include <htgs/core/task/AnyTaskManager.hpp>
 #include <htgs/api/ITask.hpp>
+#include <htgs/api/IDeadlineData.hpp>
+#include <htgs/api/ILineageData.hpp>
+#include <htgs/core/memory/ScratchArena.hpp>
 
 #ifdef USE_NVTX
 #include <nvtx3/nvToolsExt.h>
@@ -75,7 +78,9 @@ class TaskManager : public AnyTaskManager {
               size_t numPipelines,
               std::string address) :
       super(numThreads, isStartTask, pipelineId, numPipelines, address),
-      inputConnector(nullptr), outputConnector(nullptr), taskFunction(taskFunction), runtimeThread(nullptr) {
+      inputConnector(nullptr), outputConnector(nullptr), taskFunction(taskFunction), runtimeThread(nullptr),
+      expireDeadlines(false), expiredConnector(nullptr), currentData(nullptr),
+      heldDemand(false), heldDemandMark(0), resultBuffer(nullptr) {
     taskFunction->setTaskManager(this);
   }
 
@@ -101,7 +106,13 @@ class TaskManager : public AnyTaskManager {
                                                                              inputConnector(nullptr),
                                                                              outputConnector(nullptr),
                                                                              taskFunction(taskFunction),
-                                                                             runtimeThread(nullptr) {
+                                                                             runtimeThread(nullptr),
+                                                                             expireDeadlines(false),
+                                                                             expiredConnector(nullptr),
+                                                                             currentData(nullptr),
+                                                                             heldDemand(false),
+                                                                             heldDemandMark(0),
+                                                                             resultBuffer(nullptr) {
     taskFunction->setTaskManager(this);
   }
 
@@ -134,7 +145,14 @@ class TaskManager : public AnyTaskManager {
     nvtxRangeId_t rangeId = this->getProfiler()->startRangeInitializing();
 #endif
 
+#ifdef USE_FLIGHT_RECORDER
+    this->setFlightRecorderId(FlightRecorder::registerName(
+        this->getName() + " (pipeline " + std::to_string(this->getPipelineId()) + ", thread "
+            + std::to_string(this->getThreadId()) + ")"));
+#endif
+
     this->taskFunction->initialize(this->getPipelineId(), this->getNumPipelines(), this);
+    this->startPollTimer();
 
 #ifdef USE_NVTX
     this->getProfiler()->endRangeInitializing(rangeId);
@@ -159,6 +177,7 @@ class TaskManager : public AnyTaskManager {
     if (deep) {
       newTask->setInputConnector(this->getInputConnector());
       newTask->setOutputConnector(this->getOutputConnector());
+      newTask->setDeadlineExpiry(this->expireDeadlines, this->expiredConnector);
     }
     return (AnyTaskManager *) newTask;
   }
@@ -183,7 +202,14 @@ class TaskManager : public AnyTaskManager {
 #ifdef USE_NVTX
       rangeId = this->getProfiler()->startRangeExecuting();
 #endif
+      this->acquireResources();
+      this->acquireFairShare();
+      HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::ExecuteStart, 0);
       this->taskFunction->executeTask(nullptr);
+      this->scratchArena.reset();
+      HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::ExecuteEnd, 0);
+      this->releaseFairShare();
+      this->releaseResources();
 
 #ifdef USE_NVTX
       this->getProfiler()->endRangeExecuting(rangeId);
@@ -205,6 +231,12 @@ class TaskManager : public AnyTaskManager {
 
       return;
     }
+
+    if (this->outputConnector != nullptr && this->outputConnector->isDemandDriven() && !this->isPoll())
+      this->pullDemand();
+
+    this->enterCheckpointGate();
+
 #ifdef PROFILE
     auto start = std::chrono::high_resolution_clock::now();
 #endif
@@ -217,11 +249,13 @@ class TaskManager : public AnyTaskManager {
     rangeId = this->getProfiler()->startRangeWaiting(this->inputConnector->getQueueSize());
 #endif
 
-    if (this->isPoll())
+    if (this->isPoll() && !this->isPollDrivenByTimer())
       data = this->inputConnector->pollConsumeData(this->getTimeout());
     else
       data = this->inputConnector->consumeData();
 
+    this->endCheckpointGateWait();
+
 #ifdef USE_NVTX
     this->getProfiler()->endRangeWaiting(rangeId);
 #endif
@@ -239,8 +273,23 @@ class TaskManager : public AnyTaskManager {
 #endif
 
     HTGS_DEBUG_VERBOSE(prefix() << this->getName() << " received data: " << data << " from " << inputConnector);
+    HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::Dequeue, data != nullptr ? 1 : 0);
+
+    if (data != nullptr)
+      this->inputConnector->prefetchConsumed(data);
+
+    if (data != nullptr && this->expireDeadlines && this->processExpiredData(data)) {
+      this->exitCheckpointGate();
+      this->releaseDemand();
+      return;
+    }
 
-    if (data != nullptr || this->isPoll()) {
+    // Polling tasks execute with nullptr when the timeout expires, or for each poll tick from the timer wheel
+    bool pollTimeout = data == nullptr && this->isPoll() && !this->isPollDrivenByTimer();
+    if (data == nullptr && this->processExpiredTimers())
+      pollTimeout = true;
+
+    if (data != nullptr || pollTimeout) {
 #ifdef PROFILE
       start = std::chrono::high_resolution_clock::now();
 #endif
@@ -252,7 +301,24 @@ class TaskManager : public AnyTaskManager {
       rangeId = this->getProfiler()->startRangeExecuting();
 #endif
 
+      this->acquireResources();
+      this->acquireFairShare();
+
+      size_t prefetchDepth = this->taskFunction->getPrefetchDepth();
+      if (prefetchDepth > 0) {
+        for (auto next : this->inputConnector->peekDataToPrefetch(prefetchDepth))
+          this->taskFunction->prefetch(next);
+      }
+
+      HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::ExecuteStart, 0);
+      this->currentData = data.get();
       this->taskFunction->executeTask(data);
+      this->currentData = nullptr;
+      this->scratchArena.reset();
+      HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::ExecuteEnd, 0);
+
+      this->releaseFairShare();
+      this->releaseResources();
 
 #ifdef USE_NVTX
       this->getProfiler()->endRangeExecuting(rangeId);
@@ -285,6 +351,8 @@ class TaskManager : public AnyTaskManager {
 
     }
 
+    this->exitCheckpointGate();
+    this->releaseDemand();
   }
 
   size_t getThreadsRemaining() override {
@@ -303,7 +371,7 @@ class TaskManager : public AnyTaskManager {
 #endif
     // Create profile data for this task
     TaskManagerProfile
-        *profileData = new TaskManagerProfile(this->getComputeTime(), this->getWaitTime(), this->getMaxQueueSize(), taskFunction->getMemoryWaitTime());
+        *profileData = new TaskManagerProfile(this->getComputeTime(), this->getWaitTime(), this->getMaxQueueSize(), taskFunction->getMemoryWaitTime(), this->getDeadlineMisses());
     taskManagerProfiles->insert(std::pair<AnyTaskManager *, TaskManagerProfile *>(this, profileData));
 
     // Pass gatherProfileData to ITask for further processing
@@ -335,12 +403,39 @@ class TaskManager : public AnyTaskManager {
   }
 
   /**
-   * Adds the result data to the output connector
+   * Sets whether data that has passed its deadline is expired prior to executing the task.
+   * Only data that derives from IDeadlineData can expire. Expired data is not processed
+   * by the task, and is instead added to the expired connector (if one is specified) or dropped.
+   * @param expireDeadlines whether to expire data that has passed its deadline
+   * @param expiredConnector the connector to send expired data to, or nullptr to drop expired data
+   * @note The expired connector must have its producer count incremented for this task
+   */
+  void setDeadlineExpiry(bool expireDeadlines, std::shared_ptr<AnyConnector> expiredConnector) {
+    this->expireDeadlines = expireDeadlines;
+    if (expiredConnector != nullptr)
+      this->expiredConnector = std::static_pointer_cast<Connector<T>>(expiredConnector);
+    else
+      this->expiredConnector = nullptr;
+  }
+
+  /**
+   * Adds the result data to the output connector.
+   * If the data being processed and the result both derive from ILineageData, then the result inherits the
+   * lineage of the data.
    * @param result the result that is added to the output for this task
    */
   void addResult(std::shared_ptr<U> result) {
+    if (this->currentData != nullptr)
+      propagateLineage(this->currentData, result.get());
+
+    if (this->resultBuffer != nullptr) {
+      this->resultBuffer->push_back(result);
+      return;
+    }
+
     if (this->outputConnector != nullptr) {
       this->outputConnector->produceData(result);
+      this->incrementNumDataProduced();
 #ifdef WS_PROFILE
       if (result != nullptr)
         sendWSProfileUpdate(this->outputConnector.get(), StatusCode::PRODUCE_DATA);
@@ -348,6 +443,107 @@ class TaskManager : public AnyTaskManager {
     }
   }
 
+  /**
+   * Gets the scratch arena of this TaskManager, which is reset each time the task function finishes processing data
+   * @return the scratch arena
+   */
+  ScratchArena *getScratchArena() { return &this->scratchArena; }
+
+  /**
+   * Sets a buffer that receives the results of the task function instead of the output connector.
+   * Used by SdfTask, which passes data between the tasks of a statically scheduled region through preallocated buffers.
+   * @param resultBuffer the buffer, or nullptr to add results to the output connector
+   */
+  void setResultBuffer(std::vector<std::shared_ptr<U>> *resultBuffer) { this->resultBuffer = resultBuffer; }
+
+  /**
+   * Consumes up to count data that is already waiting in the input connector, without blocking.
+   * Used by task functions that forward data in batches, such as the ExecutionPipeline with multiple distributors.
+   * Each data is handled as if it were consumed by this TaskManager: the dequeue is recorded by the flight recorder,
+   * the data is unmarked for prefetching, and data that has passed its deadline is expired instead of returned.
+   * No data is consumed if a checkpoint gate is attached or the output is demand driven, because those admit one
+   * data at a time.
+   * @param count the maximum number of data to consume
+   * @return the consumed data that has not expired
+   * @internal
+   */
+  std::list<std::shared_ptr<T>> consumeAvailableData(size_t count) {
+    std::list<std::shared_ptr<T>> batch;
+    if (count == 0 || this->inputConnector == nullptr || this->getCheckpointGate() != nullptr
+        || (this->outputConnector != nullptr && this->outputConnector->isDemandDriven() && !this->isPoll()))
+      return batch;
+
+    batch = this->inputConnector->consumeAvailableData(count, false);
+    for (auto it = batch.begin(); it != batch.end();) {
+      std::shared_ptr<T> data = *it;
+      if (data == nullptr) {
+        it = batch.erase(it);
+        continue;
+      }
+
+      HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::Dequeue, 1);
+      this->inputConnector->prefetchConsumed(data);
+
+      if (this->expireDeadlines && this->processExpiredData(data))
+        it = batch.erase(it);
+      else
+        ++it;
+    }
+
+    return batch;
+  }
+
+  /**
+   * Executes the task function on data within the calling thread, without consuming from the input connector.
+   * Used by SdfTask to fire the tasks of a statically scheduled region.
+   * @param data the data, or nullptr to execute the task function's executeTaskFinal
+   */
+  void executeStatic(std::shared_ptr<T> data) {
+#ifdef PROFILE
+    auto start = std::chrono::high_resolution_clock::now();
+#endif
+    if (data != nullptr) {
+      this->currentData = data.get();
+      this->taskFunction->executeTask(data);
+      this->currentData = nullptr;
+    } else {
+      this->taskFunction->executeTaskFinal();
+    }
+    this->scratchArena.reset();
+#ifdef PROFILE
+    auto finish = std::chrono::high_resolution_clock::now();
+    this->incTaskComputeTime(std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count());
+#endif
+  }
+
+  /**
+   * Waits until the consumer of the output connector requests data, when the output connector is demand-driven.
+   * If the TaskManager took a demand credit prior to executing the task function and no result has been added yet,
+   * then that credit is used.
+   * @return whether the task should produce another result
+   * @retval TRUE if a result was requested, or the output connector is not demand-driven
+   * @retval FALSE if no more results will be requested
+   */
+  bool waitForDemand() {
+    if (this->outputConnector == nullptr)
+      return true;
+
+    if (this->heldDemand) {
+      this->heldDemand = false;
+      if (this->getNumDataProduced() == this->heldDemandMark)
+        return true;
+    }
+
+    // Demand is requested by consumers, so do not hold a fair share slot or resource slots while waiting
+    this->releaseFairShare();
+    this->releaseResources();
+    bool demand = this->outputConnector->acquireDemand();
+    this->acquireResources();
+    this->acquireFairShare();
+
+    return demand;
+  }
+
   /**
    * Terminates all Connector edges.
    * This is called after all threads have shutdown.
@@ -384,14 +580,71 @@ class TaskManager : public AnyTaskManager {
       if (connector->isInputTerminated())
         connector->wakeupConsumer();
     }
+
+    if (this->expiredConnector != nullptr) {
+      this->expiredConnector->producerFinished();
+      this->expiredConnector->wakeupConsumer();
+    }
   }
 
  private:
 
   //! @cond Doxygen_Suppress
+  bool processExpiredData(std::shared_ptr<T> data) {
+    std::shared_ptr<IDeadlineData> deadlineData = std::dynamic_pointer_cast<IDeadlineData>(data);
+    if (deadlineData == nullptr || !deadlineData->isExpired())
+      return false;
+
+    HTGS_DEBUG_VERBOSE(prefix() << this->getName() << " expired data: " << data);
+    this->incDeadlineMisses();
+
+    if (this->expiredConnector != nullptr)
+      this->expiredConnector->produceData(data);
+
+    return true;
+  }
+
+  // Takes one demand credit from the output connector and forwards it to the input connector, so that one data is
+  // pulled from the producers for each data requested. Once demand is closed, closes demand upstream.
+  void pullDemand() {
+    if (this->outputConnector->acquireDemand()) {
+      this->heldDemand = true;
+      this->heldDemandMark = this->getNumDataProduced();
+      if (this->inputConnector != nullptr)
+        this->inputConnector->requestData(1);
+    } else if (this->inputConnector != nullptr) {
+      this->inputConnector->closeDemand();
+    }
+  }
+
+  // Returns the demand credit if the task did not produce a result for it (such as a filter)
+  void releaseDemand() {
+    if (!this->heldDemand)
+      return;
+
+    this->heldDemand = false;
+    if (this->getNumDataProduced() == this->heldDemandMark)
+      this->outputConnector->returnDemand();
+  }
+
+  bool processExpiredTimers() {
+    for (uint64_t timerId : this->inputConnector->takeExpiredTimers()) {
+      this->acquireResources();
+      this->acquireFairShare();
+      this->taskFunction->executeTimer(timerId);
+      this->scratchArena.reset();
+      this->releaseFairShare();
+      this->releaseResources();
+    }
+
+    return this->isPollDrivenByTimer() && this->inputConnector->takePollTick();
+  }
+
   void processTaskFunctionTerminated() {
     // Task is now terminated, so it is no longer alive
     this->setAlive(false);
+    this->stopTimers();
+    HTGS_FLIGHT_RECORD(this->getFlightRecorderId(), FlightEventType::Terminate, 0);
 
     // Wake up the threads for this task
     if (this->getInputConnector() != nullptr)
@@ -413,7 +666,12 @@ class TaskManager : public AnyTaskManager {
 #ifdef USE_NVTX
         nvtxRangeId_t rangeId = this->getProfiler()->startRangeExecuting();
 #endif
+        this->acquireResources();
+        this->acquireFairShare();
         this->taskFunction->executeTaskFinal();
+        this->scratchArena.reset();
+        this->releaseFairShare();
+        this->releaseResources();
 
 #ifdef USE_NVTX
         this->getProfiler()->endRangeExecuting(rangeId);
@@ -485,6 +743,13 @@ class TaskManager : public AnyTaskManager {
   std::shared_ptr<Connector<U>> outputConnector; //!< The output connector for the manager (queue to send data)
   ITask<T, U> *taskFunction; //!< The task that is managed by the manager
   TaskManagerThread *runtimeThread; //!< The thread that is executing this task's runtime
+  bool expireDeadlines; //!< Whether data that has passed its deadline is expired instead of processed
+  std::shared_ptr<Connector<T>> expiredConnector; //!< The connector that receives expired data (nullptr drops expired data)
+  T *currentData; //!< The data being processed by the task function, which results inherit lineage from (nullptr if none)
+  bool heldDemand; //!< Whether a demand credit was taken from the output connector for the current execution
+  size_t heldDemandMark; //!< The number of data produced when the held demand credit was taken
+  std::vector<std::shared_ptr<U>> *resultBuffer; //!< The buffer receiving results instead of the output connector (nullptr if none)
+  ScratchArena scratchArena; //!< The arena for memory that is only used while the task function processes one data
 };
 }
 
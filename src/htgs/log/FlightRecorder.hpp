@@ -0,0 +1,315 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file FlightRecorder.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Implements the FlightRecorder, which keeps a fixed-size ring of recent runtime events for each thread.
+ */
+#ifndef HTGS_FLIGHTRECORDER_HPP
+#define HTGS_FLIGHTRECORDER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @def HTGS_FLIGHT_RECORDER_SIZE
+ * @brief The number of events kept for each thread by the flight recorder
+ */
+#ifndef HTGS_FLIGHT_RECORDER_SIZE
+#define HTGS_FLIGHT_RECORDER_SIZE 4096
+#endif
+
+/**
+ * @def HTGS_FLIGHT_RECORD(nameId, type, value)
+ * @brief Records an event into the calling thread's flight recorder ring
+ * @note Must define the directive USE_FLIGHT_RECORDER to enable the flight recorder, otherwise this macro does nothing
+ */
+#ifdef USE_FLIGHT_RECORDER
+#define HTGS_FLIGHT_RECORD(nameId, type, value) htgs::FlightRecorder::record(nameId, type, value)
+#else
+#define HTGS_FLIGHT_RECORD(nameId, type, value) do { } while (false)
+#endif
+
+namespace htgs {
+
+/**
+ * @enum FlightEventType
+ * @brief The runtime events that are recorded by the FlightRecorder
+ */
+enum class FlightEventType : uint8_t {
+  Dequeue, //!< A task consumed from its input connector (value is 1 if data was received, 0 otherwise)
+  ExecuteStart, //!< A task started executing
+  ExecuteEnd, //!< A task finished executing
+  MemoryWaitStart, //!< A task started waiting for memory from a memory edge
+  MemoryWaitEnd, //!< A task received memory from a memory edge
+  MemoryRelease, //!< Memory was released back to its memory manager (the name is of the task that acquired the memory)
+  RuleOutput, //!< A rule produced data (value is the number of data produced)
+  Terminate, //!< A task thread was terminated
+};
+
+/**
+ * @struct FlightEvent FlightRecorder.hpp <htgs/log/FlightRecorder.hpp>
+ * @brief A single event in a flight recorder ring
+ */
+struct FlightEvent {
+  uint64_t timestamp; //!< The time of the event in nanoseconds since the flight recorder started
+  uint64_t value; //!< Event specific value
+  uint32_t nameId; //!< The name id of the task or rule, see FlightRecorder::registerName
+  FlightEventType type; //!< The type of event
+};
+
+/**
+ * @class FlightRecorderRing FlightRecorder.hpp <htgs/log/FlightRecorder.hpp>
+ * @brief A fixed-size ring of events that is written by a single thread.
+ *
+ * Once the ring is full, the oldest events are overwritten.
+ */
+class FlightRecorderRing {
+ public:
+  /**
+   * Constructs a ring for a thread
+   * @param threadId the thread that writes into the ring
+   */
+  FlightRecorderRing(std::thread::id threadId) : threadId(threadId), inUse(true), head(0) {}
+
+  /**
+   * Records an event. Must only be called by the thread that owns the ring.
+   * @param timestamp the time of the event
+   * @param nameId the name id of the task or rule
+   * @param type the type of event
+   * @param value event specific value
+   */
+  void record(uint64_t timestamp, uint32_t nameId, FlightEventType type, uint64_t value) {
+    size_t h = this->head.load(std::memory_order_relaxed);
+    FlightEvent &event = this->events[h % HTGS_FLIGHT_RECORDER_SIZE];
+    event.timestamp = timestamp;
+    event.value = value;
+    event.nameId = nameId;
+    event.type = type;
+    this->head.store(h + 1, std::memory_order_release);
+  }
+
+  /**
+   * Writes the events in the ring from oldest to newest
+   * @param os the output stream
+   * @param names the names for each name id
+   */
+  void write(std::ostream &os, const std::vector<std::string> &names) const {
+    size_t h = this->head.load(std::memory_order_acquire);
+    size_t count = h < HTGS_FLIGHT_RECORDER_SIZE ? h : HTGS_FLIGHT_RECORDER_SIZE;
+
+    os << "thread " << threadId << (inUse ? "" : " (exited)") << " events: " << count
+       << " overwritten: " << (h - count) << std::endl;
+
+    for (size_t i = h - count; i < h; i++) {
+      const FlightEvent &event = this->events[i % HTGS_FLIGHT_RECORDER_SIZE];
+      os << "  " << event.timestamp / 1000 << " us " << eventTypeName(event.type) << " "
+         << (event.nameId < names.size() ? names[event.nameId] : "<unknown>") << " " << event.value << std::endl;
+    }
+  }
+
+  /**
+   * Gets the name of an event type
+   * @param type the event type
+   * @return the name of the event type
+   */
+  static const char *eventTypeName(FlightEventType type) {
+    switch (type) {
+      case FlightEventType::Dequeue: return "Dequeue";
+      case FlightEventType::ExecuteStart: return "ExecuteStart";
+      case FlightEventType::ExecuteEnd: return "ExecuteEnd";
+      case FlightEventType::MemoryWaitStart: return "MemoryWaitStart";
+      case FlightEventType::MemoryWaitEnd: return "MemoryWaitEnd";
+      case FlightEventType::MemoryRelease: return "MemoryRelease";
+      case FlightEventType::RuleOutput: return "RuleOutput";
+      case FlightEventType::Terminate: return "Terminate";
+    }
+    return "Unknown";
+  }
+
+ private:
+  friend class FlightRecorder;
+
+  std::thread::id threadId; //!< The thread that writes into the ring
+  std::atomic<bool> inUse; //!< Whether the thread is still alive, rings of exited threads are reused by new threads
+  std::atomic<size_t> head; //!< The total number of events recorded
+  FlightEvent events[HTGS_FLIGHT_RECORDER_SIZE]; //!< The events
+};
+
+/**
+ * @class FlightRecorder FlightRecorder.hpp <htgs/log/FlightRecorder.hpp>
+ * @brief Records recent runtime events for each thread so that slowdowns and hangs can be diagnosed after the fact.
+ *
+ * @details
+ * Each thread that records an event is given a FlightRecorderRing that holds the last HTGS_FLIGHT_RECORDER_SIZE
+ * events. Recording an event is lock-free and does not allocate, so the recorder can be left enabled in production.
+ * When a thread exits, its ring is kept, so the events of finished threads remain available until the ring is cleared
+ * and reused by the next new thread.
+ *
+ * The TaskManager records dequeue, execute start/end, memory wait, memory release, and termination events, and the
+ * RuleManager records rule outputs. The events are written to a trace file with dumpToFile. The TaskGraphSignalHandler
+ * dumps the trace when a signal is caught, and installCrashHandlers dumps the trace on abort or crash.
+ *
+ * Example usage:
+ * @code
+ * // Compile with -DUSE_FLIGHT_RECORDER
+ * int main() {
+ *   htgs::FlightRecorder::installCrashHandlers("my-graph.trace");
+ *   ...
+ * }
+ * @endcode
+ *
+ * @note Must define the directive USE_FLIGHT_RECORDER to enable recording events.
+ * @note Dumping is best effort: it is done from within a signal handler and does not wait for threads that are recording.
+ */
+class FlightRecorder {
+ public:
+  /**
+   * Records an event into the calling thread's ring
+   * @param nameId the name id of the task or rule, see registerName
+   * @param type the type of event
+   * @param value event specific value
+   */
+  static void record(uint32_t nameId, FlightEventType type, uint64_t value = 0) {
+    uint64_t timestamp = (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - getStartTime()).count();
+    getThreadRing()->record(timestamp, nameId, type, value);
+  }
+
+  /**
+   * Registers a name for a task or rule. Name ids are stored in events instead of names to keep recording cheap.
+   * @param name the name
+   * @return the name id
+   */
+  static uint32_t registerName(const std::string &name) {
+    std::unique_lock<std::mutex> lock(getMutex());
+    std::vector<std::string> &names = getNames();
+    names.push_back(name);
+    return (uint32_t) (names.size() - 1);
+  }
+
+  /**
+   * Writes the events for all threads to a stream
+   * @param os the output stream
+   */
+  static void dump(std::ostream &os) {
+    // Best effort, the lock may be held by a thread that crashed
+    bool locked = getMutex().try_lock();
+
+    os << "# HTGS flight recorder trace (time since start, event, task, value)" << std::endl;
+    for (FlightRecorderRing *ring : getRings())
+      ring->write(os, getNames());
+
+    if (locked)
+      getMutex().unlock();
+  }
+
+  /**
+   * Writes the events for all threads to a trace file
+   * @param fileName the name of the trace file
+   * @return whether the file was written
+   */
+  static bool dumpToFile(const std::string &fileName) {
+    std::ofstream file(fileName);
+    if (!file.good())
+      return false;
+
+    dump(file);
+    return file.good();
+  }
+
+  /**
+   * Installs signal handlers for SIGABRT, SIGSEGV, SIGBUS, SIGFPE, and SIGILL that dump the trace to a file,
+   * and then raise the signal again with the default handler.
+   * @param fileName the name of the trace file
+   */
+  static void installCrashHandlers(std::string fileName = "htgs-flight-recorder.trace") {
+    getCrashFileName() = fileName;
+    std::signal(SIGABRT, FlightRecorder::handleCrash);
+    std::signal(SIGSEGV, FlightRecorder::handleCrash);
+    std::signal(SIGFPE, FlightRecorder::handleCrash);
+    std::signal(SIGILL, FlightRecorder::handleCrash);
+#ifdef SIGBUS
+    std::signal(SIGBUS, FlightRecorder::handleCrash);
+#endif
+  }
+
+ private:
+  //! @cond Doxygen_Suppress
+  struct RingHolder {
+    FlightRecorderRing *ring;
+    RingHolder() : ring(acquireRing()) {}
+    ~RingHolder() { ring->inUse = false; }
+  };
+
+  static FlightRecorderRing *getThreadRing() {
+    static thread_local RingHolder holder;
+    return holder.ring;
+  }
+
+  static FlightRecorderRing *acquireRing() {
+    std::unique_lock<std::mutex> lock(getMutex());
+    for (FlightRecorderRing *ring : getRings()) {
+      if (!ring->inUse) {
+        // The events of the exited thread are cleared, so that they are not reported as events of the new thread
+        ring->head.store(0, std::memory_order_release);
+        ring->threadId = std::this_thread::get_id();
+        ring->inUse = true;
+        return ring;
+      }
+    }
+
+    FlightRecorderRing *ring = new FlightRecorderRing(std::this_thread::get_id());
+    getRings().push_back(ring);
+    return ring;
+  }
+
+  static void handleCrash(int signum) {
+    dumpToFile(getCrashFileName());
+    std::signal(signum, SIG_DFL);
+    std::raise(signum);
+  }
+
+  static std::chrono::steady_clock::time_point getStartTime() {
+    static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+    return startTime;
+  }
+
+  static std::mutex &getMutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  // Rings are never freed, so that they can be dumped at any time
+  static std::vector<FlightRecorderRing *> &getRings() {
+    static std::vector<FlightRecorderRing *> *rings = new std::vector<FlightRecorderRing *>();
+    return *rings;
+  }
+
+  static std::vector<std::string> &getNames() {
+    static std::vector<std::string> *names = new std::vector<std::string>(1, "<unregistered>");
+    return *names;
+  }
+
+  static std::string &getCrashFileName() {
+    static std::string *crashFileName = new std::string("htgs-flight-recorder.trace");
+    return *crashFileName;
+  }
+  //! @endcond
+};
+}
+
+#endif //HTGS_FLIGHTRECORDER_HPP
@@ -18,6 +18,8 @@
 #define HTGS_TASKGRAPHSIGNALHANDLER_HPP
 
 #include <htgs/core/graph/AnyTaskGraphConf.hpp>
+#include <htgs/log/FlightRecorder.hpp>
+#include <htgs/core/memory/MemoryOwnershipTracker.hpp>
 #include <csignal>
 #include <vector>
 #include <cstring>
@@ -27,6 +29,10 @@ namespace htgs {
  * @brief Implements a signal handler to catch events such as termination and killing of the process. Once a signal
  * is caught, all task graphs that are registered with the signal handler will be written as a dot file. The dot file
  * is output in the working directory with the name of the signal as a prefix and '<#>-graph-output.dot' as the suffix.
+ * If the directive USE_FLIGHT_RECORDER is defined, then the recent runtime events of every thread are also written
+ * to a trace file with the name of the signal as a prefix and '-flight-recorder.trace' as the suffix (see FlightRecorder).
+ * If memory ownership tracking is enabled, then the memory held by each task is written to a report with the name of
+ * the signal as a prefix and '-memory-ownership.txt' as the suffix (see MemoryOwnershipTracker).
  *
  * Example usage:
  * @code
@@ -73,6 +79,13 @@ class TaskGraphSignalHandler {
                                      DOTGEN_FLAG_SHOW_CONNECTOR_VERBOSE | DOTGEN_FLAG_SHOW_TASK_LIVING_STATUS);
       }
 
+#ifdef USE_FLIGHT_RECORDER
+      FlightRecorder::dumpToFile(signalString + "-flight-recorder.trace");
+#endif
+
+      if (MemoryOwnershipTracker::isEnabled())
+        MemoryOwnershipTracker::dumpAllReportsToFile(signalString + "-memory-ownership.txt");
+
       exit(signum);
     }
   }
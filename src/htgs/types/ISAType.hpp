@@ -0,0 +1,78 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file ISAType.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Defines the instruction set architecture types ISAType used to select task variants.
+ */
+#ifndef HTGS_ISATYPE_HPP
+#define HTGS_ISATYPE_HPP
+
+#include <string>
+
+namespace htgs {
+/**
+ * @enum ISAType
+ * @brief The instruction set architectures that a task variant can be compiled for.
+ * @details
+ * The ISATypes are ordered from least to most capable. When selecting among multiple variants of a task,
+ * the most capable ISAType that is supported by the CPU is chosen.
+ *
+ * ISAType::Scalar is always supported.
+ */
+enum class ISAType {
+  Scalar, //!< No vector extensions required
+  SSE42, //!< Requires SSE 4.2
+  AVX, //!< Requires AVX
+  AVX2, //!< Requires AVX2 and FMA
+  AVX512, //!< Requires AVX-512 foundation instructions
+};
+
+/**
+ * Gets whether the CPU executing the program supports an ISAType.
+ * Uses CPUID through the compiler builtins, on compilers/architectures without support only ISAType::Scalar is
+ * supported.
+ * @param isa the ISAType
+ * @return whether the ISAType is supported
+ * @retval TRUE if the CPU supports the ISAType
+ * @retval FALSE if the CPU does not support the ISAType
+ */
+inline bool isISASupported(ISAType isa) {
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  switch (isa) {
+    case ISAType::Scalar:return true;
+    case ISAType::SSE42:return __builtin_cpu_supports("sse4.2") != 0;
+    case ISAType::AVX:return __builtin_cpu_supports("avx") != 0;
+    case ISAType::AVX2:return __builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("fma") != 0;
+    case ISAType::AVX512:return __builtin_cpu_supports("avx512f") != 0;
+  }
+  return false;
+#else
+  return isa == ISAType::Scalar;
+#endif
+}
+
+/**
+ * Gets the name of an ISAType
+ * @param isa the ISAType
+ * @return the name of the ISAType
+ */
+inline std::string isaTypeName(ISAType isa) {
+  switch (isa) {
+    case ISAType::Scalar:return "scalar";
+    case ISAType::SSE42:return "SSE4.2";
+    case ISAType::AVX:return "AVX";
+    case ISAType::AVX2:return "AVX2";
+    case ISAType::AVX512:return "AVX-512";
+  }
+  return "unknown";
+}
+}
+
+#endif //HTGS_ISATYPE_HPP
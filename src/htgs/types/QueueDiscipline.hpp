@@ -0,0 +1,52 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+/**
+ * @file QueueDiscipline.hpp
+ * @author Timothy Blattner
+ * @date Oct 18, 2026
+ *
+ * @brief Defines the queue disciplines QueueDiscipline used by connectors.
+ */
+#ifndef HTGS_QUEUEDISCIPLINE_HPP
+#define HTGS_QUEUEDISCIPLINE_HPP
+
+namespace htgs {
+/**
+ * @enum QueueDiscipline
+ * @brief The order in which a Connector hands data to its consumers.
+ * @details
+ * QueueDiscipline::FIFO
+ * Data is consumed in the order that it was produced. This is the default for all connectors.
+ *
+ * QueueDiscipline::Priority
+ * Data is consumed based on IData::compare, regardless of whether the USE_PRIORITY_QUEUE directive is defined.
+ * For IDeadlineData, this is earliest deadline first.
+ *
+ * QueueDiscipline::LIFO
+ * The most recently produced data is consumed first. Processing data depth first keeps recently produced data in
+ * cache and bounds the amount of data in flight, but data that is produced early may wait until the producer stops.
+ *
+ * QueueDiscipline::BoundedLIFO
+ * The most recently produced data is consumed first, except that after HTGS_DEFAULT_LIFO_BOUND (or the bound given to
+ * the edge) consecutive data have been consumed ahead of the oldest data, the oldest data is consumed, so no data
+ * waits indefinitely.
+ *
+ * @note If the USE_PRIORITY_QUEUE directive is defined, then all connectors use priority ordering.
+ */
+enum class QueueDiscipline {
+  FIFO, //!< First in first out
+  Priority, //!< Ordered by IData::compare
+  LIFO, //!< Last in first out
+  BoundedLIFO, //!< Last in first out, with the oldest data consumed after a bounded number of newer data
+};
+
+/**
+ * The default number of data that are consumed ahead of the oldest data with QueueDiscipline::BoundedLIFO
+ */
+#define HTGS_DEFAULT_LIFO_BOUND 16
+}
+
+#endif //HTGS_QUEUEDISCIPLINE_HPP
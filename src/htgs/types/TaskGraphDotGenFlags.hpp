@@ -103,4 +103,16 @@
  */
 #define DOTGEN_FLAG_SHOW_CONNECTORS 1 << 14
 
+/**
+ * @def DOTGEN_FLAG_HIDE_DEADLINE_MISSES
+ * @brief Hides the number of data that expired prior to being processed by a task
+ */
+#define DOTGEN_FLAG_HIDE_DEADLINE_MISSES 1 << 15
+
+/**
+ * @def DOTGEN_FLAG_HIDE_RULE_PROFILE
+ * @brief Hides the per-rule profile (invocations, apply time, lock wait time, emission ratio) of bookkeepers
+ */
+#define DOTGEN_FLAG_HIDE_RULE_PROFILE 1 << 16
+
 #endif //HTGS_TASKGRAPHDOTGENFLAGS_HPP
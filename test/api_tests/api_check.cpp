@@ -14,6 +14,27 @@
 #include "memMultiReleaseGraphTests.h"
 #include "memReleaseOutsideGraphTests.h"
 #include "recursiveGraphsTests.h"
+#include "prefetchGraphTests.h"
+#include "multiVersionGraphTests.h"
+#include "flightRecorderGraphTests.h"
+#include "deadlineGraphTests.h"
+#include "fairShareGraphTests.h"
+#include "checkpointGraphTests.h"
+#include "copyOnWriteGraphTests.h"
+#include "timerWheelGraphTests.h"
+#include "windowGraphTests.h"
+#include "spscGraphTests.h"
+#include "placementGraphTests.h"
+#include "memOwnershipGraphTests.h"
+#include "incrementalGraphTests.h"
+#include "pullGraphTests.h"
+#include "epShardedGraphTests.h"
+#include "epLanesGraphTests.h"
+#include "objectPoolGraphTests.h"
+#include "scratchGraphTests.h"
+#include "sdfGraphTests.h"
+#include "tuningGraphTests.h"
+#include "resourceGraphTests.h"
 
 #include "bkRuleAsOutputTests.h"
 
@@ -73,6 +94,18 @@ TEST(MatMulGraph, GraphExecution) {
   EXPECT_NO_FATAL_FAILURE(matMulGraphExecution(64, 8, 5, 100.0));
 }
 
+TEST(MatMulGraph, QueueDisciplineOrdering) {
+  EXPECT_NO_FATAL_FAILURE(queueDisciplineOrdering());
+}
+
+TEST(MatMulGraph, QueueDiscipline) {
+  EXPECT_NO_FATAL_FAILURE(matMulQueueDiscipline(64, 8, 4, 2.0));
+}
+
+TEST(MatMulGraph, RuleProfile) {
+  EXPECT_NO_FATAL_FAILURE(matMulRuleProfile(64, 8, 4, 2.0));
+}
+
 TEST(MemMultiRelease, GraphCreationStatic) {
   EXPECT_NO_FATAL_FAILURE(multiReleaseGraphCreation(false, false, htgs::MMType::Static));
 }
@@ -208,6 +241,286 @@ TEST(MemMultiRelease, GraphExecutionDynamicWithAdditionalGraphMemoryEdge) {
   EXPECT_NO_FATAL_FAILURE(multiReleaseGraphExecution(100, 10, 5, true, true, htgs::MMType::Dynamic));
 }
 
+TEST(MemMultiRelease, GraphExecutionStaticWithSharedMemoryEdge) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(1, 1, 1, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 2, 2, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 10, 3, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 2, 5, htgs::MMType::Static));
+}
+
+TEST(MemMultiRelease, GraphExecutionDynamicWithSharedMemoryEdge) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(1, 1, 1, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 2, 2, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 10, 3, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedGraphExecution(100, 2, 5, htgs::MMType::Dynamic));
+}
+
+TEST(MemMultiRelease, GraphExecutionSkewedWithSharedMemoryEdge) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedSkewedGraphExecution(20, 3, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedSkewedGraphExecution(20, 3, htgs::MMType::Dynamic));
+}
+
+TEST(MemMultiRelease, GraphExecutionStaticWithMemoryBatch) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(1, 1, 1, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 2, 1, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 10, 2, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 2, 5, htgs::MMType::Static));
+}
+
+TEST(MemMultiRelease, GraphExecutionDynamicWithMemoryBatch) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(1, 1, 1, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 2, 1, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 10, 2, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchGraphExecution(100, 2, 5, htgs::MMType::Dynamic));
+}
+
+TEST(MemMultiRelease, GraphExecutionWithSharedMemoryBatch) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedBatchGraphExecution(1, 2, 1, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedBatchGraphExecution(100, 3, 2, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseSharedBatchGraphExecution(100, 4, 4, htgs::MMType::Dynamic));
+}
+
+TEST(MemMultiRelease, MemoryBatchExceedsPool) {
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchExceedsPool(2, 0, htgs::MMType::Static));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchExceedsPool(2, 0, htgs::MMType::Dynamic));
+  EXPECT_NO_FATAL_FAILURE(multiReleaseBatchExceedsPool(2, 3, htgs::MMType::Static));
+}
+
+TEST(PrefetchGraph, PrefetchOncePerData) {
+  EXPECT_NO_FATAL_FAILURE(prefetchGraphExecution(1, 1, 4));
+  EXPECT_NO_FATAL_FAILURE(prefetchGraphExecution(1000, 1, 1));
+  EXPECT_NO_FATAL_FAILURE(prefetchGraphExecution(1000, 1, 8));
+  EXPECT_NO_FATAL_FAILURE(prefetchGraphExecution(1000, 4, 8));
+}
+
+TEST(MultiVersionGraph, CalibrationFallback) {
+  EXPECT_NO_FATAL_FAILURE(multiVersionCalibrationFallback(1));
+  EXPECT_NO_FATAL_FAILURE(multiVersionCalibrationFallback(100));
+}
+
+TEST(MultiVersionGraph, NoVariantSelected) {
+  EXPECT_NO_FATAL_FAILURE(multiVersionNoVariantSelected());
+}
+
+#ifdef USE_FLIGHT_RECORDER
+TEST(FlightRecorderGraph, RecordedEventSequence) {
+  EXPECT_NO_FATAL_FAILURE(flightRecorderGraphExecution(1));
+  EXPECT_NO_FATAL_FAILURE(flightRecorderGraphExecution(100));
+}
+
+TEST(FlightRecorderGraph, MemoryRelease) {
+  EXPECT_NO_FATAL_FAILURE(flightRecorderGraphExecution(100, true));
+}
+
+TEST(FlightRecorderGraph, RingOverflow) {
+  EXPECT_NO_FATAL_FAILURE(flightRecorderGraphExecution(HTGS_FLIGHT_RECORDER_SIZE));
+}
+#endif
+
+TEST(DeadlineGraph, ConnectorOrdering) {
+  EXPECT_NO_FATAL_FAILURE(deadlineConnectorOrdering());
+}
+
+TEST(DeadlineGraph, GraphExecutionDropExpired) {
+  EXPECT_NO_FATAL_FAILURE(deadlineGraphExecution(100, false));
+}
+
+TEST(DeadlineGraph, GraphExecutionWithFallback) {
+  EXPECT_NO_FATAL_FAILURE(deadlineGraphExecution(100, true));
+}
+
+TEST(DeadlineGraph, BatchedPipelineExpiresEachData) {
+  EXPECT_NO_FATAL_FAILURE(deadlineBatchedPipelineExecution(1000, 4, 2, 16));
+  EXPECT_NO_FATAL_FAILURE(deadlineBatchedPipelineExecution(1000, 4, 4, 64));
+}
+
+TEST(FairShareGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(fairShareGraphExecution(1, 3, 4, 20));
+  EXPECT_NO_FATAL_FAILURE(fairShareGraphExecution(2, 3, 4, 50));
+}
+
+TEST(CheckpointGraph, PendingData) {
+  EXPECT_NO_FATAL_FAILURE(checkpointPendingData(100));
+}
+
+TEST(CheckpointGraph, ResumeGraph) {
+  EXPECT_NO_FATAL_FAILURE(checkpointResumeGraph(200, 1));
+  EXPECT_NO_FATAL_FAILURE(checkpointResumeGraph(200, 4));
+}
+
+TEST(CheckpointGraph, GateWakeup) {
+  EXPECT_NO_FATAL_FAILURE(checkpointGateWakeup(10));
+}
+
+TEST(CopyOnWriteGraph, CowPtr) {
+  EXPECT_NO_FATAL_FAILURE(copyOnWritePtr());
+}
+
+TEST(CopyOnWriteGraph, CowBuffer) {
+  EXPECT_NO_FATAL_FAILURE(copyOnWriteBuffer(100, 16));
+  EXPECT_NO_FATAL_FAILURE(copyOnWriteBuffer(10000, 1024));
+}
+
+TEST(CopyOnWriteGraph, GraphFanOut) {
+  EXPECT_NO_FATAL_FAILURE(copyOnWriteGraphFanOut(50, 4096));
+}
+
+TEST(TimerWheelGraph, OneShot) {
+  EXPECT_NO_FATAL_FAILURE(timerWheelOneShot());
+}
+
+TEST(TimerWheelGraph, Periodic) {
+  EXPECT_NO_FATAL_FAILURE(timerWheelPeriodic());
+}
+
+TEST(TimerWheelGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(timerWheelGraphExecution(100, 1));
+  EXPECT_NO_FATAL_FAILURE(timerWheelGraphExecution(100, 4));
+}
+
+TEST(WindowGraph, Tumbling) {
+  EXPECT_NO_FATAL_FAILURE(windowGraphExecution(1, 1000, 1000, 10, 20000));
+  EXPECT_NO_FATAL_FAILURE(windowGraphExecution(4, 1000, 1000, 10, 20000));
+}
+
+TEST(WindowGraph, Sliding) {
+  EXPECT_NO_FATAL_FAILURE(windowGraphExecution(1, 3000, 1000, 10, 20000));
+  EXPECT_NO_FATAL_FAILURE(windowGraphExecution(4, 3000, 500, 10, 20000));
+}
+
+TEST(WindowGraph, ExecutionPipeline) {
+  EXPECT_NO_FATAL_FAILURE(windowPipelineExecution(2, 1, 1000, 1000, 10, 20000));
+  EXPECT_NO_FATAL_FAILURE(windowPipelineExecution(4, 2, 3000, 500, 10, 20000));
+}
+
+TEST(WindowGraph, LateData) {
+  EXPECT_NO_FATAL_FAILURE(windowLateData());
+}
+
+TEST(SpscGraph, Queue) {
+  EXPECT_NO_FATAL_FAILURE(spscQueue(100000));
+}
+
+TEST(SpscGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(spscGraphExecution(10000, 1));
+  EXPECT_NO_FATAL_FAILURE(spscGraphExecution(10000, 4));
+}
+
+TEST(PlacementGraph, Topology) {
+  EXPECT_NO_FATAL_FAILURE(placementTopology());
+}
+
+TEST(PlacementGraph, ComputePlacement) {
+  EXPECT_NO_FATAL_FAILURE(placementCompute());
+}
+
+TEST(PlacementGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(placementGraphExecution(1000, 1));
+  EXPECT_NO_FATAL_FAILURE(placementGraphExecution(1000, 4));
+}
+
+TEST(MemOwnershipGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(memOwnershipGraphExecution(100, 2, 4));
+  EXPECT_NO_FATAL_FAILURE(memOwnershipGraphExecution(100, 0, 1));
+}
+
+TEST(IncrementalGraph, Lineage) {
+  EXPECT_NO_FATAL_FAILURE(incrementalLineage(1));
+  EXPECT_NO_FATAL_FAILURE(incrementalLineage(4));
+}
+
+TEST(IncrementalGraph, ChangedInputs) {
+  EXPECT_NO_FATAL_FAILURE(incrementalChangedInputs(10, 1));
+  EXPECT_NO_FATAL_FAILURE(incrementalChangedInputs(100, 4));
+}
+
+TEST(IncrementalGraph, RemovedInput) {
+  EXPECT_NO_FATAL_FAILURE(incrementalRemovedInput(10));
+}
+
+TEST(PullGraph, TopK) {
+  EXPECT_NO_FATAL_FAILURE(pullGraphTopK(1, 10, true));
+  EXPECT_NO_FATAL_FAILURE(pullGraphTopK(4, 10, true));
+  EXPECT_NO_FATAL_FAILURE(pullGraphTopK(4, 10, false));
+}
+
+TEST(PullGraph, Exhausted) {
+  EXPECT_NO_FATAL_FAILURE(pullGraphExhausted(1, 11));
+  EXPECT_NO_FATAL_FAILURE(pullGraphExhausted(4, 100));
+}
+
+TEST(PullGraph, ExhaustedWithCoreBudget) {
+  EXPECT_NO_FATAL_FAILURE(pullGraphExhausted(1, 11, 1));
+  EXPECT_NO_FATAL_FAILURE(pullGraphExhausted(4, 100, 1));
+}
+
+TEST(EpShardedGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(epShardedGraphExecution(8, 1, 32, 1000));
+  EXPECT_NO_FATAL_FAILURE(epShardedGraphExecution(8, 3, 32, 1000));
+  EXPECT_NO_FATAL_FAILURE(epShardedGraphExecution(8, 8, 1, 1000));
+  EXPECT_NO_FATAL_FAILURE(epShardedGraphExecution(2, 4, 16, 5));
+}
+
+TEST(EpLanesGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(epLanesGraphExecution(8, true, 1000));
+  EXPECT_NO_FATAL_FAILURE(epLanesGraphExecution(8, false, 1000));
+  EXPECT_NO_FATAL_FAILURE(epLanesGraphExecution(1, true, 10));
+}
+
+TEST(EpLanesGraph, Downstream) {
+  EXPECT_NO_FATAL_FAILURE(epLanesDownstreamExecution(8, 1, 1001));
+  EXPECT_NO_FATAL_FAILURE(epLanesDownstreamExecution(8, 4, 1001));
+}
+
+TEST(ObjectPoolGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(objectPoolGraphExecution(100, 1, 1));
+  EXPECT_NO_FATAL_FAILURE(objectPoolGraphExecution(1000, 4, 3));
+}
+
+TEST(ScratchGraph, ArenaReuse) {
+  EXPECT_NO_FATAL_FAILURE(scratchArenaReuse());
+}
+
+TEST(ScratchGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(scratchGraphExecution(200, 1));
+  EXPECT_NO_FATAL_FAILURE(scratchGraphExecution(200, 4));
+}
+
+TEST(SdfGraph, Schedule) {
+  EXPECT_NO_FATAL_FAILURE(sdfSchedule());
+}
+
+TEST(SdfGraph, InvalidChains) {
+  EXPECT_NO_FATAL_FAILURE(sdfInvalidChains());
+}
+
+TEST(SdfGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(sdfGraphExecution(1, 500, 4));
+  EXPECT_NO_FATAL_FAILURE(sdfGraphExecution(4, 500, 4));
+}
+
+TEST(SdfGraph, RateViolation) {
+  EXPECT_NO_FATAL_FAILURE(sdfGraphExecution(1, 100, 3));
+}
+
+TEST(TuningGraph, Signature) {
+  EXPECT_NO_FATAL_FAILURE(tuningSignature());
+}
+
+TEST(TuningGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(tuningGraphExecution(200));
+}
+
+TEST(ResourceGraph, ClassLimit) {
+  EXPECT_NO_FATAL_FAILURE(resourceClassLimit());
+}
+
+TEST(ResourceGraph, GraphExecution) {
+  EXPECT_NO_FATAL_FAILURE(resourceGraphExecution(200, 4, 2));
+  EXPECT_NO_FATAL_FAILURE(resourceGraphExecution(200, 2, 1));
+  EXPECT_NO_FATAL_FAILURE(resourceGraphExecution(100, 2, 0));
+}
+
 TEST(MemReleaseOutsideGraph, GraphCreation) {
   EXPECT_NO_FATAL_FAILURE(memReleaseOutsideGraphCreation());
 }
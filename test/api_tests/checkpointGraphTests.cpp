@@ -0,0 +1,191 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <htgs/api/Bookkeeper.hpp>
+#include <htgs/api/CheckpointManager.hpp>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/core/task/CheckpointGate.hpp>
+
+#include "checkpointGraphTests.h"
+#include "checkpoint/data/CheckpointData.h"
+#include "checkpoint/rules/CheckpointRule.h"
+#include "checkpoint/tasks/CheckpointTask.h"
+
+htgs::TaskGraphConf<CheckpointData, CheckpointData> *createCheckpointGraph(CheckpointRule *rule, size_t numThreads)
+{
+  auto tg = new htgs::TaskGraphConf<CheckpointData, CheckpointData>();
+  auto bk = new htgs::Bookkeeper<CheckpointData>();
+  auto task = new CheckpointTask(numThreads);
+
+  tg->setGraphConsumerTask(bk);
+  tg->addRuleEdge(bk, rule, task);
+  tg->addGraphProducerTask(task);
+
+  return tg;
+}
+
+void checkpointPendingData(int numData)
+{
+  std::string fileName = "checkpointPendingData.ckpt";
+  std::remove(fileName.c_str());
+
+  // Data is produced without executing the graph, so it is pending in the input connector
+  auto tg = createCheckpointGraph(new CheckpointRule(numData), 1);
+  htgs::CheckpointManager checkpointManager(tg, fileName, std::make_shared<CheckpointCodec>());
+  EXPECT_FALSE(checkpointManager.restore());
+
+  for (int i = 0; i < numData; i++)
+    tg->produceData(new CheckpointData(i));
+
+  EXPECT_TRUE(checkpointManager.checkpoint());
+  EXPECT_TRUE(checkpointManager.hasCheckpoint());
+  tg->finishedProducingData();
+  delete tg;
+
+  auto rule = new CheckpointRule(numData);
+  auto restoredTg = createCheckpointGraph(rule, 1);
+  htgs::CheckpointManager restoreManager(restoredTg, fileName, std::make_shared<CheckpointCodec>());
+  restoreManager.addCheckpointable(rule);
+  EXPECT_TRUE(restoreManager.restore());
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(restoredTg);
+  runtime->executeRuntime();
+  restoredTg->finishedProducingData();
+
+  int expected = 0;
+  while (!restoredTg->isOutputTerminated()) {
+    auto data = restoredTg->consumeData();
+    if (data != nullptr) {
+      EXPECT_EQ(expected, data->getValue());
+      expected++;
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, expected);
+  EXPECT_EQ((size_t) numData, rule->getNumSeen());
+
+  delete runtime;
+  std::remove(fileName.c_str());
+}
+
+void checkpointResumeGraph(int numData, size_t numThreads)
+{
+  std::string fileName = "checkpointResumeGraph.ckpt";
+  std::remove(fileName.c_str());
+
+  // First run: checkpoint while the graph is executing and stop after the checkpoint
+  auto rule = new CheckpointRule(numData);
+  auto tg = createCheckpointGraph(rule, numThreads);
+  htgs::CheckpointManager checkpointManager(tg, fileName, std::make_shared<CheckpointCodec>());
+  checkpointManager.addCheckpointable(rule);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->setCheckpointGate(checkpointManager.getCheckpointGate());
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++) {
+    tg->produceData(new CheckpointData(i));
+    checkpointManager.markCompleted("input" + std::to_string(i));
+  }
+
+  int numConsumed = 0;
+  while (numConsumed < numData / 4) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      checkpointManager.markCompleted("output" + std::to_string(data->getValue()));
+      numConsumed++;
+    }
+  }
+
+  EXPECT_TRUE(checkpointManager.checkpoint());
+  size_t numCompletedOutputs = checkpointManager.getNumCompleted() - numData;
+
+  tg->finishedProducingData();
+  runtime->waitForRuntime();
+  delete runtime;
+
+  // Second run: resume from the checkpoint, skipping the input and output that is completed
+  auto restoredRule = new CheckpointRule(numData);
+  auto restoredTg = createCheckpointGraph(restoredRule, numThreads);
+  htgs::CheckpointManager restoreManager(restoredTg, fileName, std::make_shared<CheckpointCodec>());
+  restoreManager.addCheckpointable(restoredRule);
+  EXPECT_TRUE(restoreManager.restore());
+  EXPECT_EQ(numData + numCompletedOutputs, restoreManager.getNumCompleted());
+
+  runtime = new htgs::TaskGraphRuntime(restoredTg);
+  runtime->setCheckpointGate(restoreManager.getCheckpointGate());
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++) {
+    if (!restoreManager.isCompleted("input" + std::to_string(i)))
+      restoredTg->produceData(new CheckpointData(i));
+  }
+
+  restoredTg->finishedProducingData();
+
+  while (!restoredTg->isOutputTerminated()) {
+    auto data = restoredTg->consumeData();
+    if (data != nullptr) {
+      std::string key = "output" + std::to_string(data->getValue());
+      EXPECT_FALSE(restoreManager.isCompleted(key));
+      restoreManager.markCompleted(key);
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ((size_t) numData * 2, restoreManager.getNumCompleted());
+  EXPECT_EQ((size_t) numData, restoredRule->getNumSeen());
+
+  delete runtime;
+  std::remove(fileName.c_str());
+}
+
+void checkpointGateWakeup(int numPauses)
+{
+  auto connector = std::make_shared<htgs::Connector<CheckpointData>>();
+  htgs::CheckpointGate gate;
+
+  // A thread that has received its data is not woken up, so no wakeup is left in its connector
+  gate.enter(connector);
+  gate.endWait(connector);
+  EXPECT_FALSE(gate.pause(std::chrono::milliseconds(10)));
+  gate.exit();
+  for (int i = 0; i < numPauses; i++) {
+    EXPECT_TRUE(gate.pause(std::chrono::milliseconds(1000)));
+    gate.resume();
+  }
+  EXPECT_EQ(0, connector->getQueueSize());
+
+  // A thread that is waiting for data is woken up and exits the gate
+  std::thread consumer([&]() {
+    while (true) {
+      gate.enter(connector);
+      auto data = connector->consumeData();
+      gate.endWait(connector);
+      gate.exit();
+      if (data != nullptr)
+        break;
+    }
+  });
+
+  for (int i = 0; i < numPauses; i++) {
+    EXPECT_TRUE(gate.pause(std::chrono::milliseconds(1000)));
+    gate.resume();
+  }
+
+  connector->produceData(std::make_shared<CheckpointData>(0));
+  consumer.join();
+  EXPECT_EQ(0, connector->getQueueSize());
+}
@@ -0,0 +1,129 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/Bookkeeper.hpp>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "copyOnWriteGraphTests.h"
+#include "copyOnWrite/data/CowData.h"
+#include "copyOnWrite/rules/CowFanOutRule.h"
+#include "copyOnWrite/tasks/CowWriteTask.h"
+
+void copyOnWritePtr()
+{
+  htgs::CowPtr<std::vector<int>> original(new std::vector<int>(10, 1));
+  EXPECT_FALSE(original.isShared());
+
+  htgs::CowPtr<std::vector<int>> reader = original;
+  EXPECT_TRUE(original.isShared());
+  EXPECT_EQ(&original.read(), &reader.read());
+
+  htgs::CowPtr<std::vector<int>> writer = original;
+  writer.write()[0] = 2;
+
+  EXPECT_NE(&original.read(), &writer.read());
+  EXPECT_EQ(&original.read(), &reader.read());
+  EXPECT_EQ(1, original->at(0));
+  EXPECT_EQ(2, writer->at(0));
+
+  // The writer holds the only reference, so it is written in place
+  const std::vector<int> *writerValue = &writer.read();
+  writer.write()[1] = 3;
+  EXPECT_EQ(writerValue, &writer.read());
+}
+
+void copyOnWriteBuffer(size_t numElements, size_t pageSize)
+{
+  std::vector<int> memory(numElements);
+  for (size_t i = 0; i < numElements; i++)
+    memory[i] = (int) i;
+
+  // View external memory; pages are copied when written, so the memory is not modified
+  htgs::CowBuffer<int> view(memory.data(), numElements, nullptr, pageSize);
+  EXPECT_EQ((numElements + pageSize - 1) / pageSize, view.getNumPages());
+  EXPECT_EQ(view.getNumPages(), view.getNumSharedPages());
+
+  view.set(numElements - 1, -1);
+  EXPECT_EQ((int) numElements - 1, memory[numElements - 1]);
+  EXPECT_EQ(-1, view[numElements - 1]);
+  EXPECT_EQ(view.getNumPages() - 1, view.getNumSharedPages());
+
+  htgs::CowBuffer<int> copy = view;
+  copy.set(0, -2);
+  EXPECT_EQ(0, view[0]);
+  EXPECT_EQ(-2, copy[0]);
+
+  // Only the written page is copied, the other pages are still shared
+  EXPECT_EQ(view.readPage(view.getNumPages() - 1), copy.readPage(copy.getNumPages() - 1));
+  EXPECT_NE(view.readPage(0), copy.readPage(0));
+
+  std::vector<int> result(numElements);
+  copy.copyTo(result.data());
+  for (size_t i = 1; i < numElements - 1; i++)
+    EXPECT_EQ((int) i, result[i]);
+  EXPECT_EQ(-2, result[0]);
+  EXPECT_EQ(-1, result[numElements - 1]);
+}
+
+void copyOnWriteGraphFanOut(int numData, size_t numElements)
+{
+  auto tg = new htgs::TaskGraphConf<CowData, CowData>();
+  auto bk = new htgs::Bookkeeper<CowData>();
+  auto firstWriter = new CowWriteTask("FirstWriter", 0);
+  auto lastWriter = new CowWriteTask("LastWriter", numElements - 1);
+
+  tg->setGraphConsumerTask(bk);
+  tg->addRuleEdge(bk, new CowFanOutRule(), firstWriter);
+  tg->addRuleEdge(bk, new CowFanOutRule(), lastWriter);
+  tg->addGraphProducerTask(firstWriter);
+  tg->addGraphProducerTask(lastWriter);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  std::vector<htgs::CowBuffer<int>> inputs;
+  for (int i = 0; i < numData; i++) {
+    inputs.push_back(htgs::CowBuffer<int>(numElements, i));
+    tg->produceData(new CowData(inputs.back(), "Input"));
+  }
+
+  tg->finishedProducingData();
+
+  int count = 0;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      const htgs::CowBuffer<int> &buffer = data->getBuffer();
+      int value = buffer[numElements / 2];
+      const htgs::CowBuffer<int> &input = inputs[value];
+
+      size_t written = data->getWriter() == "FirstWriter" ? 0 : numElements - 1;
+      EXPECT_EQ(value + 1, buffer[written]);
+      EXPECT_EQ(value, input[written]);
+
+      // Only the written page is copied from the input
+      for (size_t page = 0; page < buffer.getNumPages(); page++) {
+        if (page == buffer.getPage(written))
+          EXPECT_NE(input.readPage(page), buffer.readPage(page));
+        else
+          EXPECT_EQ(input.readPage(page), buffer.readPage(page));
+      }
+
+      count++;
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData * 2, count);
+
+  delete runtime;
+}
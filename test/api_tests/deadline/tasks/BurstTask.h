@@ -0,0 +1,33 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#ifndef HTGS_BURSTTASK_H
+#define HTGS_BURSTTASK_H
+
+#include <htgs/api/ITask.hpp>
+#include "../data/SequencedDeadlineData.h"
+
+// Produces data 0 to n-1 at once for input data with value n, where even values have already expired.
+// The data is consumed in order of value, so expired data is interleaved with data that has not expired.
+class BurstTask : public htgs::ITask<DeadlineData, DeadlineData> {
+ public:
+  BurstTask() : ITask(1) {}
+
+  void executeTask(std::shared_ptr<DeadlineData> data) override {
+    auto now = htgs::IDeadlineData::clock::now();
+    for (int i = 0; i < data->getValue(); i++) {
+      auto deadline = (i % 2 == 0) ? now - std::chrono::seconds(1) : now + std::chrono::hours(1);
+      addResult(new SequencedDeadlineData(i, deadline));
+    }
+  }
+
+  std::string getName() override { return "BurstTask"; }
+
+  BurstTask *copy() override { return new BurstTask(); }
+};
+
+#endif //HTGS_BURSTTASK_H
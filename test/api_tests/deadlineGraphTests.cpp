@@ -0,0 +1,134 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/ExecutionPipeline.hpp>
+
+#include "deadlineGraphTests.h"
+#include "deadline/data/DeadlineData.h"
+#include "deadline/tasks/DeadlineTask.h"
+#include "deadline/tasks/BurstTask.h"
+#include "deadline/rules/DeadlineDecompRule.h"
+
+void deadlineConnectorOrdering()
+{
+  auto now = htgs::IDeadlineData::clock::now();
+
+  htgs::Connector<DeadlineData> connector;
+  connector.setQueueDiscipline(htgs::QueueDiscipline::Priority);
+  EXPECT_EQ(htgs::QueueDiscipline::Priority, connector.getQueueDiscipline());
+
+  connector.produceData(std::make_shared<DeadlineData>(3, now + std::chrono::seconds(3)));
+  connector.produceData(std::make_shared<DeadlineData>(1, now + std::chrono::seconds(1)));
+  connector.produceData(std::make_shared<DeadlineData>(4, now + std::chrono::seconds(4)));
+  connector.produceData(std::make_shared<DeadlineData>(2, now + std::chrono::seconds(2)));
+
+  for (int i = 1; i <= 4; i++)
+    EXPECT_EQ(i, connector.consumeData()->getValue());
+
+  htgs::Connector<DeadlineData> *connectorCopy = connector.copy();
+  EXPECT_EQ(htgs::QueueDiscipline::Priority, connectorCopy->getQueueDiscipline());
+  delete connectorCopy;
+}
+
+void deadlineGraphExecution(int numData, bool useFallback)
+{
+  auto tg = new htgs::TaskGraphConf<DeadlineData, DeadlineData>();
+
+  DeadlineTask *producer = new DeadlineTask("Producer");
+  DeadlineTask *consumer = new DeadlineTask("Consumer");
+  DeadlineTask *fallback = new DeadlineTask("Fallback");
+
+  tg->setGraphConsumerTask(producer);
+
+  if (useFallback)
+    tg->addDeadlineEdge(producer, consumer, fallback);
+  else
+    tg->addDeadlineEdge(producer, consumer);
+
+  tg->addGraphProducerTask(consumer);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  auto now = htgs::IDeadlineData::clock::now();
+  for (int i = 0; i < numData; i++) {
+    // Even values have already expired
+    auto deadline = (i % 2 == 0) ? now - std::chrono::seconds(1) : now + std::chrono::hours(1);
+    tg->produceData(new DeadlineData(i, deadline));
+  }
+
+  tg->finishedProducingData();
+
+  int count = 0;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      EXPECT_EQ(1, data->getValue() % 2);
+      count++;
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData / 2, count);
+  EXPECT_EQ((size_t) (numData / 2), consumer->getNumProcessed());
+  EXPECT_EQ((size_t) (numData - numData / 2), consumer->getOwnerTaskManager()->getDeadlineMisses());
+  EXPECT_EQ((size_t) (useFallback ? numData - numData / 2 : 0), fallback->getNumProcessed());
+
+  if (!useFallback)
+    delete fallback;
+
+  delete runtime;
+}
+
+void deadlineBatchedPipelineExecution(int numData, size_t numPipelines, size_t numDistributors, size_t batchSize)
+{
+  auto innerGraph = new htgs::TaskGraphConf<DeadlineData, DeadlineData>();
+  auto innerTask = new DeadlineTask("Inner");
+  innerGraph->setGraphConsumerTask(innerTask);
+  innerGraph->addGraphProducerTask(innerTask);
+
+  auto execPipeline = new htgs::ExecutionPipeline<DeadlineData, DeadlineData>(numPipelines, innerGraph);
+  execPipeline->addInputRule(new DeadlineDecompRule(numPipelines));
+  execPipeline->setNumDistributors(numDistributors);
+  execPipeline->setDistributionBatchSize(batchSize);
+
+  auto tg = new htgs::TaskGraphConf<DeadlineData, DeadlineData>();
+  BurstTask *producer = new BurstTask();
+  tg->setGraphConsumerTask(producer);
+  tg->addDeadlineEdge(producer, execPipeline);
+  tg->addGraphProducerTask(execPipeline);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  // The producer adds all data at once, so the execution pipeline forwards batches of waiting data
+  tg->produceData(new DeadlineData(numData, htgs::IDeadlineData::clock::now() + std::chrono::hours(1)));
+  tg->finishedProducingData();
+
+  int count = 0;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      EXPECT_EQ(1, data->getValue() % 2) << "expired data " << data->getValue() << " was processed";
+      count++;
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData / 2, count);
+  EXPECT_EQ((size_t) (numData - numData / 2), execPipeline->getOwnerTaskManager()->getDeadlineMisses());
+
+  delete runtime;
+}
@@ -0,0 +1,65 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/ExecutionPipeline.hpp>
+
+#include "epShardedGraphTests.h"
+#include "epSharded/tasks/PassThroughTask.h"
+#include "simple/rules/SimpleDecompRule.h"
+
+void epShardedGraphExecution(size_t numPipelines, size_t numDistributors, size_t batchSize, int numData)
+{
+  auto innerGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  auto passThroughTask = new PassThroughTask();
+  innerGraph->setGraphConsumerTask(passThroughTask);
+  innerGraph->addGraphProducerTask(passThroughTask);
+
+  auto execPipeline = new htgs::ExecutionPipeline<SimpleData, SimpleData>(numPipelines, innerGraph);
+  execPipeline->addInputRule(new SimpleDecompRule(numPipelines));
+  execPipeline->setNumDistributors(numDistributors);
+  execPipeline->setDistributionBatchSize(batchSize);
+
+  EXPECT_EQ(std::min(numDistributors, numPipelines), execPipeline->getNumDistributors());
+  EXPECT_EQ(batchSize, execPipeline->getDistributionBatchSize());
+
+  auto tg = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  tg->setGraphConsumerTask(execPipeline);
+  tg->addGraphProducerTask(execPipeline);
+
+  auto runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    tg->produceData(new SimpleData(i, (int) (i % numPipelines)));
+
+  tg->finishedProducingData();
+
+  std::vector<int> lastValue(numPipelines, -1);
+  int numReceived = 0;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      numReceived++;
+
+      // Data for a pipeline must arrive in the order it was produced
+      EXPECT_LT(lastValue[data->getPipelineId()], data->getValue());
+      lastValue[data->getPipelineId()] = data->getValue();
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, numReceived);
+  for (size_t i = 0; i < numPipelines && (int) i < numData; i++)
+    EXPECT_EQ(numData - 1 - (int) ((numData - 1 - i) % numPipelines), lastValue[i]);
+
+  delete runtime;
+}
@@ -0,0 +1,76 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/FairShareScheduler.hpp>
+
+#include "fairShareGraphTests.h"
+#include "fairShare/tasks/ConcurrencyTask.h"
+
+void fairShareGraphExecution(size_t coreBudget, size_t numGraphs, size_t numThreads, int numData)
+{
+  htgs::FairShareScheduler scheduler(coreBudget);
+
+  std::atomic_size_t numActive(0);
+  std::atomic_size_t maxActive(0);
+
+  std::vector<htgs::TaskGraphConf<SimpleData, SimpleData> *> graphs;
+  std::vector<htgs::TaskGraphRuntime *> runtimes;
+  std::vector<std::shared_ptr<htgs::FairShareGroup>> groups;
+
+  for (size_t i = 0; i < numGraphs; i++) {
+    auto tg = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+    auto task = new ConcurrencyTask(numThreads, &numActive, &maxActive);
+    tg->setGraphConsumerTask(task);
+    tg->addGraphProducerTask(task);
+
+    auto runtime = new htgs::TaskGraphRuntime(tg);
+    groups.push_back(runtime->registerFairShare(scheduler, "graph" + std::to_string(i), (double) (i + 1)));
+
+    graphs.push_back(tg);
+    runtimes.push_back(runtime);
+  }
+
+  for (size_t i = 0; i < numGraphs; i++) {
+    runtimes[i]->executeRuntime();
+
+    for (int d = 0; d < numData; d++)
+      graphs[i]->produceData(new SimpleData(d, 0));
+
+    graphs[i]->finishedProducingData();
+  }
+
+  for (size_t i = 0; i < numGraphs; i++) {
+    int count = 0;
+    while (!graphs[i]->isOutputTerminated()) {
+      auto data = graphs[i]->consumeData();
+      if (data != nullptr)
+        count++;
+    }
+
+    runtimes[i]->waitForRuntime();
+    EXPECT_EQ(numData, count);
+  }
+
+  EXPECT_LE(maxActive.load(), coreBudget);
+  EXPECT_EQ((size_t) 0, scheduler.getNumRunning());
+
+  double totalShare = 0.0;
+  for (auto group : groups) {
+    EXPECT_GT(group->getCpuShare(), 0.0);
+    totalShare += group->getCpuShare();
+  }
+  EXPECT_NEAR(1.0, totalShare, 1e-6);
+
+  for (auto runtime : runtimes)
+    delete runtime;
+}
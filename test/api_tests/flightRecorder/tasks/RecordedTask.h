@@ -0,0 +1,37 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#ifndef HTGS_RECORDEDTASK_H
+#define HTGS_RECORDEDTASK_H
+
+#include <htgs/api/ITask.hpp>
+#include "../../simple/data/SimpleData.h"
+#include "../../memMultiRelease/memory/SimpleReleaseRule.h"
+
+class RecordedTask : public htgs::ITask<SimpleData, SimpleData> {
+ public:
+  RecordedTask(std::string name) : ITask(1), name(name) {}
+
+  void executeTask(std::shared_ptr<SimpleData> data) override {
+    if (this->hasMemoryEdge("mem")) {
+      htgs::m_data_t<int> mem = this->getMemory<int>("mem", new SimpleReleaseRule());
+      mem->releaseMemory();
+    }
+    addResult(data);
+  }
+
+  std::string getName() override { return name; }
+
+  RecordedTask *copy() override {
+    return new RecordedTask(name);
+  }
+
+ private:
+  std::string name;
+};
+
+#endif //HTGS_RECORDEDTASK_H
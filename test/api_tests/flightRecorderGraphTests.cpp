@@ -0,0 +1,136 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/log/FlightRecorder.hpp>
+
+#include "flightRecorderGraphTests.h"
+#include "flightRecorder/tasks/RecordedTask.h"
+#include "memMultiRelease/memory/SimpleMemoryAllocator.h"
+
+struct RecordedRing {
+  size_t numOverwritten;
+  std::vector<std::string> types;
+  std::vector<uint64_t> values;
+  std::vector<uint64_t> timestamps;
+};
+
+// Parses the events that were recorded for a name from a flight recorder dump, for each ring that has them
+static std::vector<RecordedRing> parseDump(const std::string &dump, const std::string &name) {
+  std::vector<RecordedRing> rings;
+  RecordedRing ring;
+  bool hasRing = false;
+
+  std::istringstream is(dump);
+  std::string line;
+  while (std::getline(is, line)) {
+    if (line.compare(0, 7, "thread ") == 0) {
+      if (hasRing && !ring.types.empty())
+        rings.push_back(ring);
+      ring = RecordedRing();
+      hasRing = true;
+      ring.numOverwritten = std::stoul(line.substr(line.rfind(' ') + 1));
+    } else if (hasRing && line.compare(0, 2, "  ") == 0) {
+      // "  <timestamp> us <type> <name> <value>"
+      std::istringstream event(line);
+      uint64_t timestamp;
+      std::string unit, type;
+      event >> timestamp >> unit >> type;
+      size_t nameStart = line.find(type) + type.size() + 1;
+      size_t nameEnd = line.rfind(' ');
+      if (line.substr(nameStart, nameEnd - nameStart) != name)
+        continue;
+
+      ring.timestamps.push_back(timestamp);
+      ring.types.push_back(type);
+      ring.values.push_back(std::stoull(line.substr(nameEnd + 1)));
+    }
+  }
+
+  if (hasRing && !ring.types.empty())
+    rings.push_back(ring);
+
+  return rings;
+}
+
+void flightRecorderGraphExecution(int numData, bool useMemory) {
+  // Each execution uses a new task name, so the events of earlier executions are ignored
+  static int executionId = 0;
+  std::string taskName = "RecordedTask" + std::to_string(executionId++);
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  auto task = new RecordedTask(taskName);
+
+  taskGraph->setGraphConsumerTask(task);
+  taskGraph->addGraphProducerTask(task);
+
+  // The task acquires and releases memory while executing each data
+  if (useMemory)
+    taskGraph->addMemoryManagerEdge("mem", task, new SimpleMemoryAllocator(1), 1, htgs::MMType::Static);
+
+  // All data is queued before the task starts, so the task never waits for data
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(new SimpleData(i, 0));
+  taskGraph->finishedProducingData();
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  int count = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr)
+      count++;
+  }
+
+  runtime->waitForRuntime();
+  delete runtime;
+
+  EXPECT_EQ(numData, count);
+
+  std::ostringstream dump;
+  htgs::FlightRecorder::dump(dump);
+
+  std::vector<RecordedRing> rings = parseDump(dump.str(), taskName + " (pipeline 0, thread 0)");
+  ASSERT_EQ((size_t) 1, rings.size());
+  const RecordedRing &ring = rings[0];
+
+  // The task terminates after it finds no more data
+  ASSERT_FALSE(ring.types.empty());
+  EXPECT_EQ("Terminate", ring.types.back());
+  size_t numEvents = ring.types.size() - 1;
+  while (numEvents > 0 && ring.types[numEvents - 1] == "Dequeue" && ring.values[numEvents - 1] == 0)
+    numEvents--;
+
+  // Before that, every data is dequeued and executed. Only the most recent events remain once the ring overflows.
+  std::vector<std::string> dataEvents = {"Dequeue", "ExecuteStart", "ExecuteEnd"};
+  if (useMemory)
+    dataEvents = {"Dequeue", "ExecuteStart", "MemoryWaitStart", "MemoryWaitEnd", "MemoryRelease", "ExecuteEnd"};
+  size_t numDataEvents = dataEvents.size() * (size_t) numData;
+  if (numDataEvents + 1 > HTGS_FLIGHT_RECORDER_SIZE) {
+    EXPECT_EQ((size_t) HTGS_FLIGHT_RECORDER_SIZE, ring.types.size());
+    EXPECT_GE(ring.numOverwritten, numDataEvents + 1 - HTGS_FLIGHT_RECORDER_SIZE);
+    ASSERT_LE(numEvents, numDataEvents);
+  } else {
+    ASSERT_EQ(numDataEvents, numEvents);
+  }
+
+  size_t firstDataEvent = numDataEvents - numEvents;
+  for (size_t i = 0; i < numEvents; i++) {
+    EXPECT_EQ(dataEvents[(firstDataEvent + i) % dataEvents.size()], ring.types[i]) << "event " << i;
+    if (ring.types[i] == "Dequeue") {
+      EXPECT_EQ((uint64_t) 1, ring.values[i]) << "event " << i << " did not dequeue data";
+    }
+  }
+
+  for (size_t i = 1; i < ring.timestamps.size(); i++)
+    EXPECT_LE(ring.timestamps[i - 1], ring.timestamps[i]) << "event " << i << " is out of order";
+}
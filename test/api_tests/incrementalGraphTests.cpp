@@ -0,0 +1,148 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/Bookkeeper.hpp>
+#include <htgs/api/IncrementalCache.hpp>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "incrementalGraphTests.h"
+#include "incremental/data/TileData.h"
+#include "incremental/data/PairData.h"
+#include "incremental/rules/PairRule.h"
+#include "incremental/tasks/ScaleTask.h"
+
+htgs::TaskGraphConf<TileData, PairData> *createIncrementalGraph(size_t numTiles, size_t numThreads)
+{
+  auto tg = new htgs::TaskGraphConf<TileData, PairData>();
+  auto scaleTask = new ScaleTask(numThreads);
+  auto bk = new htgs::Bookkeeper<TileData>();
+
+  tg->setGraphConsumerTask(scaleTask);
+  tg->addEdge(scaleTask, bk);
+  tg->addRuleEdgeAsGraphProducer(bk, new PairRule(numTiles));
+
+  return tg;
+}
+
+std::list<std::shared_ptr<TileData>> createTiles(const std::vector<int> &values)
+{
+  std::list<std::shared_ptr<TileData>> tiles;
+  for (size_t i = 0; i < values.size(); i++)
+    tiles.push_back(std::make_shared<TileData>(std::to_string(i), i, values[i]));
+  return tiles;
+}
+
+void checkPairs(const std::list<std::shared_ptr<PairData>> &pairs, const std::vector<int> &values, size_t numPairs)
+{
+  ASSERT_EQ(numPairs, pairs.size());
+  for (auto &pair : pairs) {
+    size_t i = pair->getIndex();
+    EXPECT_EQ(2 * (values[i] + values[i + 1]), pair->getSum());
+
+    std::set<std::string> expectedLineage{std::to_string(i), std::to_string(i + 1)};
+    EXPECT_EQ(expectedLineage, pair->getLineage());
+  }
+}
+
+void incrementalLineage(size_t numThreads)
+{
+  std::vector<int> values{1, 2, 3};
+  auto tg = createIncrementalGraph(values.size(), numThreads);
+  auto runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  // Inputs have no recorded lineage, so their lineage is their own key
+  for (auto &tile : createTiles(values)) {
+    EXPECT_EQ(std::set<std::string>{tile->getLineageKey()}, tile->getLineage());
+    tg->produceData(tile);
+  }
+  tg->finishedProducingData();
+
+  std::list<std::shared_ptr<PairData>> pairs;
+  while (!tg->isOutputTerminated()) {
+    auto pair = tg->consumeData();
+    if (pair != nullptr)
+      pairs.push_back(pair);
+  }
+
+  runtime->waitForRuntime();
+  delete runtime;
+
+  checkPairs(pairs, values, values.size() - 1);
+  for (auto &pair : pairs) {
+    EXPECT_TRUE(pair->dependsOn({"1"}));
+    EXPECT_FALSE(pair->dependsOn({"3", "scaled 1"}));
+  }
+}
+
+void incrementalChangedInputs(size_t numTiles, size_t numThreads)
+{
+  std::vector<int> values;
+  for (size_t i = 0; i < numTiles; i++)
+    values.push_back((int) i);
+
+  htgs::IncrementalCache<TileData, PairData> cache;
+
+  auto pairs = cache.execute(createIncrementalGraph(numTiles, numThreads), createTiles(values));
+  checkPairs(pairs, values, numTiles - 1);
+  EXPECT_EQ(numTiles, cache.getNumInputsProduced());
+  EXPECT_EQ(numTiles - 1, cache.getNumRecomputed());
+  EXPECT_EQ((size_t) 0, cache.getNumReused());
+
+  // Nothing changed, so every output is reused
+  pairs = cache.execute(createIncrementalGraph(numTiles, numThreads), createTiles(values), {});
+  checkPairs(pairs, values, numTiles - 1);
+  EXPECT_EQ((size_t) 0, cache.getNumInputsProduced());
+  EXPECT_EQ((size_t) 0, cache.getNumRecomputed());
+  EXPECT_EQ(numTiles - 1, cache.getNumReused());
+
+  // Changing tile 4 affects pairs 3 and 4, which need tiles 3, 4 and 5
+  values[4] = 100;
+  std::set<std::string> changed{"4"};
+  EXPECT_EQ(std::set<std::string>({"pair 3", "pair 4"}), cache.getAffectedOutputs(changed));
+  EXPECT_EQ(std::set<std::string>({"3", "4", "5"}), cache.getInputsToRecompute(changed));
+
+  pairs = cache.execute(createIncrementalGraph(numTiles, numThreads), createTiles(values), changed);
+  checkPairs(pairs, values, numTiles - 1);
+  EXPECT_EQ((size_t) 3, cache.getNumInputsProduced());
+  EXPECT_EQ((size_t) 2, cache.getNumRecomputed());
+  EXPECT_EQ(numTiles - 3, cache.getNumReused());
+
+  // Changing the first and last tiles
+  values[0] = -5;
+  values[numTiles - 1] = 42;
+  changed = {"0", std::to_string(numTiles - 1)};
+  pairs = cache.execute(createIncrementalGraph(numTiles, numThreads), createTiles(values), changed);
+  checkPairs(pairs, values, numTiles - 1);
+  EXPECT_EQ((size_t) 4, cache.getNumInputsProduced());
+  EXPECT_EQ((size_t) 2, cache.getNumRecomputed());
+  EXPECT_EQ(numTiles - 3, cache.getNumReused());
+}
+
+void incrementalRemovedInput(size_t numTiles)
+{
+  std::vector<int> values;
+  for (size_t i = 0; i < numTiles; i++)
+    values.push_back((int) i * 3);
+
+  htgs::IncrementalCache<TileData, PairData> cache;
+  auto pairs = cache.execute(createIncrementalGraph(numTiles, 1), createTiles(values));
+  checkPairs(pairs, values, numTiles - 1);
+
+  // Removing the last tile removes the last pair, which cannot be recomputed
+  std::vector<int> remaining(values.begin(), values.end() - 1);
+  pairs = cache.execute(createIncrementalGraph(numTiles, 1), createTiles(remaining), {std::to_string(numTiles - 1)});
+  checkPairs(pairs, values, numTiles - 2);
+  EXPECT_EQ((size_t) 1, cache.getNumInputsProduced());
+  EXPECT_EQ((size_t) 0, cache.getNumRecomputed());
+  EXPECT_EQ(numTiles - 2, cache.getNumReused());
+  EXPECT_EQ(numTiles - 2, cache.getCachedOutputs().size());
+}
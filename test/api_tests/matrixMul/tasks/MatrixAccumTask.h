@@ -36,17 +36,17 @@ class MatrixAccumTask : public htgs::ITask<MatrixBlockMulData<double *>, MatrixB
     size_t width = matAData->getMatrixWidth();
     size_t height = matAData->getMatrixHeight();
 
-    double *result = new double[width*height];
+    // Accumulate into matrixA, which this task owns, rather than allocating a new result for each data
+    double *result = matrixA;
 
     for (size_t i = 0; i < height; i++)
     {
       for (size_t j = 0; j < width; j++)
       {
-        result[i*width+j] = matrixA[i*width+j] + matrixB[i*width+j];
+        result[i*width+j] += matrixB[i*width+j];
       }
     }
 
-    delete []matrixA;
     delete [] matrixB;
 
     auto matRequest = matAData->getRequest();
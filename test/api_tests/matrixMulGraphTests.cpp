@@ -7,8 +7,10 @@
 // Created by tjb3 on 4/18/16.
 //
 #include <gtest/gtest.h>
+#include <chrono>
 #include <htgs/api/TaskGraphConf.hpp>
 #include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/core/graph/profile/TaskGraphProfiler.hpp>
 
 #include "matrixMulGraphTests.h"
 #include "matrixMul/data/MatrixRequestData.h"
@@ -77,7 +79,7 @@ void createMatMulTasks()
 }
 
 
-htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *createMatMulGraph(size_t numThreads, size_t dim, size_t blockSize, double initValue)
+htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *createMatMulGraph(size_t numThreads, size_t dim, size_t blockSize, double initValue, htgs::QueueDiscipline discipline = htgs::QueueDiscipline::FIFO)
 {
   auto taskGraph = new htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>>();
 
@@ -115,7 +117,7 @@ htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *createMatMulG
 
   taskGraph->addRuleEdge(matMulBk, loadRule, mmulTask);
 
-  taskGraph->addEdge(mmulTask, matAccumBk);
+  taskGraph->addEdge(mmulTask, matAccumBk, discipline);
   taskGraph->addRuleEdge(matAccumBk, accumulateRule, accumTask);
   taskGraph->addEdge(accumTask, matAccumBk);
 
@@ -134,7 +136,7 @@ htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *createMatMulG
   return taskGraph;
 }
 
-double * launchGraph(htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *graph, size_t dim, size_t blockSize)
+double * launchGraph(htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<double *>> *graph, size_t dim, size_t blockSize, size_t *peakQueueSize = nullptr, htgs::TaskGraphProfiler *profiler = nullptr)
 {
   size_t numBlksHeight = (size_t)ceil((double)dim / (double)blockSize);
   size_t numBlksWidth = (size_t)ceil((double)dim / (double)blockSize);
@@ -190,6 +192,19 @@ double * launchGraph(htgs::TaskGraphConf<MatrixRequestData, MatrixBlockData<doub
 #ifdef HTGS_TEST_OUTPUT_DOTFILE
   graph->writeDotToFile("matMulGraph.dot");
 #endif
+
+  if (peakQueueSize != nullptr) {
+    *peakQueueSize = 0;
+    for (htgs::AnyTaskManager *taskManager : *graph->getTaskManagers()) {
+      auto connector = taskManager->getInputConnector();
+      if (connector != nullptr && connector != graph->getInputConnector())
+        *peakQueueSize = std::max(*peakQueueSize, connector->getMaxQueueSize());
+    }
+  }
+
+  if (profiler != nullptr)
+    profiler->buildProfile(graph);
+
   delete runtime;
 
   return result;
@@ -216,12 +231,83 @@ void matMulGraphExecution(size_t dim, size_t blockSize, size_t numThreads, doubl
   delete []result;
 }
 
+void matMulQueueDiscipline(size_t dim, size_t blockSize, size_t numThreads, double initValue) {
+  htgs::QueueDiscipline disciplines[] = {htgs::QueueDiscipline::FIFO, htgs::QueueDiscipline::LIFO,
+                                         htgs::QueueDiscipline::BoundedLIFO};
+  const char *names[] = {"FIFO", "LIFO", "BoundedLIFO"};
 
+  for (int i = 0; i < 3; i++) {
+    auto graph = createMatMulGraph(numThreads, dim, blockSize, initValue, disciplines[i]);
 
+    size_t peakQueueSize = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    double *result = launchGraph(graph, dim, blockSize, &peakQueueSize);
+    auto end = std::chrono::high_resolution_clock::now();
 
+    validateResults(result, dim, initValue);
+    delete []result;
 
+    std::cout << "Matrix multiply " << names[i] << ": "
+              << std::chrono::duration_cast<std::chrono::microseconds>(end - start).count() << " us, peak queue size: "
+              << peakQueueSize << std::endl;
+  }
+}
 
+void queueDisciplineOrdering() {
+  htgs::BlockingQueue<std::shared_ptr<htgs::IData>> lifoQueue;
+  lifoQueue.setDiscipline(htgs::QueueDiscipline::LIFO);
+  for (size_t i = 0; i < 4; i++)
+    lifoQueue.Enqueue(std::make_shared<htgs::IData>(i));
+
+  for (size_t i = 4; i > 0; i--)
+    EXPECT_EQ(i - 1, lifoQueue.Dequeue()->getOrder());
+
+  // With a bound of 2, two of the newest data are consumed before the oldest
+  htgs::BlockingQueue<std::shared_ptr<htgs::IData>> boundedQueue;
+  boundedQueue.setDiscipline(htgs::QueueDiscipline::BoundedLIFO);
+  boundedQueue.setLifoBound(2);
+  for (size_t i = 0; i < 6; i++)
+    boundedQueue.Enqueue(std::make_shared<htgs::IData>(i));
+
+  size_t expected[] = {5, 4, 0, 3, 2, 1};
+  for (size_t i = 0; i < 6; i++)
+    EXPECT_EQ(expected[i], boundedQueue.Dequeue()->getOrder());
+}
 
+void matMulRuleProfile(size_t dim, size_t blockSize, size_t numThreads, double initValue) {
+  auto graph = createMatMulGraph(numThreads, dim, blockSize, initValue);
 
+  htgs::TaskGraphProfiler profiler(0);
+  double *result = launchGraph(graph, dim, blockSize, nullptr, &profiler);
+  validateResults(result, dim, initValue);
+  delete []result;
 
+  size_t numBlks = (size_t)ceil((double)dim / (double)blockSize);
 
+  std::map<std::string, htgs::RuleManagerProfile> ruleProfiles;
+  for (auto profile : *profiler.getTaskManagerProfiles()) {
+    for (auto &ruleProfile : profile.second->getRuleProfiles())
+      ruleProfiles[ruleProfile.first].sum(ruleProfile.second);
+  }
+
+#ifdef PROFILE
+  // Each distribute rule sees every request and emits the requests for its matrix
+  auto distributeProfile = ruleProfiles["MatrixDistributeRule"];
+  EXPECT_EQ(4 * numBlks * numBlks, distributeProfile.getInvocations());
+  EXPECT_EQ(2 * numBlks * numBlks, distributeProfile.getOutputs());
+
+  // The load rule sees every block of A and B and emits one product per (i, j, k)
+  auto loadProfile = ruleProfiles["MatrixLoadRule"];
+  EXPECT_EQ(2 * numBlks * numBlks, loadProfile.getInvocations());
+  EXPECT_EQ(numBlks * numBlks * numBlks, loadProfile.getOutputs());
+  EXPECT_DOUBLE_EQ((double)numBlks / 2.0, loadProfile.getEmissionRatio());
+  EXPECT_GT(loadProfile.getTerminationTime(), 0);
+
+  size_t histogramCount = 0;
+  for (size_t i = 0; i < HTGS_RULE_PROFILE_NUM_BUCKETS; i++)
+    histogramCount += loadProfile.getHistogramCount(i);
+  EXPECT_EQ(loadProfile.getInvocations(), histogramCount);
+
+  EXPECT_EQ(numBlks * numBlks, ruleProfiles["MatrixOutputRule"].getOutputs());
+#endif
+}
@@ -13,5 +13,8 @@
 void matMulGraphCreation();
 void createMatMulTasks();
 void matMulGraphExecution(size_t dim, size_t blockSize, size_t numThreads, double initValue);
+void matMulQueueDiscipline(size_t dim, size_t blockSize, size_t numThreads, double initValue);
+void queueDisciplineOrdering();
+void matMulRuleProfile(size_t dim, size_t blockSize, size_t numThreads, double initValue);
 
 #endif //HTGS_MATRIXMULGRAPHTESTS_H
@@ -17,11 +17,30 @@
 
 class InputTask : public htgs::ITask<InputData, ProcessedData> {
  public:
-  InputTask(size_t numReleasers, bool graphReleaser, htgs::MMType memType) : numReleasers(numReleasers), graphReleaser(graphReleaser), memoryManagerType(memType) {
+  InputTask(size_t numReleasers, bool graphReleaser, htgs::MMType memType, bool useMemoryBatch = false) : numReleasers(numReleasers), graphReleaser(graphReleaser), memoryManagerType(memType), useMemoryBatch(useMemoryBatch) {
     count = 0;
   }
 
   virtual void executeTask(std::shared_ptr<InputData> data) override {
+    if (useMemoryBatch) {
+      std::vector<htgs::m_data_t<int>> memBatch;
+      switch(memoryManagerType)
+      {
+        case htgs::MMType::Static:
+          memBatch = this->getMemoryBatch<int>("mem", numReleasers, [](){ return new SimpleReleaseRule(); });
+          break;
+        case htgs::MMType::Dynamic:
+          memBatch = this->getDynamicMemoryBatch<int>("mem", numReleasers, [](){ return new SimpleReleaseRule(); }, 1);
+          break;
+      }
+
+      for (size_t i = 0; i < numReleasers; i++) {
+        count++;
+        addResult(new ProcessedData(data, i, memBatch[i], nullptr));
+      }
+      return;
+    }
+
     for (size_t i = 0; i < numReleasers; i++) {
 
       htgs::m_data_t<int> mem = nullptr;
@@ -65,7 +84,7 @@ class InputTask : public htgs::ITask<InputData, ProcessedData> {
     return "InputTask";
   }
   virtual htgs::ITask<InputData, ProcessedData> *copy() override {
-    return new InputTask(numReleasers, graphReleaser, memoryManagerType);
+    return new InputTask(numReleasers, graphReleaser, memoryManagerType, useMemoryBatch);
   }
 
 
@@ -74,6 +93,7 @@ class InputTask : public htgs::ITask<InputData, ProcessedData> {
   size_t numReleasers;
   bool graphReleaser;
   htgs::MMType memoryManagerType;
+  bool useMemoryBatch;
 };
 
 
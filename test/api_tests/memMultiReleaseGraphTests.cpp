@@ -12,6 +12,8 @@
 #include <htgs/api/TaskGraphConf.hpp>
 #include <htgs/api/ExecutionPipeline.hpp>
 #include <gtest/gtest.h>
+#include <chrono>
+#include <list>
 #include "memMultiRelease/data/ProcessedData.h"
 #include "memMultiRelease/tasks/InputTask.h"
 #include "memMultiRelease/rules/MemDistributeRule.h"
@@ -20,11 +22,11 @@
 #include "memMultiRelease/memory/SimpleMemoryAllocator.h"
 
 htgs::TaskGraphConf<InputData, ProcessedData> *
-createMultiReleaseGraph(size_t numPipelines, size_t numReleasers, bool useSeparateGraphEdge, bool useGraphReleaser, htgs::MMType type)
+createMultiReleaseGraph(size_t numPipelines, size_t numReleasers, bool useSeparateGraphEdge, bool useGraphReleaser, htgs::MMType type, bool useSharedEdge = false, bool useMemoryBatch = false)
 {
   auto taskGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
 
-  InputTask *inputTask = new InputTask(numReleasers, useGraphReleaser, type);
+  InputTask *inputTask = new InputTask(numReleasers, useGraphReleaser, type, useMemoryBatch);
   htgs::Bookkeeper<ProcessedData> *bk = new htgs::Bookkeeper<ProcessedData>();
 
   taskGraph->setGraphConsumerTask(inputTask);
@@ -34,7 +36,10 @@ createMultiReleaseGraph(size_t numPipelines, size_t numReleasers, bool useSepara
 
   size_t memoryPoolSizeMemEdge = numReleasers + (useGraphReleaser && !useSeparateGraphEdge ? numReleasers : 0);
   size_t memoryPoolSizeMem2Edge = numReleasers;
-  taskGraph->addMemoryManagerEdge("mem", inputTask, allocator, memoryPoolSizeMemEdge, type);
+  if (useSharedEdge)
+    taskGraph->addSharedMemoryManagerEdge("mem", inputTask, allocator, memoryPoolSizeMemEdge, memoryPoolSizeMemEdge, type, 100);
+  else
+    taskGraph->addMemoryManagerEdge("mem", inputTask, allocator, memoryPoolSizeMemEdge, type);
 
   for (int i = 0; i < numReleasers; i++) {
     MemDistributeRule *mRule = new MemDistributeRule(i);
@@ -137,3 +142,143 @@ void multiReleaseGraphExecution(size_t numDataGen, size_t numReleasers, size_t n
 //  graph->writeDotToFile("test.dot");
   EXPECT_NO_FATAL_FAILURE(launchGraph(graph, numDataGen, numPipelines, numReleasers, useSeparateEdge, useGraphReleaser, type));
 }
+
+void multiReleaseSharedGraphExecution(size_t numDataGen, size_t numReleasers, size_t numPipelines, htgs::MMType type) {
+  auto graph = createMultiReleaseGraph(numPipelines, numReleasers, false, false, type, true);
+  EXPECT_NO_FATAL_FAILURE(launchGraph(graph, numDataGen, numPipelines, numReleasers, false, false, type));
+}
+
+void multiReleaseSharedSkewedGraphExecution(size_t numDataGen, size_t sharedPoolSize, htgs::MMType type) {
+  // Only pipeline 0 receives data. Each data holds one element of memory (mem2) until the main thread releases it,
+  // and the main thread holds sharedPoolSize + 1 data before releasing any, which is more than the memory reserved for
+  // pipeline 0. The graph can only make progress if pipeline 0 borrows from the shared pool.
+  size_t numPipelines = 2;
+  size_t reservedPoolSize = 2;
+  size_t numHeld = sharedPoolSize + 1;
+
+  auto taskGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
+
+  InputTask *inputTask = new InputTask(1, true, type);
+  OutputMemReleaseTask *outputTask = new OutputMemReleaseTask(0, type);
+  htgs::Bookkeeper<ProcessedData> *bk = new htgs::Bookkeeper<ProcessedData>();
+
+  taskGraph->setGraphConsumerTask(inputTask);
+  taskGraph->addEdge(inputTask, bk);
+  taskGraph->addRuleEdge(bk, new MemDistributeRule(0), outputTask);
+  taskGraph->addGraphProducerTask(outputTask);
+  taskGraph->addSharedMemoryManagerEdge("mem", inputTask, new SimpleMemoryAllocator(1), reservedPoolSize,
+                                        sharedPoolSize, type, 100);
+
+  std::shared_ptr<htgs::SharedMemoryPool<int>> sharedPool;
+  for (auto taskManager : *taskGraph->getTaskManagers()) {
+    auto memoryManager = dynamic_cast<htgs::MemoryManager<int> *>(taskManager->getTaskFunction());
+    if (memoryManager != nullptr)
+      sharedPool = memoryManager->getSharedPool();
+  }
+  ASSERT_NE(nullptr, sharedPool);
+
+  auto execPipeline = new htgs::ExecutionPipeline<InputData, ProcessedData>(numPipelines, taskGraph);
+  execPipeline->addInputRule(new SimpleDecompRule());
+
+  auto mainGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
+  mainGraph->setGraphConsumerTask(execPipeline);
+  mainGraph->addGraphProducerTask(execPipeline);
+
+  htgs::TaskGraphRuntime *rt = new htgs::TaskGraphRuntime(mainGraph);
+
+  for (size_t i = 0; i < numDataGen; i++)
+    mainGraph->produceData(new InputData(i, 0));
+
+  mainGraph->finishedProducingData();
+
+  rt->executeRuntime();
+
+  size_t count = 0;
+  std::list<std::shared_ptr<ProcessedData>> held;
+  bool stalled = false;
+  while (!mainGraph->isOutputTerminated()) {
+    auto start = std::chrono::steady_clock::now();
+    auto data = mainGraph->pollData(1000000);
+    if (data != nullptr) {
+      count++;
+      held.push_back(data);
+    } else if (!held.empty() && std::chrono::steady_clock::now() - start >= std::chrono::seconds(1)) {
+      // Pipeline 0 did not borrow, release the held memory so that the graph can finish
+      stalled = true;
+    }
+
+    if (count >= numHeld || stalled) {
+      for (auto heldData : held)
+        heldData->getMem2()->releaseMemory();
+      held.clear();
+    }
+  }
+
+  rt->waitForRuntime();
+
+  EXPECT_FALSE(stalled);
+  EXPECT_EQ(numDataGen, count);
+  EXPECT_GT(sharedPool->getMaxLent(), 0);
+  EXPECT_GE(sharedPool->getMaxLent(), numHeld - reservedPoolSize);
+  EXPECT_NO_FATAL_FAILURE(delete rt);
+}
+
+void multiReleaseBatchGraphExecution(size_t numDataGen, size_t numReleasers, size_t numPipelines, htgs::MMType type) {
+  auto graph = createMultiReleaseGraph(numPipelines, numReleasers, false, false, type, false, true);
+  EXPECT_NO_FATAL_FAILURE(launchGraph(graph, numDataGen, numPipelines, numReleasers, false, false, type));
+}
+
+void multiReleaseSharedBatchGraphExecution(size_t numDataGen, size_t batchSize, size_t numPipelines, htgs::MMType type) {
+  // Each pipeline reserves one element of memory, so every batch is only acquired once the waiting batch has been
+  // covered with memory borrowed from the shared pool, while the reserved memory is still queued.
+  auto taskGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
+
+  InputTask *inputTask = new InputTask(batchSize, false, type, true);
+  htgs::Bookkeeper<ProcessedData> *bk = new htgs::Bookkeeper<ProcessedData>();
+
+  taskGraph->setGraphConsumerTask(inputTask);
+  taskGraph->addEdge(inputTask, bk);
+  taskGraph->addSharedMemoryManagerEdge("mem", inputTask, new SimpleMemoryAllocator(1), 1, batchSize, type, 100);
+
+  for (size_t i = 0; i < batchSize; i++) {
+    OutputMemReleaseTask *outputTask = new OutputMemReleaseTask(i, type);
+    taskGraph->addRuleEdge(bk, new MemDistributeRule(i), outputTask);
+    taskGraph->addGraphProducerTask(outputTask);
+  }
+
+  auto execPipeline = new htgs::ExecutionPipeline<InputData, ProcessedData>(numPipelines, taskGraph);
+  execPipeline->addInputRule(new SimpleDecompRule());
+
+  auto mainGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
+  mainGraph->setGraphConsumerTask(execPipeline);
+  mainGraph->addGraphProducerTask(execPipeline);
+
+  EXPECT_NO_FATAL_FAILURE(launchGraph(mainGraph, numDataGen, numPipelines, batchSize, false, false, type));
+}
+
+void multiReleaseBatchExceedsPool(size_t poolSize, size_t sharedPoolSize, htgs::MMType type) {
+  auto taskGraph = new htgs::TaskGraphConf<InputData, ProcessedData>();
+  InputTask *inputTask = new InputTask(1, false, type, true);
+  taskGraph->setGraphConsumerTask(inputTask);
+
+  SimpleMemoryAllocator *allocator = new SimpleMemoryAllocator(1);
+  if (sharedPoolSize > 0)
+    taskGraph->addSharedMemoryManagerEdge("mem", inputTask, allocator, poolSize, sharedPoolSize, type, 100);
+  else
+    taskGraph->addMemoryManagerEdge("mem", inputTask, allocator, poolSize, type);
+
+  // A batch larger than the pool and shared pool combined can never be acquired
+  size_t count = poolSize + sharedPoolSize + 1;
+  switch (type) {
+    case htgs::MMType::Static:
+      EXPECT_THROW(inputTask->getMemoryBatch<int>("mem", count, []() { return new SimpleReleaseRule(); }),
+                   std::runtime_error);
+      break;
+    case htgs::MMType::Dynamic:
+      EXPECT_THROW(inputTask->getDynamicMemoryBatch<int>("mem", count, []() { return new SimpleReleaseRule(); }, 1),
+                   std::runtime_error);
+      break;
+  }
+
+  delete taskGraph;
+}
@@ -15,5 +15,10 @@
 
 void multiReleaseGraphCreation(bool useSeparateEdge, bool useGraphReleaser, htgs::MMType type);
 void multiReleaseGraphExecution(size_t numDataGen, size_t numReleasers, size_t numPipelines, bool useSeparateEdge, bool useGraphReleaser, htgs::MMType type);
+void multiReleaseSharedGraphExecution(size_t numDataGen, size_t numReleasers, size_t numPipelines, htgs::MMType type);
+void multiReleaseSharedSkewedGraphExecution(size_t numDataGen, size_t sharedPoolSize, htgs::MMType type);
+void multiReleaseBatchGraphExecution(size_t numDataGen, size_t numReleasers, size_t numPipelines, htgs::MMType type);
+void multiReleaseSharedBatchGraphExecution(size_t numDataGen, size_t batchSize, size_t numPipelines, htgs::MMType type);
+void multiReleaseBatchExceedsPool(size_t poolSize, size_t sharedPoolSize, htgs::MMType type);
 
 #endif //HTGS_MEMMULTIRELEASEGRAPHTESTS_H
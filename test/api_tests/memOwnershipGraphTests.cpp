@@ -0,0 +1,105 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <thread>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/core/memory/MemoryOwnershipTracker.hpp>
+
+#include "memOwnershipGraphTests.h"
+#include "memOwnership/tasks/AcquireTask.h"
+#include "memOwnership/tasks/ReleaseTask.h"
+#include "memMultiRelease/memory/SimpleMemoryAllocator.h"
+
+std::shared_ptr<htgs::MemoryOwnershipTracker> findOwnershipTracker(std::string memoryEdgeName)
+{
+  for (auto tracker : htgs::MemoryOwnershipTracker::getTrackers())
+    if (tracker->getMemoryEdgeName() == memoryEdgeName)
+      return tracker;
+  return nullptr;
+}
+
+void memOwnershipGraphExecution(int numData, int numLeaked, size_t poolSize)
+{
+  htgs::MemoryOwnershipTracker::setEnabled(true);
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, OwnedData>();
+  AcquireTask *acquireTask = new AcquireTask();
+  ReleaseTask *releaseTask = new ReleaseTask(numLeaked);
+
+  taskGraph->setGraphConsumerTask(acquireTask);
+  taskGraph->addEdge(acquireTask, releaseTask);
+  taskGraph->addGraphProducerTask(releaseTask);
+  taskGraph->addMemoryManagerEdge("ownershipBuffers", acquireTask, new SimpleMemoryAllocator(1), poolSize,
+                                  htgs::MMType::Static);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+
+  std::list<std::shared_ptr<OwnedData>> outputs;
+  for (int i = 0; i < numData; i++)
+    outputs.push_back(taskGraph->consumeData());
+
+  std::shared_ptr<htgs::MemoryOwnershipTracker> tracker = findOwnershipTracker("ownershipBuffers");
+  ASSERT_NE(nullptr, tracker);
+
+  // The memory manager may still be processing the last releases, so wait for it to catch up before shutting down
+  for (int i = 0; i < 5000 && tracker->getOutstanding().size() != (size_t) numLeaked; i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  taskGraph->finishedProducingData();
+  runtime->waitForRuntime();
+
+  EXPECT_EQ((size_t) numData, tracker->getNumAcquired());
+  EXPECT_EQ(poolSize, tracker->getPoolSize());
+
+  // Only the memory that was released once is still held
+  std::vector<htgs::MemoryOwnership> outstanding = tracker->getOutstanding();
+  ASSERT_EQ((size_t) numLeaked, outstanding.size());
+  for (auto &ownership : outstanding) {
+    EXPECT_EQ("AcquireTask", ownership.taskName);
+    EXPECT_EQ((size_t) 0, ownership.pipelineId);
+    EXPECT_EQ((size_t) 1, ownership.numReleases);
+    EXPECT_EQ("1 of 2 releases", ownership.releaseRuleState);
+  }
+
+  for (size_t i = 1; i < outstanding.size(); i++)
+    EXPECT_LE(outstanding[i - 1].acquireTime, outstanding[i].acquireTime);
+
+  EXPECT_EQ((size_t) numLeaked, tracker->getNumHeldByTask()["AcquireTask (pipeline 0)"]);
+
+  std::ostringstream report;
+  htgs::MemoryOwnershipTracker::writeAllReports(report);
+  EXPECT_NE(std::string::npos, report.str().find(
+      "Memory edge 'ownershipBuffers' (pipeline 0): " + std::to_string(numLeaked) + " of " + std::to_string(poolSize)
+          + " held"));
+  if (numLeaked > 0) {
+    EXPECT_NE(std::string::npos, report.str().find("release rule: 1 of 2 releases"));
+  }
+
+  // The report written from a signal handler is the same while no tracker is locked
+  std::ostringstream dump;
+  htgs::MemoryOwnershipTracker::dumpAllReports(dump);
+  EXPECT_NE(std::string::npos, dump.str().find(
+      "Memory edge 'ownershipBuffers' (pipeline 0): " + std::to_string(numLeaked) + " of " + std::to_string(poolSize)
+          + " held"));
+  EXPECT_EQ(std::string::npos, dump.str().find("skipped"));
+
+  htgs::MemoryOwnershipTracker::setEnabled(false);
+  outputs.clear();
+  tracker = nullptr;
+  delete runtime;
+
+  EXPECT_EQ(nullptr, findOwnershipTracker("ownershipBuffers"));
+}
@@ -0,0 +1,84 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "multiVersionGraphTests.h"
+#include "multiVersion/tasks/VariantTask.h"
+#include "multiVersion/tasks/RejectingMultiVersionTask.h"
+
+// Gets the most capable ISA supported by the CPU other than Scalar, or AVX512 if only Scalar is supported
+static htgs::ISAType getVectorISA() {
+  htgs::ISAType isas[] = {htgs::ISAType::AVX512, htgs::ISAType::AVX2, htgs::ISAType::AVX, htgs::ISAType::SSE42};
+  for (htgs::ISAType isa : isas) {
+    if (htgs::isISASupported(isa))
+      return isa;
+  }
+  return htgs::ISAType::AVX512;
+}
+
+void multiVersionCalibrationFallback(int numData) {
+  std::atomic_int numScalarExecuted(0);
+  std::atomic_int numVectorExecuted(0);
+  std::atomic_int numRejected(0);
+
+  htgs::ISAType vectorISA = getVectorISA();
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  auto task = new RejectingMultiVersionTask(1, vectorISA, &numRejected);
+  task->addVariant(htgs::ISAType::Scalar, new VariantTask(&numScalarExecuted));
+  task->addVariant(vectorISA, new VariantTask(&numVectorExecuted));
+
+  taskGraph->setGraphConsumerTask(task);
+  taskGraph->addGraphProducerTask(task);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(new SimpleData(i, 0));
+  taskGraph->finishedProducingData();
+
+  int count = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr)
+      count++;
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, count);
+  EXPECT_EQ(numData, numScalarExecuted);
+  EXPECT_EQ(0, numVectorExecuted);
+
+  // The vector variant is only calibrated if the CPU supports it
+  EXPECT_EQ(htgs::isISASupported(vectorISA) ? 1 : 0, numRejected);
+
+  EXPECT_EQ(htgs::ISAType::Scalar, task->getSelectedISA());
+  EXPECT_NE(nullptr, task->getSelectedVariant());
+  EXPECT_NE(std::string::npos, task->getDotCustomProfile().find("ISA: " + htgs::isaTypeName(htgs::ISAType::Scalar)));
+
+  delete runtime;
+}
+
+void multiVersionNoVariantSelected() {
+  std::atomic_int numScalarExecuted(0);
+  std::atomic_int numRejected(0);
+
+  auto task = new RejectingMultiVersionTask(1, htgs::ISAType::Scalar, &numRejected);
+  task->addVariant(htgs::ISAType::Scalar, new VariantTask(&numScalarExecuted));
+
+  EXPECT_THROW(task->initialize(), std::runtime_error);
+  EXPECT_EQ(1, numRejected);
+  EXPECT_EQ(nullptr, task->getSelectedVariant());
+
+  delete task;
+}
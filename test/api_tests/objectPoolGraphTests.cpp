@@ -0,0 +1,56 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "objectPoolGraphTests.h"
+#include "objectPool/memory/WorkspaceAllocator.h"
+#include "objectPool/tasks/FillWorkspaceTask.h"
+#include "objectPool/tasks/ReleaseWorkspaceTask.h"
+
+void objectPoolGraphExecution(int numData, size_t numThreads, size_t poolSize)
+{
+  auto counts = std::make_shared<WorkspaceCounts>();
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  FillWorkspaceTask *fillTask = new FillWorkspaceTask(numThreads);
+  ReleaseWorkspaceTask *releaseTask = new ReleaseWorkspaceTask();
+
+  taskGraph->setGraphConsumerTask(fillTask);
+  taskGraph->addEdge(fillTask, releaseTask);
+  taskGraph->addGraphProducerTask(releaseTask);
+  taskGraph->addObjectPoolEdge("workspaces", fillTask, new WorkspaceAllocator(64, counts), poolSize);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+
+  for (int i = 0; i < numData; i++)
+    EXPECT_NE(nullptr, taskGraph->consumeData());
+
+  // The memory manager may still be recycling the last releases, so wait for it to catch up before shutting down
+  for (int i = 0; i < 5000 && counts->numReset.load() != numData; i++)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  taskGraph->finishedProducingData();
+  runtime->waitForRuntime();
+
+  // Objects are only constructed when the pool is created, and are reset each time they are recycled
+  EXPECT_EQ((int) poolSize, counts->numCreated.load());
+  EXPECT_EQ(numData, counts->numReset.load());
+  EXPECT_EQ(0, counts->numDirty.load());
+
+  delete runtime;
+
+  EXPECT_EQ((int) poolSize, counts->numDestroyed.load());
+}
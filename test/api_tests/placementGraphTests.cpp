@@ -0,0 +1,155 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/TaskPlacement.hpp>
+
+#include "placementGraphTests.h"
+#include "placement/tasks/ForwardTask.h"
+
+htgs::TaskGraphConf<SimpleData, SimpleData> *createPlacementGraph(size_t numThreads)
+{
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+
+  ForwardTask *a = new ForwardTask(1, "A");
+  ForwardTask *b = new ForwardTask(1, "B");
+  ForwardTask *c = new ForwardTask(numThreads, "C");
+  ForwardTask *d = new ForwardTask(1, "D");
+
+  taskGraph->setGraphConsumerTask(a);
+  taskGraph->addEdge(a, b);
+  taskGraph->addEdge(b, c);
+  taskGraph->addEdge(c, d);
+  taskGraph->addGraphProducerTask(d);
+
+  return taskGraph;
+}
+
+void placementTopology()
+{
+  std::vector<int> cpus = htgs::CpuTopology::parseCpuList("0-3,8,10-11");
+  EXPECT_EQ(std::vector<int>({0, 1, 2, 3, 8, 10, 11}), cpus);
+
+  htgs::CpuTopology topology = htgs::CpuTopology::detect();
+  EXPECT_GE(topology.getNumCpus(), (size_t) 1);
+
+#ifdef __linux__
+  // Only the CPUs the process may run on are detected
+  std::vector<int> allowedCpus = htgs::CpuTopology::getAllowedCpus();
+  ASSERT_FALSE(allowedCpus.empty());
+  for (size_t d = 0; d < topology.getCacheDomains().size(); d++)
+    for (int cpu : topology.getDomainCpus(d))
+      EXPECT_NE(allowedCpus.end(), std::find(allowedCpus.begin(), allowedCpus.end(), cpu)) << "cpu " << cpu;
+
+  // Unbinding a thread restores the CPUs it could run on before it was bound
+  std::thread bindingThread([&]() {
+    auto currentCpus = []() {
+      cpu_set_t cpuSet;
+      sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet);
+      return CPU_COUNT(&cpuSet);
+    };
+
+    ASSERT_TRUE(htgs::CpuTopology::bindThread(allowedCpus.back()));
+    EXPECT_EQ(1, currentCpus());
+    EXPECT_EQ(allowedCpus, htgs::CpuTopology::getAllowedCpus());
+    ASSERT_TRUE(htgs::CpuTopology::bindThread(-1));
+    EXPECT_EQ((int) allowedCpus.size(), currentCpus());
+  });
+  bindingThread.join();
+#endif
+
+  htgs::CpuTopology twoDomains({{{0, 1}, {2, 3}}, {{4, 5}, {6, 7}}});
+  EXPECT_EQ((size_t) 8, twoDomains.getNumCpus());
+  EXPECT_EQ(std::vector<int>({4, 5, 6, 7}), twoDomains.getDomainCpus(1));
+
+  size_t domain = 0, coreGroup = 0;
+  EXPECT_TRUE(twoDomains.findCpu(6, domain, coreGroup));
+  EXPECT_EQ((size_t) 1, domain);
+  EXPECT_EQ((size_t) 1, coreGroup);
+  EXPECT_FALSE(twoDomains.findCpu(8, domain, coreGroup));
+}
+
+void placementCompute()
+{
+  auto taskGraph = createPlacementGraph(1);
+
+  // A and B, and C and D, exchange the most data so each pair shares a core
+  htgs::TaskPlacement placement(htgs::CpuTopology({{{0, 1}, {2, 3}}, {{4, 5}, {6, 7}}}));
+  placement.setTraffic("A/0", "B/0", 1000);
+  placement.setTraffic("B/0", "C/0", 1);
+  placement.setTraffic("C/0", "D/0", 1000);
+
+  htgs::TaskPlacement::Placement result = placement.computePlacement(taskGraph->getTaskManagers());
+  ASSERT_EQ((size_t) 4, result.size());
+
+  auto coreGroupOf = [&](std::string task) {
+    size_t domain = 0, coreGroup = 0;
+    EXPECT_TRUE(placement.getTopology().findCpu(result[task][0], domain, coreGroup));
+    return std::make_pair(domain, coreGroup);
+  };
+
+  EXPECT_EQ(coreGroupOf("A/0"), coreGroupOf("B/0"));
+  EXPECT_EQ(coreGroupOf("C/0"), coreGroupOf("D/0"));
+  EXPECT_NE(coreGroupOf("A/0"), coreGroupOf("C/0"));
+
+  // With two CPUs per cache domain the heavy pairs are split across the domains
+  htgs::TaskPlacement smallDomains(htgs::CpuTopology({{{0}, {1}}, {{2}, {3}}}));
+  smallDomains.setTraffic("A/0", "B/0", 1000);
+  smallDomains.setTraffic("B/0", "C/0", 1);
+  smallDomains.setTraffic("C/0", "D/0", 1000);
+  result = smallDomains.computePlacement(taskGraph->getTaskManagers());
+
+  auto domainOf = [&](std::string task) { return result[task][0] / 2; };
+  EXPECT_EQ(domainOf("A/0"), domainOf("B/0"));
+  EXPECT_EQ(domainOf("C/0"), domainOf("D/0"));
+  EXPECT_NE(domainOf("A/0"), domainOf("C/0"));
+
+  delete taskGraph;
+}
+
+void placementGraphExecution(int numData, size_t numThreads)
+{
+  std::shared_ptr<htgs::TaskPlacement> placement = std::make_shared<htgs::TaskPlacement>();
+
+  for (int run = 0; run < 2; run++) {
+    auto taskGraph = createPlacementGraph(numThreads);
+    auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+    runtime->setTaskPlacement(placement);
+    runtime->executeRuntime();
+
+    for (int i = 0; i < numData; i++)
+      taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+
+    // Recomputing the placement while data is flowing moves the threads between data
+    runtime->updatePlacement();
+    taskGraph->finishedProducingData();
+
+    int numReceived = 0;
+    while (!taskGraph->isOutputTerminated()) {
+      auto data = taskGraph->consumeData();
+      if (data != nullptr)
+        numReceived++;
+    }
+
+    runtime->waitForRuntime();
+
+    EXPECT_EQ(numData, numReceived);
+    for (htgs::AnyTaskManager *taskManager : *taskGraph->getTaskManagers())
+      EXPECT_GE(taskManager->getCpuAffinity(), 0);
+
+    EXPECT_EQ((size_t) numData, placement->getTraffic("A/0", "B/0"));
+    EXPECT_EQ((size_t) numData, placement->getTraffic("C/0", "D/0"));
+
+    delete runtime;
+  }
+}
@@ -0,0 +1,50 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#ifndef HTGS_PREFETCHCOUNTTASK_H
+#define HTGS_PREFETCHCOUNTTASK_H
+
+#include <atomic>
+#include <vector>
+#include <htgs/api/ITask.hpp>
+#include "../../simple/data/SimpleData.h"
+
+class PrefetchCountTask : public htgs::ITask<SimpleData, SimpleData> {
+ public:
+  PrefetchCountTask(size_t numThreads, size_t prefetchDepth, std::vector<std::atomic_int> *numPrefetches,
+                    std::vector<std::atomic_bool> *executed, std::atomic_size_t *numPrefetchedAfterExecute) :
+      ITask(numThreads), prefetchDepth(prefetchDepth), numPrefetches(numPrefetches), executed(executed),
+      numPrefetchedAfterExecute(numPrefetchedAfterExecute) {}
+
+  void prefetch(std::shared_ptr<SimpleData> next) override {
+    (*numPrefetches)[next->getValue()]++;
+    if ((*executed)[next->getValue()])
+      (*numPrefetchedAfterExecute)++;
+  }
+
+  size_t getPrefetchDepth() override { return prefetchDepth; }
+
+  void executeTask(std::shared_ptr<SimpleData> data) override {
+    (*executed)[data->getValue()] = true;
+    addResult(data);
+  }
+
+  std::string getName() override { return "PrefetchCountTask"; }
+
+  PrefetchCountTask *copy() override {
+    return new PrefetchCountTask(this->getNumThreads(), prefetchDepth, numPrefetches, executed,
+                                 numPrefetchedAfterExecute);
+  }
+
+ private:
+  size_t prefetchDepth;
+  std::vector<std::atomic_int> *numPrefetches;
+  std::vector<std::atomic_bool> *executed;
+  std::atomic_size_t *numPrefetchedAfterExecute;
+};
+
+#endif //HTGS_PREFETCHCOUNTTASK_H
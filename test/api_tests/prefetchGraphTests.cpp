@@ -0,0 +1,65 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "prefetchGraphTests.h"
+#include "prefetch/tasks/PrefetchCountTask.h"
+
+void prefetchGraphExecution(int numData, size_t numThreads, size_t prefetchDepth)
+{
+  std::vector<std::atomic_int> numPrefetches((size_t) numData);
+  std::vector<std::atomic_bool> executed((size_t) numData);
+  std::atomic_size_t numPrefetchedAfterExecute(0);
+  for (int i = 0; i < numData; i++) {
+    numPrefetches[i] = 0;
+    executed[i] = false;
+  }
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  auto task = new PrefetchCountTask(numThreads, prefetchDepth, &numPrefetches, &executed,
+                                    &numPrefetchedAfterExecute);
+
+  taskGraph->setGraphConsumerTask(task);
+  taskGraph->addGraphProducerTask(task);
+
+  // All data is queued before the task starts, so every data but the first is queued behind other data
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(new SimpleData(i, 0));
+  taskGraph->finishedProducingData();
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  int count = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr)
+      count++;
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, count);
+
+  for (int i = 0; i < numData; i++) {
+    EXPECT_TRUE(executed[i]);
+    EXPECT_LE(numPrefetches[i], 1) << "data " << i << " was prefetched more than once";
+  }
+
+  if (numThreads == 1) {
+    EXPECT_EQ(0, numPrefetches[0]);
+    for (int i = 1; i < numData; i++)
+      EXPECT_EQ(1, numPrefetches[i]) << "data " << i << " was not prefetched";
+    EXPECT_EQ((size_t) 0, numPrefetchedAfterExecute.load());
+  }
+
+  delete runtime;
+}
@@ -0,0 +1,103 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/FairShareScheduler.hpp>
+
+#include "pullGraphTests.h"
+#include "pull/tasks/EvenFilterTask.h"
+#include "pull/tasks/GeneratorTask.h"
+
+htgs::TaskGraphConf<htgs::VoidData, SimpleData> *createPullGraph(size_t numThreads, int maxCount,
+                                                                 std::shared_ptr<std::atomic_int> numGenerated)
+{
+  auto tg = new htgs::TaskGraphConf<htgs::VoidData, SimpleData>();
+  auto generator = new GeneratorTask(maxCount, numGenerated);
+  auto filter = new EvenFilterTask(numThreads);
+
+  tg->setGraphConsumerTask(generator);
+  tg->addEdge(generator, filter);
+  tg->addGraphProducerTask(filter);
+
+  return tg;
+}
+
+void pullGraphTopK(size_t numThreads, int k, bool pull)
+{
+  int maxCount = 100000;
+  auto numGenerated = std::make_shared<std::atomic_int>(0);
+  auto tg = createPullGraph(numThreads, maxCount, numGenerated);
+  if (pull)
+    tg->enablePullExecution();
+  EXPECT_EQ(pull, tg->isPullExecution());
+
+  auto runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+  tg->finishedProducingData();
+
+  tg->requestData((size_t) k);
+  std::list<std::shared_ptr<SimpleData>> results;
+  while ((int) results.size() < k && !tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr)
+      results.push_back(data);
+  }
+  tg->finishedRequestingData();
+
+  while (!tg->isOutputTerminated())
+    tg->consumeData();
+
+  runtime->waitForRuntime();
+  delete runtime;
+
+  ASSERT_EQ((size_t) k, results.size());
+  for (auto &data : results)
+    EXPECT_EQ(0, data->getValue() % 2);
+
+  if (pull) {
+    // Each filter thread pulls at most one number beyond the 2k that are needed
+    EXPECT_LE(numGenerated->load(), 2 * k + (int) numThreads);
+    EXPECT_GE(numGenerated->load(), 2 * k - 1);
+  } else {
+    EXPECT_EQ(maxCount, numGenerated->load());
+  }
+}
+
+void pullGraphExhausted(size_t numThreads, int maxCount, size_t coreBudget)
+{
+  auto numGenerated = std::make_shared<std::atomic_int>(0);
+  auto tg = createPullGraph(numThreads, maxCount, numGenerated);
+  tg->enablePullExecution();
+
+  // The generator waits for demand while the filter needs a slot to request more data
+  htgs::FairShareScheduler scheduler(coreBudget == 0 ? 1 : coreBudget);
+
+  auto runtime = new htgs::TaskGraphRuntime(tg);
+  if (coreBudget > 0)
+    runtime->registerFairShare(scheduler, "pull", 1.0);
+  runtime->executeRuntime();
+  tg->finishedProducingData();
+
+  // Requests one number at a time until the generator runs out
+  std::set<int> results;
+  while (!tg->isOutputTerminated()) {
+    tg->requestData(1);
+    auto data = tg->consumeData();
+    if (data != nullptr)
+      results.insert(data->getValue());
+  }
+
+  runtime->waitForRuntime();
+  delete runtime;
+
+  EXPECT_EQ(maxCount, numGenerated->load());
+  EXPECT_EQ((size_t) (maxCount + 1) / 2, results.size());
+}
@@ -0,0 +1,120 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <htgs/api/ResourceRegistry.hpp>
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+
+#include "resourceGraphTests.h"
+#include "resource/tasks/BandwidthTask.h"
+
+void resourceClassLimit()
+{
+  htgs::ResourceRegistry registry;
+  registry.setLimit("membw", 1);
+
+  // Classes are acquired in order of their names, once each
+  auto classes = registry.getResourceClasses({"membw", "disk", "membw"});
+  ASSERT_EQ((size_t) 2, classes.size());
+  EXPECT_EQ("disk", classes[0]->getName());
+  EXPECT_EQ("membw", classes[1]->getName());
+  EXPECT_EQ((size_t) 0, classes[0]->getLimit());
+
+  std::shared_ptr<htgs::ResourceClass> membw = registry.getResourceClass("membw");
+  EXPECT_EQ(classes[1], membw);
+
+  // A second thread is parked until the slot is released
+  membw->acquire();
+  std::atomic_bool acquired(false);
+  std::thread waiter([&] {
+    membw->acquire();
+    acquired = true;
+    membw->release();
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(acquired);
+  EXPECT_EQ((size_t) 1, membw->getNumRunning());
+
+  membw->release();
+  waiter.join();
+
+  EXPECT_TRUE(acquired);
+  EXPECT_EQ((size_t) 0, membw->getNumRunning());
+  EXPECT_EQ((size_t) 1, membw->getMaxRunning());
+  EXPECT_EQ((size_t) 2, membw->getNumAcquired());
+  EXPECT_EQ((size_t) 1, membw->getNumWaits());
+  EXPECT_GT(membw->getWaitTime(), 0ULL);
+
+  // Raising the limit wakes parked threads
+  membw->acquire();
+  std::thread raised([&] {
+    membw->acquire();
+    membw->release();
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  membw->setLimit(2);
+  raised.join();
+  membw->release();
+  EXPECT_EQ((size_t) 2, membw->getMaxRunning());
+}
+
+void resourceGraphExecution(int numData, size_t numThreads, size_t limit)
+{
+  std::shared_ptr<htgs::ResourceRegistry> registry = std::make_shared<htgs::ResourceRegistry>();
+  registry->setLimit("membw", limit);
+
+  // Two tasks share the memory bandwidth, so the limit applies to their threads together
+  std::shared_ptr<ActiveCounter> counter = std::make_shared<ActiveCounter>();
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  BandwidthTask *copyIn = new BandwidthTask(numThreads, "CopyIn", {"membw"}, counter);
+  BandwidthTask *copyOut = new BandwidthTask(numThreads, "CopyOut", {"membw"}, counter);
+
+  taskGraph->setGraphConsumerTask(copyIn);
+  taskGraph->addEdge(copyIn, copyOut);
+  taskGraph->addGraphProducerTask(copyOut);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->setResourceRegistry(registry);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+  taskGraph->finishedProducingData();
+
+  int numReceived = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr)
+      numReceived++;
+  }
+
+  runtime->waitForRuntime();
+
+  std::shared_ptr<htgs::ResourceClass> membw = registry->getResourceClass("membw");
+  EXPECT_EQ(numData, numReceived);
+  EXPECT_EQ((size_t) 0, membw->getNumRunning());
+
+  // Each data is executed by both tasks, and each task executes a final time
+  EXPECT_EQ((size_t) (2 * numData + 2), membw->getNumAcquired());
+
+  if (limit > 0) {
+    EXPECT_LE((size_t) counter->peak, limit);
+    EXPECT_LE(membw->getMaxRunning(), limit);
+    if (2 * numThreads > limit) {
+      EXPECT_GT(membw->getNumWaits(), (size_t) 0);
+    }
+  } else {
+    EXPECT_EQ((size_t) 0, membw->getNumWaits());
+  }
+
+  delete runtime;
+}
@@ -0,0 +1,52 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#ifndef HTGS_SCRATCHTASK_H
+#define HTGS_SCRATCHTASK_H
+
+#include <cstdint>
+#include <htgs/api/ITask.hpp>
+#include "../../simple/data/SimpleData.h"
+#include "../data/ScratchResultData.h"
+
+struct alignas(64) ScratchLine {
+  double values[8];
+};
+
+class ScratchTask : public htgs::ITask<SimpleData, ScratchResultData> {
+ public:
+  ScratchTask(size_t numThreads) : ITask(numThreads) {}
+
+  void executeTask(std::shared_ptr<SimpleData> data) override {
+    int value = data->getValue();
+    size_t count = 1000 + (size_t) (value % 5) * 1000;
+
+    double *buffer = this->scratchAlloc<double>(count);
+    char *bytes = this->scratchAlloc<char>((size_t) value % 7 + 1);
+    ScratchLine *lines = this->scratchAlloc<ScratchLine>(count / 8);
+
+    // Alignment must hold even after an odd-sized allocation
+    bool aligned = reinterpret_cast<uintptr_t>(buffer) % alignof(double) == 0
+        && reinterpret_cast<uintptr_t>(lines) % alignof(ScratchLine) == 0;
+
+    bytes[0] = 1;
+    for (size_t i = 0; i < count; i++)
+      buffer[i] = value + (double) i;
+    for (size_t i = 0; i < count / 8; i++)
+      lines[i].values[0] = buffer[i * 8];
+
+    double *owned = this->promoteScratch(buffer, count);
+    addResult(new ScratchResultData(aligned ? value : -1, owned, count,
+                                    this->getOwnerTaskManager()->getScratchArena()->getNumBlockAllocations()));
+  }
+
+  std::string getName() override { return "ScratchTask"; }
+
+  ScratchTask *copy() override { return new ScratchTask(this->getNumThreads()); }
+};
+
+#endif //HTGS_SCRATCHTASK_H
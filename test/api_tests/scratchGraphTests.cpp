@@ -0,0 +1,89 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/core/memory/ScratchArena.hpp>
+
+#include "scratchGraphTests.h"
+#include "scratch/tasks/ScratchTask.h"
+
+void scratchArenaReuse()
+{
+  htgs::ScratchArena arena;
+  EXPECT_EQ((size_t) 0, arena.getCapacity());
+
+  // Growing past the first block adds blocks, which are merged into one block on reset
+  for (int i = 0; i < 10; i++)
+    EXPECT_NE(nullptr, arena.allocate(3000, 8));
+  size_t numBlocks = arena.getNumBlockAllocations();
+  EXPECT_LT((size_t) 1, numBlocks);
+
+  size_t capacity = arena.getCapacity();
+  arena.reset();
+  EXPECT_EQ(capacity, arena.getCapacity());
+  EXPECT_EQ(numBlocks + 1, arena.getNumBlockAllocations());
+
+  // The same allocations now fit without allocating
+  std::set<void *> addresses;
+  for (int i = 0; i < 10; i++)
+    addresses.insert(arena.allocate(3000, 8));
+  EXPECT_EQ((size_t) 10, addresses.size());
+  EXPECT_EQ(numBlocks + 1, arena.getNumBlockAllocations());
+
+  arena.reset();
+  void *first = arena.allocate(3000, 8);
+  EXPECT_EQ(*addresses.begin(), first);
+
+  void *aligned = arena.allocate(1, 256);
+  EXPECT_EQ((uintptr_t) 0, reinterpret_cast<uintptr_t>(aligned) % 256);
+}
+
+void scratchGraphExecution(int numData, size_t numThreads)
+{
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, ScratchResultData>();
+  ScratchTask *scratchTask = new ScratchTask(numThreads);
+
+  taskGraph->setGraphConsumerTask(scratchTask);
+  taskGraph->addGraphProducerTask(scratchTask);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+
+  taskGraph->finishedProducingData();
+
+  int numReceived = 0;
+  size_t maxBlockAllocations = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr) {
+      numReceived++;
+      ASSERT_NE(-1, data->getValue());
+
+      // Promoted memory keeps its values after the arena is reset
+      for (size_t i = 0; i < data->getCount(); i++)
+        ASSERT_EQ(data->getValue() + (double) i, data->getBuffer()[i]);
+
+      maxBlockAllocations = std::max(maxBlockAllocations, data->getNumBlockAllocations());
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, numReceived);
+
+  // Each thread's arena stops allocating once it is large enough for one data
+  EXPECT_GE((size_t) 8, maxBlockAllocations);
+
+  delete runtime;
+}
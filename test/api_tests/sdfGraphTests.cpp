@@ -0,0 +1,132 @@
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <set>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/SdfTask.hpp>
+
+#include "sdfGraphTests.h"
+#include "sdf/tasks/SplitTask.h"
+#include "sdf/tasks/MultiplyTask.h"
+
+void sdfSchedule()
+{
+  auto sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  auto split = new SplitTask(4);
+  auto splitAgain = new SplitTask(2);
+  auto scale = new MultiplyTask(3);
+
+  // Edges may be added in any order
+  sdfTask->addEdge(splitAgain, scale, 2);
+  sdfTask->addEdge(split, splitAgain, 4);
+
+  EXPECT_EQ(3, sdfTask->getNumStages());
+  EXPECT_EQ("SplitTask (4 SplitTask (2 MultiplyTask))", sdfTask->getScheduleString());
+
+  std::vector<size_t> expected{1, 4, 8};
+  EXPECT_EQ(expected, sdfTask->getRepetitions());
+
+  auto copy = sdfTask->copy();
+  EXPECT_EQ(sdfTask->getScheduleString(), copy->getScheduleString());
+  EXPECT_EQ(expected, copy->getRepetitions());
+
+  delete copy;
+  delete sdfTask;
+}
+
+void sdfInvalidChains()
+{
+  // The rate must be greater than 0
+  auto sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  auto split = new SplitTask(4);
+  auto scale = new MultiplyTask(3);
+  EXPECT_THROW(sdfTask->addEdge(split, scale, 0), std::runtime_error);
+  delete sdfTask;
+
+  // A task can only have one consumer and one producer
+  sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  sdfTask->addEdge(split, scale, 4);
+  auto otherScale = new MultiplyTask(2);
+  EXPECT_THROW(sdfTask->addEdge(split, otherScale, 4), std::runtime_error);
+  auto otherSplit = new SplitTask(2);
+  EXPECT_THROW(sdfTask->addEdge(otherSplit, scale, 2), std::runtime_error);
+  EXPECT_EQ(2, sdfTask->getNumStages());
+  delete sdfTask;
+
+  // Two chains have two first tasks
+  sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  sdfTask->addEdge(new SplitTask(4), new MultiplyTask(3), 4);
+  sdfTask->addEdge(otherSplit, otherScale, 2);
+  EXPECT_THROW(sdfTask->getNumStages(), std::runtime_error);
+  EXPECT_THROW(sdfTask->copy(), std::runtime_error);
+  delete sdfTask;
+
+  // A cycle has no first task
+  sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  split = new SplitTask(4);
+  auto splitAgain = new SplitTask(2);
+  sdfTask->addEdge(split, splitAgain, 4);
+  sdfTask->addEdge(splitAgain, split, 2);
+  EXPECT_THROW(sdfTask->getScheduleString(), std::runtime_error);
+  delete sdfTask;
+
+  // A chain with a cycle beside it
+  sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(1);
+  split = new SplitTask(4);
+  splitAgain = new SplitTask(2);
+  sdfTask->addEdge(new SplitTask(4), new MultiplyTask(3), 4);
+  sdfTask->addEdge(split, splitAgain, 4);
+  sdfTask->addEdge(splitAgain, split, 2);
+  EXPECT_THROW(sdfTask->getRepetitions(), std::runtime_error);
+  delete sdfTask;
+}
+
+void sdfGraphExecution(size_t numThreads, int numData, size_t declaredRate)
+{
+  const int numParts = 4;
+  const int scale = 2;
+
+  auto tg = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  auto sdfTask = new htgs::SdfTask<SimpleData, SimpleData>(numThreads, "SplitScale");
+  sdfTask->addEdge(new SplitTask(numParts), new MultiplyTask(scale), declaredRate);
+
+  tg->setGraphConsumerTask(sdfTask);
+  tg->addGraphProducerTask(sdfTask);
+
+  auto runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    tg->produceData(new SimpleData(i, 0));
+  tg->finishedProducingData();
+
+  std::multiset<int> results;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr)
+      results.insert(data->getValue());
+  }
+
+  runtime->waitForRuntime();
+
+  // Thread 0 executes the SdfTask that was added to the graph
+  if (numThreads == 1) {
+    EXPECT_EQ(declaredRate == numParts ? 0 : (size_t) numData, sdfTask->getNumRateViolations());
+  }
+
+  delete runtime;
+
+  std::multiset<int> expected;
+  for (int i = 0; i < numData; i++)
+    for (int k = 0; k < numParts; k++)
+      expected.insert((i * numParts + k) * scale);
+
+  EXPECT_EQ(expected, results);
+}
@@ -0,0 +1,114 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/core/queue/SpscQueue.hpp>
+
+#include "spscGraphTests.h"
+#include "spsc/tasks/SequenceTask.h"
+
+void spscQueue(int numData)
+{
+  htgs::SpscQueue<std::shared_ptr<SimpleData>> queue;
+
+  EXPECT_TRUE(queue.isEmpty());
+  EXPECT_EQ(nullptr, queue.poll(1000));
+
+  std::thread producer([&]() {
+    for (int i = 0; i < numData; i++) {
+      queue.Enqueue(std::make_shared<SimpleData>(i, 0));
+      if (i % 1000 == 0)
+        queue.wakeup();
+    }
+  });
+
+  int nextValue = 0;
+  size_t numWakeups = 0;
+  while (nextValue < numData) {
+    std::shared_ptr<SimpleData> data = queue.Dequeue();
+    if (data == nullptr) {
+      numWakeups++;
+      continue;
+    }
+
+    ASSERT_EQ(nextValue, data->getValue());
+    nextValue++;
+  }
+
+  producer.join();
+
+  // The consumer stops after receiving all data, so it may not have taken the last wakeups
+  EXPECT_LE(numWakeups, (size_t) (numData + 999) / 1000);
+  EXPECT_TRUE(queue.isEmpty());
+
+  // Peek does not consume data
+  for (int i = 0; i < 300; i++)
+    queue.Enqueue(std::make_shared<SimpleData>(i, 0));
+
+  std::list<std::shared_ptr<SimpleData>> peeked = queue.peek(260);
+  EXPECT_EQ((size_t) 260, peeked.size());
+  EXPECT_EQ(259, peeked.back()->getValue());
+  EXPECT_EQ((size_t) 300, queue.size());
+  EXPECT_EQ(0, queue.Dequeue()->getValue());
+}
+
+void spscGraphExecution(int numData, size_t numThreads)
+{
+  std::atomic_bool usesSpsc[4];
+  std::atomic_size_t numOutOfOrder(0);
+
+  // Data is only checked for order while a single thread consumes each edge
+
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+
+  SequenceTask *first = new SequenceTask(1, "First", true, &usesSpsc[0], &numOutOfOrder);
+  SequenceTask *second = new SequenceTask(1, "Second", true, &usesSpsc[1], &numOutOfOrder);
+  SequenceTask *third = new SequenceTask(numThreads, "Third", numThreads == 1, &usesSpsc[2], &numOutOfOrder);
+  SequenceTask *fourth = new SequenceTask(1, "Fourth", numThreads == 1, &usesSpsc[3], &numOutOfOrder);
+
+  taskGraph->setGraphConsumerTask(first);
+  taskGraph->addEdge(first, second);
+  taskGraph->addEdge(second, third);
+  taskGraph->addEdge(third, fourth);
+  taskGraph->addGraphProducerTask(fourth);
+
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+  taskGraph->finishedProducingData();
+
+  int numReceived = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr) {
+      if (numThreads == 1) {
+        EXPECT_EQ(numReceived, data->getValue());
+      }
+      numReceived++;
+    }
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, numReceived);
+  EXPECT_EQ((size_t) 0, numOutOfOrder);
+
+  // The graph's input connector has external producers, and edges with more than one thread keep the blocking queue
+  EXPECT_FALSE(usesSpsc[0]);
+  EXPECT_TRUE(usesSpsc[1]);
+  EXPECT_EQ(numThreads == 1, usesSpsc[2]);
+  EXPECT_EQ(numThreads == 1, usesSpsc[3]);
+
+  delete runtime;
+}
@@ -0,0 +1,70 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#ifndef HTGS_TIMERTASK_H
+#define HTGS_TIMERTASK_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <htgs/api/ITask.hpp>
+#include "../../simple/data/SimpleData.h"
+
+class TimerTask : public htgs::ITask<SimpleData, SimpleData> {
+ public:
+  TimerTask(size_t numThreads, size_t microTimeoutTime, std::atomic_size_t *numPolls, std::atomic_size_t *numTimers) :
+      ITask(numThreads, false, true, microTimeoutTime), numPolls(numPolls), numTimers(numTimers) {}
+
+  void executeTask(std::shared_ptr<SimpleData> data) override {
+    if (data == nullptr) {
+      (*numPolls)++;
+      return;
+    }
+
+    // Each data schedules a timer that produces the data when it expires
+    uint64_t timerId = this->scheduleTimer(std::chrono::milliseconds(2));
+    std::unique_lock<std::mutex> lock(*pendingMutex);
+    pending->insert(std::make_pair(timerId, data));
+  }
+
+  void executeTimer(uint64_t timerId) override {
+    std::shared_ptr<SimpleData> data;
+    {
+      std::unique_lock<std::mutex> lock(*pendingMutex);
+      data = pending->at(timerId);
+      pending->erase(timerId);
+    }
+
+    (*numTimers)++;
+    addResult(data);
+  }
+
+  bool canTerminate(std::shared_ptr<htgs::AnyConnector> inputConnector) override {
+    std::unique_lock<std::mutex> lock(*pendingMutex);
+    return inputConnector->isInputTerminated() && pending->empty();
+  }
+
+  std::string getName() override { return "TimerTask"; }
+
+  TimerTask *copy() override {
+    TimerTask *task = new TimerTask(this->getNumThreads(), this->getMicroTimeoutTime(), numPolls, numTimers);
+    task->pending = pending;
+    task->pendingMutex = pendingMutex;
+    return task;
+  }
+
+ private:
+  std::atomic_size_t *numPolls;
+  std::atomic_size_t *numTimers;
+  // Shared by all copies, as timers are run by any thread of the task
+  std::shared_ptr<std::map<uint64_t, std::shared_ptr<SimpleData>>>
+      pending = std::make_shared<std::map<uint64_t, std::shared_ptr<SimpleData>>>();
+  std::shared_ptr<std::mutex> pendingMutex = std::make_shared<std::mutex>();
+};
+
+#endif //HTGS_TIMERTASK_H
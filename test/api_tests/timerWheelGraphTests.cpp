@@ -0,0 +1,116 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/TimerWheel.hpp>
+
+#include "timerWheelGraphTests.h"
+#include "timerWheel/tasks/TimerTask.h"
+
+void timerWheelOneShot()
+{
+  htgs::TimerWheel timerWheel(std::chrono::microseconds(100));
+
+  // Delays span the first two levels of the wheel
+  std::vector<std::chrono::microseconds> delays =
+      {std::chrono::microseconds(500), std::chrono::milliseconds(5), std::chrono::milliseconds(40),
+       std::chrono::milliseconds(120)};
+
+  auto start = std::chrono::steady_clock::now();
+  std::mutex mutex;
+  std::map<uint64_t, std::chrono::microseconds> elapsed;
+
+  std::map<uint64_t, std::chrono::microseconds> expected;
+  for (auto delay : delays) {
+    uint64_t timerId = timerWheel.schedule(delay, [&](uint64_t timerId) {
+      std::unique_lock<std::mutex> lock(mutex);
+      elapsed[timerId] = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+    });
+    expected[timerId] = delay;
+  }
+
+  uint64_t cancelled = timerWheel.schedule(std::chrono::milliseconds(10), [&](uint64_t timerId) {
+    std::unique_lock<std::mutex> lock(mutex);
+    elapsed[timerId] = std::chrono::microseconds(0);
+  });
+  EXPECT_TRUE(timerWheel.cancel(cancelled));
+  EXPECT_FALSE(timerWheel.cancel(cancelled));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  std::unique_lock<std::mutex> lock(mutex);
+  EXPECT_EQ(delays.size(), elapsed.size());
+  for (auto &timer : expected) {
+    ASSERT_TRUE(elapsed.find(timer.first) != elapsed.end());
+    EXPECT_GE(elapsed[timer.first].count(), timer.second.count());
+  }
+
+  EXPECT_EQ((size_t) 0, timerWheel.getNumTimers());
+}
+
+void timerWheelPeriodic()
+{
+  htgs::TimerWheel timerWheel(std::chrono::microseconds(100));
+  std::atomic_size_t count(0);
+
+  uint64_t timerId = timerWheel.schedulePeriodic(std::chrono::milliseconds(2), [&](uint64_t) { count++; });
+  std::this_thread::sleep_for(std::chrono::milliseconds(101));
+  EXPECT_TRUE(timerWheel.cancel(timerId));
+
+  size_t numFired = count;
+  EXPECT_GE(numFired, (size_t) 40);
+  EXPECT_LE(numFired, (size_t) 51);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_EQ(numFired, count);
+}
+
+void timerWheelGraphExecution(int numData, size_t numThreads)
+{
+  std::atomic_size_t numPolls(0);
+  std::atomic_size_t numTimers(0);
+  std::shared_ptr<htgs::TimerWheel> timerWheel = std::make_shared<htgs::TimerWheel>(std::chrono::microseconds(100));
+
+  auto tg = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+  TimerTask *task = new TimerTask(numThreads, 1000, &numPolls, &numTimers);
+  tg->setGraphConsumerTask(task);
+  tg->addGraphProducerTask(task);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->setTimerWheel(timerWheel);
+  runtime->executeRuntime();
+
+  // Idle polling task is driven by the timer wheel
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_GT(numPolls, (size_t) 0);
+
+  for (int i = 0; i < numData; i++)
+    tg->produceData(new SimpleData(i, 0));
+
+  tg->finishedProducingData();
+
+  int count = 0;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr)
+      count++;
+  }
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(numData, count);
+  EXPECT_EQ((size_t) numData, numTimers);
+
+  // The polling timers are cancelled when the task terminates
+  EXPECT_EQ((size_t) 0, timerWheel->getNumTimers());
+
+  delete runtime;
+}
@@ -0,0 +1,151 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+#include <cstdio>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/TuningProfile.hpp>
+
+#include "tuningGraphTests.h"
+#include "placement/tasks/ForwardTask.h"
+#include "tuning/memory/BufferAllocator.h"
+#include "tuning/tasks/PooledTask.h"
+
+htgs::TaskGraphConf<SimpleData, SimpleData> *createTuningGraph(size_t numThreads, size_t poolSize,
+                                                               PooledTask **pooled = nullptr,
+                                                               std::string pooledName = "P")
+{
+  auto taskGraph = new htgs::TaskGraphConf<SimpleData, SimpleData>();
+
+  ForwardTask *a = new ForwardTask(1, "A");
+  PooledTask *p = new PooledTask(numThreads, pooledName);
+  ForwardTask *d = new ForwardTask(1, "D");
+
+  taskGraph->setGraphConsumerTask(a);
+  taskGraph->addEdge(a, p);
+  taskGraph->addEdge(p, d);
+  taskGraph->addGraphProducerTask(d);
+  taskGraph->addMemoryManagerEdge("buffer", p, new BufferAllocator(1), poolSize, htgs::MMType::Static);
+
+  if (pooled != nullptr)
+    *pooled = p;
+
+  return taskGraph;
+}
+
+int runTuningGraph(htgs::TaskGraphConf<SimpleData, SimpleData> *taskGraph, htgs::TaskGraphRuntime *runtime,
+                   int numData)
+{
+  runtime->executeRuntime();
+
+  for (int i = 0; i < numData; i++)
+    taskGraph->produceData(std::make_shared<SimpleData>(i, 0));
+  taskGraph->finishedProducingData();
+
+  int numReceived = 0;
+  while (!taskGraph->isOutputTerminated()) {
+    auto data = taskGraph->consumeData();
+    if (data != nullptr)
+      numReceived++;
+  }
+
+  runtime->waitForRuntime();
+  return numReceived;
+}
+
+void tuningSignature()
+{
+  std::string path = "htgs_tuning_signature_test.txt";
+  std::remove(path.c_str());
+
+  auto graph = createTuningGraph(2, 4);
+  auto retuned = createTuningGraph(8, 16);
+  auto renamed = createTuningGraph(2, 4, nullptr, "Q");
+
+  // Thread counts and pool sizes are tuned, so they are not part of the signature
+  EXPECT_EQ(htgs::TuningProfile::getGraphSignature(graph->getTaskManagers()),
+            htgs::TuningProfile::getGraphSignature(retuned->getTaskManagers()));
+  EXPECT_NE(htgs::TuningProfile::getGraphSignature(graph->getTaskManagers()),
+            htgs::TuningProfile::getGraphSignature(renamed->getTaskManagers()));
+
+  htgs::TuningProfile profile(path, htgs::CpuTopology({{{0, 1}, {2, 3}}, {{4, 5}, {6, 7}}}));
+  EXPECT_EQ("cpus=8;domains=4.4", profile.getTopologySignature());
+  EXPECT_FALSE(profile.hasRecord(graph->getTaskManagers()));
+
+  // Only faster configurations replace the record
+  EXPECT_TRUE(profile.record(graph->getTaskManagers(), 1000));
+  EXPECT_FALSE(profile.record(retuned->getTaskManagers(), 2000));
+  EXPECT_TRUE(profile.hasRecord(retuned->getTaskManagers()));
+  EXPECT_FALSE(profile.hasRecord(renamed->getTaskManagers()));
+
+  // The record is saved and loaded for the same topology only
+  htgs::TuningProfile loaded(path, htgs::CpuTopology({{{0, 1}, {2, 3}}, {{4, 5}, {6, 7}}}));
+  htgs::TuningProfile::Record record;
+  ASSERT_TRUE(loaded.getRecord(graph->getTaskManagers(), record));
+  EXPECT_EQ(1000ULL, record.graphTime);
+  EXPECT_EQ((size_t) 2, record.numThreads["P/0"]);
+  EXPECT_EQ((size_t) 4, record.parameters["MM(static): buffer/0"]["poolSize"]);
+  EXPECT_TRUE(record.placement.empty());
+
+  htgs::TuningProfile otherMachine(path, htgs::CpuTopology({{{0, 1}}}));
+  EXPECT_FALSE(otherMachine.hasRecord(graph->getTaskManagers()));
+
+  // Applying the record sets the thread counts and pool sizes of the graph
+  htgs::TaskPlacement::Placement placement;
+  EXPECT_TRUE(loaded.apply(retuned->getTaskManagers(), placement));
+  std::map<std::string, size_t> applied;
+  for (htgs::AnyTaskManager *taskManager : *retuned->getTaskManagers()) {
+    applied[htgs::TaskPlacement::getKey(taskManager)] = taskManager->getNumThreads();
+    if (taskManager->getName() == "MM(static): buffer") {
+      EXPECT_EQ((size_t) 4, taskManager->getTaskFunction()->getTuningParameters()["poolSize"]);
+    }
+  }
+  EXPECT_EQ((size_t) 2, applied["P/0"]);
+
+  delete graph;
+  delete retuned;
+  delete renamed;
+  std::remove(path.c_str());
+}
+
+void tuningGraphExecution(int numData)
+{
+  std::string path = "htgs_tuning_execution_test.txt";
+  std::remove(path.c_str());
+
+  // The first run records its configuration
+  PooledTask *pooled = nullptr;
+  auto taskGraph = createTuningGraph(3, 4, &pooled);
+  auto runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->setTuningProfile(std::make_shared<htgs::TuningProfile>(path));
+  EXPECT_EQ(numData, runTuningGraph(taskGraph, runtime, numData));
+  EXPECT_TRUE(runtime->getTuningProfile()->hasRecord(taskGraph->getTaskManagers()));
+  delete runtime;
+
+  // A later run loads the profile and starts with the recorded thread count, replacing the hand-coded one
+  taskGraph = createTuningGraph(1, 2, &pooled);
+  runtime = new htgs::TaskGraphRuntime(taskGraph);
+  runtime->setTuningProfile(std::make_shared<htgs::TuningProfile>(path));
+  EXPECT_EQ(numData, runTuningGraph(taskGraph, runtime, numData));
+  EXPECT_EQ((size_t) 3, pooled->getNumThreads());
+  delete runtime;
+
+  // The override switch keeps the hand-coded configuration
+  taskGraph = createTuningGraph(1, 2, &pooled);
+  runtime = new htgs::TaskGraphRuntime(taskGraph);
+  std::shared_ptr<htgs::TuningProfile> profile = std::make_shared<htgs::TuningProfile>(path);
+  profile->setApplyEnabled(false);
+  runtime->setTuningProfile(profile);
+  EXPECT_EQ(numData, runTuningGraph(taskGraph, runtime, numData));
+  EXPECT_EQ((size_t) 1, pooled->getNumThreads());
+  delete runtime;
+
+  std::remove(path.c_str());
+}
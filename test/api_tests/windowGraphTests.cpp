@@ -0,0 +1,189 @@
+
+// NIST-developed software is provided by NIST as a public service. You may use, copy and distribute copies of the software in any medium, provided that you keep intact this entire notice. You may improve, modify and create derivative works of the software or any portion of the software, and you may copy and distribute such modifications or works. Modified works should carry a notice stating that you changed the software and should note the date and nature of any such change. Please explicitly acknowledge the National Institute of Standards and Technology as the source of the software.
+// NIST-developed software is expressly provided "AS IS." NIST MAKES NO WARRANTY OF ANY KIND, EXPRESS, IMPLIED, IN FACT OR ARISING BY OPERATION OF LAW, INCLUDING, WITHOUT LIMITATION, THE IMPLIED WARRANTY OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, NON-INFRINGEMENT AND DATA ACCURACY. NIST NEITHER REPRESENTS NOR WARRANTS THAT THE OPERATION OF THE SOFTWARE WILL BE UNINTERRUPTED OR ERROR-FREE, OR THAT ANY DEFECTS WILL BE CORRECTED. NIST DOES NOT WARRANT OR MAKE ANY REPRESENTATIONS REGARDING THE USE OF THE SOFTWARE OR THE RESULTS THEREOF, INCLUDING BUT NOT LIMITED TO THE CORRECTNESS, ACCURACY, RELIABILITY, OR USEFULNESS OF THE SOFTWARE.
+// You are solely responsible for determining the appropriateness of using and distributing the software and you assume all risks associated with its use, including but not limited to the risks and costs of program errors, compliance with applicable laws, damage to or loss of data, programs or equipment, and the unavailability or interruption of operation. This software is not intended to be used in any situation where a failure could cause risk of injury or damage to property. The software developed by NIST employees is not subject to copyright protection within the United States.
+//
+// Created by tjb3 on 10/18/26.
+//
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <tuple>
+
+#include <htgs/api/TaskGraphConf.hpp>
+#include <htgs/api/ExecutionPipeline.hpp>
+#include <htgs/api/TaskGraphRuntime.hpp>
+#include <htgs/api/WindowAggregateTask.hpp>
+
+#include "windowGraphTests.h"
+#include "window/data/SensorData.h"
+#include "window/rules/SensorDecompRule.h"
+
+typedef htgs::WindowAggregateTask<SensorData, int, SensorStats> SensorWindowTask;
+typedef htgs::WindowData<int, SensorStats> SensorWindowData;
+
+SensorWindowTask *createSensorWindowTask(size_t numThreads, int64_t size, int64_t slide)
+{
+  htgs::WindowSpec spec = size == slide ? htgs::WindowSpec::tumbling(size) : htgs::WindowSpec::sliding(size, slide);
+  return new SensorWindowTask(numThreads, spec,
+                              [](const SensorData &data) { return data.getSensorId(); },
+                              [](const SensorData &data) { return data.getTime(); },
+                              SensorStats(),
+                              [](SensorStats &stats, const SensorData &data) {
+                                stats.count++;
+                                stats.sum += data.getValue();
+                              },
+                              [](SensorStats &stats, const SensorStats &other) {
+                                stats.count += other.count;
+                                stats.sum += other.sum;
+                              });
+}
+
+// The count and sum for each sensor and window start
+typedef std::map<std::pair<int, int64_t>, std::pair<size_t, long>> WindowCounts;
+
+WindowCounts produceSensorData(htgs::TaskGraphConf<SensorData, SensorWindowData> *tg, int64_t size, int64_t slide,
+                               int numSensors, int64_t duration)
+{
+  WindowCounts expected;
+  for (int64_t time = 0; time < duration; time += 7) {
+    for (int sensor = 0; sensor < numSensors; sensor++) {
+      // Sensors only report at some times, so some windows are empty for a sensor
+      if ((time / size + sensor) % 3 == 0)
+        continue;
+
+      int value = (int) (time % 100) + sensor;
+      tg->produceData(new SensorData(sensor, time, value));
+
+      int64_t lastStart = time - time % slide;
+      for (int64_t start = lastStart; start > time - size; start -= slide) {
+        auto &window = expected[std::make_pair(sensor, start)];
+        window.first++;
+        window.second += value;
+      }
+    }
+  }
+
+  tg->finishedProducingData();
+  return expected;
+}
+
+WindowCounts consumeWindows(htgs::TaskGraphConf<SensorData, SensorWindowData> *tg, int64_t size)
+{
+  WindowCounts actual;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr) {
+      EXPECT_EQ(size, data->getWindowEnd() - data->getWindowStart());
+
+      // Each window must only be emitted once
+      auto key = std::make_pair(data->getKey(), data->getWindowStart());
+      EXPECT_TRUE(actual.find(key) == actual.end());
+      actual[key] = std::make_pair(data->getAggregate().count, data->getAggregate().sum);
+    }
+  }
+  return actual;
+}
+
+void windowGraphExecution(size_t numThreads, int64_t size, int64_t slide, int numSensors, int64_t duration)
+{
+  auto tg = new htgs::TaskGraphConf<SensorData, SensorWindowData>();
+  SensorWindowTask *windowTask = createSensorWindowTask(numThreads, size, slide);
+
+  // Data is produced in event-time order, but is processed out of order by multiple threads
+  windowTask->setAllowedLateness(numThreads == 1 ? 0 : duration);
+
+  tg->setGraphConsumerTask(windowTask);
+  tg->addGraphProducerTask(windowTask);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  WindowCounts expected = produceSensorData(tg, size, slide, numSensors, duration);
+  WindowCounts actual = consumeWindows(tg, size);
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ((size_t) 0, windowTask->getNumLateData());
+  EXPECT_EQ(expected, actual);
+
+  delete runtime;
+}
+
+void windowPipelineExecution(size_t numPipelines, size_t numThreads, int64_t size, int64_t slide, int numSensors,
+                             int64_t duration)
+{
+  auto tg = new htgs::TaskGraphConf<SensorData, SensorWindowData>();
+  SensorWindowTask *windowTask = createSensorWindowTask(numThreads, size, slide);
+
+  // Only the final flush of each pipeline emits windows, after all of the data of the pipeline has been aggregated
+  windowTask->setAllowedLateness(duration);
+
+  tg->setGraphConsumerTask(windowTask);
+  tg->addGraphProducerTask(windowTask);
+
+  // Each pipeline aggregates the sensors that are distributed to it
+  auto execPipeline = new htgs::ExecutionPipeline<SensorData, SensorWindowData>(numPipelines, tg);
+  execPipeline->addInputRule(new SensorDecompRule(numPipelines));
+
+  auto mainGraph = new htgs::TaskGraphConf<SensorData, SensorWindowData>();
+  mainGraph->setGraphConsumerTask(execPipeline);
+  mainGraph->addGraphProducerTask(execPipeline);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(mainGraph);
+  runtime->executeRuntime();
+
+  WindowCounts expected = produceSensorData(mainGraph, size, slide, numSensors, duration);
+  WindowCounts actual = consumeWindows(mainGraph, size);
+
+  runtime->waitForRuntime();
+
+  EXPECT_EQ(expected, actual);
+
+  delete runtime;
+}
+
+void windowLateData()
+{
+  auto tg = new htgs::TaskGraphConf<SensorData, SensorWindowData>();
+  SensorWindowTask *windowTask = createSensorWindowTask(1, 1000, 1000);
+
+  tg->setGraphConsumerTask(windowTask);
+  tg->addGraphProducerTask(windowTask);
+
+  htgs::TaskGraphRuntime *runtime = new htgs::TaskGraphRuntime(tg);
+  runtime->executeRuntime();
+
+  tg->produceData(new SensorData(0, 100, 1));
+  tg->produceData(new SensorData(0, 900, 2));
+
+  // The watermark passes the first window, which is emitted prior to termination
+  tg->produceData(new SensorData(0, 2500, 3));
+  auto first = tg->consumeData();
+  ASSERT_TRUE(first != nullptr);
+  EXPECT_EQ(0, first->getWindowStart());
+  EXPECT_EQ((size_t) 2, first->getAggregate().count);
+  EXPECT_EQ(3, first->getAggregate().sum);
+
+  // Late data for the emitted window is dropped
+  tg->produceData(new SensorData(0, 500, 4));
+  tg->produceData(new SensorData(0, 2600, 5));
+  tg->finishedProducingData();
+
+  std::vector<std::shared_ptr<SensorWindowData>> remaining;
+  while (!tg->isOutputTerminated()) {
+    auto data = tg->consumeData();
+    if (data != nullptr)
+      remaining.push_back(data);
+  }
+
+  runtime->waitForRuntime();
+
+  ASSERT_EQ((size_t) 1, remaining.size());
+  EXPECT_EQ(2000, remaining[0]->getWindowStart());
+  EXPECT_EQ(8, remaining[0]->getAggregate().sum);
+  EXPECT_EQ((size_t) 1, windowTask->getNumLateData());
+
+  delete runtime;
+}